@@ -31,6 +31,25 @@
 // A debug option to disable allocators at compile time to investigate future issues.
 #define DEBUG_DISABLE_APP_ALLOCATORS 0
 
+#if defined(LOADER_ENABLE_TEST_HOOKS)
+static PFN_loader_system_allocation_observer system_allocation_observer = NULL;
+static void *system_allocation_observer_user_data = NULL;
+
+LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL loader_test_set_system_allocation_observer(PFN_loader_system_allocation_observer observer,
+                                                                                   void *user_data) {
+    system_allocation_observer = observer;
+    system_allocation_observer_user_data = user_data;
+}
+
+static void observe_system_allocation(void *pMemory, void *pOriginal, size_t size) {
+    if (NULL != system_allocation_observer) {
+        system_allocation_observer(system_allocation_observer_user_data, pMemory, pOriginal, size);
+    }
+}
+#else
+#define observe_system_allocation(pMemory, pOriginal, size)
+#endif
+
 void *loader_alloc(const VkAllocationCallbacks *pAllocator, size_t size, VkSystemAllocationScope allocation_scope) {
     void *pMemory = NULL;
 #if (DEBUG_DISABLE_APP_ALLOCATORS == 1)
@@ -43,6 +62,7 @@ void *loader_alloc(const VkAllocationCallbacks *pAllocator, size_t size, VkSyste
     } else {
 #endif
         pMemory = malloc(size);
+        observe_system_allocation(pMemory, NULL, size);
     }
 
     return pMemory;
@@ -63,6 +83,7 @@ void *loader_calloc(const VkAllocationCallbacks *pAllocator, size_t size, VkSyst
     } else {
 #endif
         pMemory = calloc(1, size);
+        observe_system_allocation(pMemory, NULL, size);
     }
 
     return pMemory;
@@ -77,6 +98,7 @@ void loader_free(const VkAllocationCallbacks *pAllocator, void *pMemory) {
             pAllocator->pfnFree(pAllocator->pUserData, pMemory);
         } else {
 #endif
+            observe_system_allocation(NULL, pMemory, 0);
             free(pMemory);
         }
     }
@@ -88,6 +110,7 @@ void *loader_realloc(const VkAllocationCallbacks *pAllocator, void *pMemory, siz
     if (pMemory == NULL || orig_size == 0) {
         pNewMem = loader_alloc(pAllocator, size, allocation_scope);
     } else if (size == 0) {
+        // Frees pMemory and returns NULL, loader_free reports the free to the observer
         loader_free(pAllocator, pMemory);
 #if (DEBUG_DISABLE_APP_ALLOCATORS == 1)
 #else
@@ -98,6 +121,9 @@ void *loader_realloc(const VkAllocationCallbacks *pAllocator, void *pMemory, siz
 #endif
     } else {
         pNewMem = realloc(pMemory, size);
+        if (NULL != pNewMem) {
+            observe_system_allocation(pNewMem, pMemory, size);
+        }
     }
     return pNewMem;
 }
@@ -31,6 +31,16 @@
 #include "loader_common.h"
 #include "stack_allocation.h"
 
+#if defined(LOADER_ENABLE_TEST_HOOKS)
+// Test builds report the allocations made with the system allocator, which no VkAllocationCallbacks see, to the observer set
+// here. pMemory is NULL when pOriginal is freed, including by a reallocation to a size of 0, pOriginal is NULL for new
+// allocations, and both are set when pOriginal is reallocated to pMemory. The observer must be set or cleared while no other
+// thread is in the loader.
+typedef void(VKAPI_PTR *PFN_loader_system_allocation_observer)(void *user_data, void *pMemory, void *pOriginal, size_t size);
+LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL loader_test_set_system_allocation_observer(PFN_loader_system_allocation_observer observer,
+                                                                                   void *user_data);
+#endif
+
 void *loader_instance_heap_alloc(const struct loader_instance *instance, size_t size, VkSystemAllocationScope allocation_scope);
 void *loader_instance_heap_calloc(const struct loader_instance *instance, size_t size, VkSystemAllocationScope allocation_scope);
 void loader_instance_heap_free(const struct loader_instance *instance, void *pMemory);
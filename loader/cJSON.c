@@ -429,11 +429,11 @@ char *print_string_ptr(const VkAllocationCallbacks *pAllocator, const char *str,
 char *print_string(cJSON *item, printbuffer *p) { return print_string_ptr(item->pAllocator, item->valuestring, p); }
 
 /* Predeclare these prototypes. */
-const char *parse_value(cJSON *item, const char *value);
+const char *parse_value(cJSON *item, const char *value, int depth);
 char *print_value(cJSON *item, int depth, int fmt, printbuffer *p);
-const char *parse_array(cJSON *item, const char *value);
+const char *parse_array(cJSON *item, const char *value, int depth);
 char *print_array(cJSON *item, int depth, int fmt, printbuffer *p);
-const char *parse_object(cJSON *item, const char *value);
+const char *parse_object(cJSON *item, const char *value, int depth);
 char *print_object(cJSON *item, int depth, int fmt, printbuffer *p);
 
 /* Utility to jump whitespace and cr/lf */
@@ -450,7 +450,7 @@ cJSON *cJSON_ParseWithOpts(const VkAllocationCallbacks *pAllocator, const char *
     ep = 0;
     if (!c) return 0; /* memory fail */
 
-    end = parse_value(c, skip(value));
+    end = parse_value(c, skip(value), 0);
     if (!end) {
         cJSON_Delete(c);
         return 0;
@@ -487,7 +487,7 @@ char *cJSON_PrintBuffered(cJSON *item, int prebuffer, int fmt) {
 }
 
 /* Parser core - when encountering text, process appropriately. */
-const char *parse_value(cJSON *item, const char *value) {
+const char *parse_value(cJSON *item, const char *value, int depth) {
     if (!value) return 0; /* Fail on null. */
     if (!strncmp(value, "null", 4)) {
         item->type = cJSON_NULL;
@@ -509,10 +509,10 @@ const char *parse_value(cJSON *item, const char *value) {
         return parse_number(item, value);
     }
     if (*value == '[') {
-        return parse_array(item, value);
+        return parse_array(item, value, depth);
     }
     if (*value == '{') {
-        return parse_object(item, value);
+        return parse_object(item, value, depth);
     }
 
     ep = value;
@@ -582,12 +582,16 @@ char *print_value(cJSON *item, int depth, int fmt, printbuffer *p) {
 }
 
 /* Build an array from input text. */
-const char *parse_array(cJSON *item, const char *value) {
+const char *parse_array(cJSON *item, const char *value, int depth) {
     cJSON *child;
     if (*value != '[') {
         ep = value;
         return 0;
     } /* not an array! */
+    if (depth >= CJSON_NESTING_LIMIT) {
+        ep = value;
+        return 0;
+    } /* nested too deeply. */
 
     item->type = cJSON_Array;
     value = skip(value + 1);
@@ -595,7 +599,7 @@ const char *parse_array(cJSON *item, const char *value) {
 
     item->child = child = cJSON_New_Item(item->pAllocator);
     if (!item->child) return 0;                    /* memory fail */
-    value = skip(parse_value(child, skip(value))); /* skip any spacing, get the value. */
+    value = skip(parse_value(child, skip(value), depth + 1)); /* skip any spacing, get the value. */
     if (!value) return 0;
 
     while (*value == ',') {
@@ -605,7 +609,7 @@ const char *parse_array(cJSON *item, const char *value) {
         child->next = new_item;
         new_item->prev = child;
         child = new_item;
-        value = skip(parse_value(child, skip(value + 1)));
+        value = skip(parse_value(child, skip(value + 1), depth + 1));
         if (!value) return 0; /* memory fail */
     }
 
@@ -715,12 +719,16 @@ char *print_array(cJSON *item, int depth, int fmt, printbuffer *p) {
 }
 
 /* Build an object from the text. */
-const char *parse_object(cJSON *item, const char *value) {
+const char *parse_object(cJSON *item, const char *value, int depth) {
     cJSON *child;
     if (*value != '{') {
         ep = value;
         return 0;
     } /* not an object! */
+    if (depth >= CJSON_NESTING_LIMIT) {
+        ep = value;
+        return 0;
+    } /* nested too deeply. */
 
     item->type = cJSON_Object;
     value = skip(value + 1);
@@ -736,7 +744,7 @@ const char *parse_object(cJSON *item, const char *value) {
         ep = value;
         return 0;
     }                                                  /* fail! */
-    value = skip(parse_value(child, skip(value + 1))); /* skip any spacing, get the value. */
+    value = skip(parse_value(child, skip(value + 1), depth + 1)); /* skip any spacing, get the value. */
     if (!value) return 0;
 
     while (*value == ',') {
@@ -754,7 +762,7 @@ const char *parse_object(cJSON *item, const char *value) {
             ep = value;
             return 0;
         }                                                  /* fail! */
-        value = skip(parse_value(child, skip(value + 1))); /* skip any spacing, get the value. */
+        value = skip(parse_value(child, skip(value + 1), depth + 1)); /* skip any spacing, get the value. */
         if (!value) return 0;
     }
 
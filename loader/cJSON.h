@@ -43,6 +43,9 @@ extern "C" {
 #define cJSON_IsReference 256
 #define cJSON_StringIsConst 512
 
+/* Arrays and objects nested deeper than this fail to parse, which bounds the recursion of the parser and printer */
+#define CJSON_NESTING_LIMIT 1000
+
 /* The cJSON structure: */
 typedef struct cJSON {
     struct cJSON *next, *prev; /* next/prev allow you to walk array/object
@@ -41,39 +41,209 @@
 #include "loader.h"
 #include "vk_loader_platform.h"
 
-// VK_EXT_debug_report related items
+// Debug callback snapshots
+//
+// Readers, such as loader_log, walk the debug callbacks of an instance without taking a lock. Each snapshot counts the readers
+// walking it, and is freed once it has been swapped out and that count is zero. Writers serialize on loader_debug_callback_lock
+// and publish a modified copy of the current snapshot in place of it, retiring the snapshot which was swapped out.
+//
+// A reader has to load the snapshot before it can count itself in it, so it first counts itself in debug_callback_acquiring, in
+// the slot picked by the parity of debug_callback_epoch. After swapping a snapshot out, the writer flips the epoch and waits for
+// the slot of the old epoch to empty. Readers which count themselves in that slot before the flip are waited for, and readers
+// which come after it load the new snapshot, so once the slot is empty the reader count of the retired snapshot is exact. The
+// wait only covers the few instructions between loading a snapshot and counting in it, never a callback.
+//
+// Destroying a callback waits until no retired snapshot which contains it is being walked, so that the application can free
+// what its pUserData points to as soon as the destroy call returns. Callbacks may not call Vulkan commands, so a callback can't
+// be waiting on itself. Snapshots are allocated with the instance allocator, since they may outlive the call which made them.
+
+// Returns the current snapshot, which stays valid until it is passed to debug_callbacks_release
+static struct loader_debug_callbacks *debug_callbacks_acquire(const struct loader_instance *inst) {
+    // Most instances have no callbacks, which leaves nothing to walk and so no reason to be counted as a reader
+    if (NULL == loader_platform_atomic_load_ptr((void *const volatile *)&inst->debug_callbacks)) {
+        return NULL;
+    }
+    // The reader counts are the only part of the instance which readers modify
+    struct loader_instance *counted_inst = (struct loader_instance *)inst;
+    volatile uint32_t *acquiring = NULL;
+    while (true) {
+        uint32_t epoch = loader_platform_atomic_load_u32(&counted_inst->debug_callback_epoch);
+        acquiring = &counted_inst->debug_callback_acquiring[epoch & 1];
+        loader_platform_atomic_increment(acquiring);
+        // A writer which flipped the epoch in between may already have checked this slot, so count in the other one instead
+        if (epoch == loader_platform_atomic_load_u32(&counted_inst->debug_callback_epoch)) {
+            break;
+        }
+        loader_platform_atomic_decrement(acquiring);
+    }
+    struct loader_debug_callbacks *callbacks =
+        (struct loader_debug_callbacks *)loader_platform_atomic_load_ptr((void *const volatile *)&inst->debug_callbacks);
+    if (NULL != callbacks) {
+        loader_platform_atomic_increment(&callbacks->readers);
+    }
+    loader_platform_atomic_decrement(acquiring);
+    return callbacks;
+}
 
-VkResult util_CreateDebugUtilsMessenger(struct loader_instance *inst, const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo,
-                                        const VkAllocationCallbacks *pAllocator, VkDebugUtilsMessengerEXT messenger) {
-    VkLayerDbgFunctionNode *pNewDbgFuncNode = NULL;
+static void debug_callbacks_release(struct loader_debug_callbacks *callbacks) {
+    if (NULL != callbacks) {
+        loader_platform_atomic_decrement(&callbacks->readers);
+    }
+}
 
-    pNewDbgFuncNode = (VkLayerDbgFunctionNode *)loader_calloc_with_instance_fallback(
-        pAllocator, inst, sizeof(VkLayerDbgFunctionNode), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+// Frees the given snapshot along with every snapshot retired before it
+static void debug_callbacks_free(struct loader_instance *inst, struct loader_debug_callbacks *callbacks) {
+    while (NULL != callbacks) {
+        struct loader_debug_callbacks *next = callbacks->retired_next;
+        loader_instance_heap_free(inst, callbacks->nodes);
+        loader_instance_heap_free(inst, callbacks);
+        callbacks = next;
+    }
+}
 
-    if (!pNewDbgFuncNode) {
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
+static struct loader_debug_callbacks *debug_callbacks_create(struct loader_instance *inst, uint32_t count) {
+    struct loader_debug_callbacks *callbacks = (struct loader_debug_callbacks *)loader_instance_heap_calloc(
+        inst, sizeof(struct loader_debug_callbacks), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    if (NULL == callbacks) {
+        return NULL;
+    }
+    callbacks->nodes = (VkLayerDbgFunctionNode *)loader_instance_heap_alloc(inst, count * sizeof(VkLayerDbgFunctionNode),
+                                                                            VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    if (NULL == callbacks->nodes) {
+        loader_instance_heap_free(inst, callbacks);
+        return NULL;
     }
+    callbacks->count = count;
+    return callbacks;
+}
 
-    pNewDbgFuncNode->is_messenger = true;
-    pNewDbgFuncNode->messenger.messenger = messenger;
-    pNewDbgFuncNode->messenger.pfnUserCallback = pCreateInfo->pfnUserCallback;
-    pNewDbgFuncNode->messenger.messageSeverity = pCreateInfo->messageSeverity;
-    pNewDbgFuncNode->messenger.messageType = pCreateInfo->messageType;
-    pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
-    pNewDbgFuncNode->pNext = inst->DbgFunctionHead;
-    inst->DbgFunctionHead = pNewDbgFuncNode;
+// Must be called with loader_debug_callback_lock held. Frees each retired snapshot which no reader is walking.
+static void debug_callbacks_free_unread(struct loader_instance *inst) {
+    struct loader_debug_callbacks **link = &inst->retired_debug_callbacks;
+    while (NULL != *link) {
+        struct loader_debug_callbacks *callbacks = *link;
+        if (0 == loader_platform_atomic_load_u32(&callbacks->readers)) {
+            *link = callbacks->retired_next;
+            callbacks->retired_next = NULL;
+            debug_callbacks_free(inst, callbacks);
+        } else {
+            link = &callbacks->retired_next;
+        }
+    }
+}
 
-    return VK_SUCCESS;
+// Must be called with loader_debug_callback_lock held. Swaps in the given snapshot, which is NULL when there are no callbacks.
+static void debug_callbacks_publish(struct loader_instance *inst, struct loader_debug_callbacks *callbacks) {
+    struct loader_debug_callbacks *old_callbacks = inst->debug_callbacks;
+    loader_platform_atomic_store_ptr((void *volatile *)&inst->debug_callbacks, callbacks);
+    if (NULL != old_callbacks) {
+        old_callbacks->retired_next = inst->retired_debug_callbacks;
+        inst->retired_debug_callbacks = old_callbacks;
+
+        // Wait for the readers which may have loaded the old snapshot without having counted themselves in it yet
+        uint32_t old_epoch = loader_platform_atomic_increment(&inst->debug_callback_epoch) - 1;
+        while (0 != loader_platform_atomic_load_u32(&inst->debug_callback_acquiring[old_epoch & 1])) {
+            loader_platform_sleep_us(1);
+        }
+    }
+    debug_callbacks_free_unread(inst);
+}
+
+// Must be called with loader_debug_callback_lock held. Only one of messenger and callback is a valid handle.
+static bool debug_callbacks_retired_contain(const struct loader_instance *inst, VkDebugUtilsMessengerEXT messenger,
+                                            VkDebugReportCallbackEXT callback) {
+    for (struct loader_debug_callbacks *callbacks = inst->retired_debug_callbacks; NULL != callbacks;
+         callbacks = callbacks->retired_next) {
+        for (uint32_t i = 0; i < callbacks->count; i++) {
+            const VkLayerDbgFunctionNode *node = &callbacks->nodes[i];
+            if (node->is_messenger ? (VK_NULL_HANDLE != messenger && node->messenger.messenger == messenger)
+                                   : (VK_NULL_HANDLE != callback && node->report.msgCallback == callback)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Waits until no thread walks a snapshot containing the messenger or callback, which was already removed from the current one
+static void debug_callbacks_wait_for_readers(struct loader_instance *inst, VkDebugUtilsMessengerEXT messenger,
+                                             VkDebugReportCallbackEXT callback) {
+    while (true) {
+        loader_platform_thread_lock_mutex(&loader_debug_callback_lock);
+        debug_callbacks_free_unread(inst);
+        bool still_read = debug_callbacks_retired_contain(inst, messenger, callback);
+        loader_platform_thread_unlock_mutex(&loader_debug_callback_lock);
+        if (!still_read) {
+            return;
+        }
+        loader_platform_sleep_us(10);
+    }
+}
+
+// Publishes a copy of the current snapshot with the node added in front, so that the newest callback is called first
+static VkResult debug_callbacks_add(struct loader_instance *inst, const VkLayerDbgFunctionNode *node) {
+    VkResult res = VK_SUCCESS;
+    loader_platform_thread_lock_mutex(&loader_debug_callback_lock);
+    struct loader_debug_callbacks *old_callbacks = inst->debug_callbacks;
+    uint32_t old_count = NULL != old_callbacks ? old_callbacks->count : 0;
+    struct loader_debug_callbacks *callbacks = debug_callbacks_create(inst, old_count + 1);
+    if (NULL == callbacks) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    callbacks->nodes[0] = *node;
+    if (old_count > 0) {
+        memcpy(&callbacks->nodes[1], old_callbacks->nodes, old_count * sizeof(VkLayerDbgFunctionNode));
+    }
+    debug_callbacks_publish(inst, callbacks);
+
+out:
+    loader_platform_thread_unlock_mutex(&loader_debug_callback_lock);
+    return res;
+}
+
+// Must be called with loader_debug_callback_lock held. Publishes a copy of the current snapshot without the node at index.
+// Returns false if that copy couldn't be allocated, in which case the callback is left in place.
+static bool debug_callbacks_remove(struct loader_instance *inst, uint32_t index) {
+    struct loader_debug_callbacks *old_callbacks = inst->debug_callbacks;
+    struct loader_debug_callbacks *callbacks = NULL;
+    if (old_callbacks->count > 1) {
+        callbacks = debug_callbacks_create(inst, old_callbacks->count - 1);
+        if (NULL == callbacks) {
+            return false;
+        }
+        memcpy(callbacks->nodes, old_callbacks->nodes, index * sizeof(VkLayerDbgFunctionNode));
+        memcpy(&callbacks->nodes[index], &old_callbacks->nodes[index + 1],
+               (old_callbacks->count - index - 1) * sizeof(VkLayerDbgFunctionNode));
+    }
+    debug_callbacks_publish(inst, callbacks);
+    return true;
+}
+
+// VK_EXT_debug_report related items
+
+VkResult util_CreateDebugUtilsMessenger(struct loader_instance *inst, const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo,
+                                        VkDebugUtilsMessengerEXT messenger) {
+    VkLayerDbgFunctionNode new_node;
+    memset(&new_node, 0, sizeof(VkLayerDbgFunctionNode));
+    new_node.is_messenger = true;
+    new_node.messenger.messenger = messenger;
+    new_node.messenger.pfnUserCallback = pCreateInfo->pfnUserCallback;
+    new_node.messenger.messageSeverity = pCreateInfo->messageSeverity;
+    new_node.messenger.messageType = pCreateInfo->messageType;
+    new_node.pUserData = pCreateInfo->pUserData;
+    return debug_callbacks_add(inst, &new_node);
 }
 
 static VKAPI_ATTR VkResult VKAPI_CALL
 debug_utils_CreateDebugUtilsMessengerEXT(VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo,
                                          const VkAllocationCallbacks *pAllocator, VkDebugUtilsMessengerEXT *pMessenger) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
-    VkResult result = inst->disp->layer_inst_disp.CreateDebugUtilsMessengerEXT(inst->instance, pCreateInfo, pAllocator, pMessenger);
-    loader_platform_thread_unlock_mutex(&loader_lock);
-    return result;
+    return inst->disp->layer_inst_disp.CreateDebugUtilsMessengerEXT(inst->instance, pCreateInfo, pAllocator, pMessenger);
+}
+
+bool util_HasDebugCallbacks(const struct loader_instance *inst) {
+    return NULL != loader_platform_atomic_load_ptr((void *const volatile *)&inst->debug_callbacks);
 }
 
 VkBool32 util_SubmitDebugUtilsMessageEXT(const struct loader_instance *inst, VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
@@ -82,7 +252,6 @@ VkBool32 util_SubmitDebugUtilsMessageEXT(const struct loader_instance *inst, VkD
     VkBool32 bail = false;
 
     if (NULL != pCallbackData) {
-        VkLayerDbgFunctionNode *pTrav = inst->DbgFunctionHead;
         VkDebugReportObjectTypeEXT object_type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT;
         VkDebugReportFlagsEXT object_flags = 0;
         uint64_t object_handle = 0;
@@ -92,7 +261,9 @@ VkBool32 util_SubmitDebugUtilsMessageEXT(const struct loader_instance *inst, VkD
             debug_utils_AnnotObjectToDebugReportObject(pCallbackData->pObjects, &object_type, &object_handle);
         }
 
-        while (pTrav) {
+        struct loader_debug_callbacks *callbacks = debug_callbacks_acquire(inst);
+        for (uint32_t i = 0; NULL != callbacks && i < callbacks->count; i++) {
+            const VkLayerDbgFunctionNode *pTrav = &callbacks->nodes[i];
             if (pTrav->is_messenger && (pTrav->messenger.messageSeverity & messageSeverity) &&
                 (pTrav->messenger.messageType & messageTypes)) {
                 if (pTrav->messenger.pfnUserCallback(messageSeverity, messageTypes, pCallbackData, pTrav->pUserData)) {
@@ -105,41 +276,41 @@ VkBool32 util_SubmitDebugUtilsMessageEXT(const struct loader_instance *inst, VkD
                     bail = true;
                 }
             }
-
-            pTrav = pTrav->pNext;
         }
+        debug_callbacks_release(callbacks);
     }
 
     return bail;
 }
 
-void util_DestroyDebugUtilsMessenger(struct loader_instance *inst, VkDebugUtilsMessengerEXT messenger,
-                                     const VkAllocationCallbacks *pAllocator) {
-    VkLayerDbgFunctionNode *pTrav = inst->DbgFunctionHead;
-    VkLayerDbgFunctionNode *pPrev = pTrav;
-
-    while (pTrav) {
-        if (pTrav->is_messenger && pTrav->messenger.messenger == messenger) {
-            pPrev->pNext = pTrav->pNext;
-            if (inst->DbgFunctionHead == pTrav) inst->DbgFunctionHead = pTrav->pNext;
-            loader_free_with_instance_fallback(pAllocator, inst, pTrav);
+void util_DestroyDebugUtilsMessenger(struct loader_instance *inst, VkDebugUtilsMessengerEXT messenger) {
+    bool removed = true;
+    loader_platform_thread_lock_mutex(&loader_debug_callback_lock);
+    struct loader_debug_callbacks *callbacks = inst->debug_callbacks;
+    for (uint32_t i = 0; NULL != callbacks && i < callbacks->count; i++) {
+        if (callbacks->nodes[i].is_messenger && callbacks->nodes[i].messenger.messenger == messenger) {
+            removed = debug_callbacks_remove(inst, i);
             break;
         }
-        pPrev = pTrav;
-        pTrav = pTrav->pNext;
+    }
+    loader_platform_thread_unlock_mutex(&loader_debug_callback_lock);
+    if (removed) {
+        debug_callbacks_wait_for_readers(inst, messenger, VK_NULL_HANDLE);
+    } else {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
+                   "vkDestroyDebugUtilsMessengerEXT: Out of memory, the messenger will be called until the instance is destroyed");
     }
 }
 
-VkResult util_CreateDebugUtilsMessengers(struct loader_instance *inst, const void *pChain,
-                                         const VkAllocationCallbacks *pAllocator) {
+VkResult util_CreateDebugUtilsMessengers(struct loader_instance *inst, const void *pChain) {
     const void *pNext = pChain;
     while (pNext) {
         if (((const VkBaseInStructure *)pNext)->sType == VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT) {
             // Assign a unique handle to each messenger (just use the address of the VkDebugUtilsMessengerCreateInfoEXT)
             // This is only being used this way due to it being for an 'anonymous' callback during instance creation
             VkDebugUtilsMessengerEXT messenger_handle = (VkDebugUtilsMessengerEXT)(uintptr_t)pNext;
-            VkResult ret = util_CreateDebugUtilsMessenger(inst, (const VkDebugUtilsMessengerCreateInfoEXT *)pNext, pAllocator,
-                                                          messenger_handle);
+            VkResult ret =
+                util_CreateDebugUtilsMessenger(inst, (const VkDebugUtilsMessengerCreateInfoEXT *)pNext, messenger_handle);
             if (ret != VK_SUCCESS) {
                 return ret;
             }
@@ -160,11 +331,7 @@ static VKAPI_ATTR void VKAPI_CALL debug_utils_SubmitDebugUtilsMessageEXT(
 static VKAPI_ATTR void VKAPI_CALL debug_utils_DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT messenger,
                                                                             const VkAllocationCallbacks *pAllocator) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
-
     inst->disp->layer_inst_disp.DestroyDebugUtilsMessengerEXT(inst->instance, messenger, pAllocator);
-
-    loader_platform_thread_unlock_mutex(&loader_lock);
 }
 
 // This is the instance chain terminator function for CreateDebugUtilsMessenger
@@ -177,7 +344,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugUtilsMessengerEXT(VkInstanc
     struct loader_instance *inst = (struct loader_instance *)instance;
     VkResult res = VK_SUCCESS;
     uint32_t storage_idx;
-    VkLayerDbgFunctionNode *pNewDbgFuncNode = NULL;
+
+    // A messenger is created in every driver, so any driver instance which was deferred must exist first
+    res = loader_create_deferred_icd_instances(inst);
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
 
     icd_info = (VkDebugUtilsMessengerEXT *)loader_calloc_with_instance_fallback(
         pAllocator, inst, inst->total_icd_count * sizeof(VkDebugUtilsMessengerEXT), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
@@ -204,23 +376,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugUtilsMessengerEXT(VkInstanc
     // Setup the debug report callback in the terminator since a layer may want
     // to grab the information itself (RenderDoc) and then return back to the
     // user callback a sub-set of the messages.
-    pNewDbgFuncNode = (VkLayerDbgFunctionNode *)loader_calloc_with_instance_fallback(
-        pAllocator, inst, sizeof(VkLayerDbgFunctionNode), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
-    if (!pNewDbgFuncNode) {
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
-    }
-
-    pNewDbgFuncNode->is_messenger = true;
-    pNewDbgFuncNode->messenger.pfnUserCallback = pCreateInfo->pfnUserCallback;
-    pNewDbgFuncNode->messenger.messageSeverity = pCreateInfo->messageSeverity;
-    pNewDbgFuncNode->messenger.messageType = pCreateInfo->messageType;
-    pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
-    pNewDbgFuncNode->pNext = inst->DbgFunctionHead;
-    inst->DbgFunctionHead = pNewDbgFuncNode;
-
     *(VkDebugUtilsMessengerEXT **)pMessenger = icd_info;
-    pNewDbgFuncNode->messenger.messenger = *pMessenger;
+    res = util_CreateDebugUtilsMessenger(inst, pCreateInfo, *pMessenger);
 
 out:
 
@@ -237,7 +394,6 @@ out:
             }
             storage_idx++;
         }
-        loader_free_with_instance_fallback(pAllocator, inst, pNewDbgFuncNode);
         loader_free_with_instance_fallback(pAllocator, inst, icd_info);
     }
 
@@ -265,7 +421,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyDebugUtilsMessengerEXT(VkInstance i
         storage_idx++;
     }
 
-    util_DestroyDebugUtilsMessenger(inst, messenger, pAllocator);
+    util_DestroyDebugUtilsMessenger(inst, messenger);
 
     loader_free_with_instance_fallback(pAllocator, inst, icd_info);
 }
@@ -275,54 +431,39 @@ VKAPI_ATTR void VKAPI_CALL terminator_SubmitDebugUtilsMessageEXT(VkInstance inst
                                                                  VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
                                                                  VkDebugUtilsMessageTypeFlagsEXT messageTypes,
                                                                  const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData) {
-    loader_platform_thread_lock_mutex(&loader_lock);
     // NOTE: Just make the callback ourselves because there could be one or more ICDs that support this extension
     //       and each one will trigger the callback to the user.  This would result in multiple callback triggers
     //       per message.  Instead, if we get a messaged up to here, then just trigger the message ourselves and
     //       return.  This would still allow the ICDs to trigger their own messages, but won't get any external ones.
     struct loader_instance *inst = (struct loader_instance *)instance;
     util_SubmitDebugUtilsMessageEXT(inst, messageSeverity, messageTypes, pCallbackData);
-    loader_platform_thread_unlock_mutex(&loader_lock);
 }
 
 // VK_EXT_debug_report related items
 
 VkResult util_CreateDebugReportCallback(struct loader_instance *inst, const VkDebugReportCallbackCreateInfoEXT *pCreateInfo,
-                                        const VkAllocationCallbacks *pAllocator, VkDebugReportCallbackEXT callback) {
-    VkLayerDbgFunctionNode *pNewDbgFuncNode = NULL;
-
-    pNewDbgFuncNode = (VkLayerDbgFunctionNode *)loader_calloc_with_instance_fallback(
-        pAllocator, inst, sizeof(VkLayerDbgFunctionNode), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
-    if (!pNewDbgFuncNode) {
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
-    }
-
-    pNewDbgFuncNode->is_messenger = false;
-    pNewDbgFuncNode->report.msgCallback = callback;
-    pNewDbgFuncNode->report.pfnMsgCallback = pCreateInfo->pfnCallback;
-    pNewDbgFuncNode->report.msgFlags = pCreateInfo->flags;
-    pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
-    pNewDbgFuncNode->pNext = inst->DbgFunctionHead;
-    inst->DbgFunctionHead = pNewDbgFuncNode;
-
-    return VK_SUCCESS;
+                                        VkDebugReportCallbackEXT callback) {
+    VkLayerDbgFunctionNode new_node;
+    memset(&new_node, 0, sizeof(VkLayerDbgFunctionNode));
+    new_node.is_messenger = false;
+    new_node.report.msgCallback = callback;
+    new_node.report.pfnMsgCallback = pCreateInfo->pfnCallback;
+    new_node.report.msgFlags = pCreateInfo->flags;
+    new_node.pUserData = pCreateInfo->pUserData;
+    return debug_callbacks_add(inst, &new_node);
 }
 
 static VKAPI_ATTR VkResult VKAPI_CALL
 debug_utils_CreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT *pCreateInfo,
                                          const VkAllocationCallbacks *pAllocator, VkDebugReportCallbackEXT *pCallback) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
-    VkResult result = inst->disp->layer_inst_disp.CreateDebugReportCallbackEXT(inst->instance, pCreateInfo, pAllocator, pCallback);
-    loader_platform_thread_unlock_mutex(&loader_lock);
-    return result;
+    return inst->disp->layer_inst_disp.CreateDebugReportCallbackEXT(inst->instance, pCreateInfo, pAllocator, pCallback);
 }
 
 // Utility function to handle reporting
 VkBool32 util_DebugReportMessage(const struct loader_instance *inst, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
                                  uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix, const char *pMsg) {
     VkBool32 bail = false;
-    VkLayerDbgFunctionNode *pTrav = inst->DbgFunctionHead;
     VkDebugUtilsMessageSeverityFlagBitsEXT severity;
     VkDebugUtilsMessageTypeFlagsEXT types;
     VkDebugUtilsMessengerCallbackDataEXT callback_data;
@@ -344,7 +485,9 @@ VkBool32 util_DebugReportMessage(const struct loader_instance *inst, VkFlags msg
     callback_data.objectCount = 1;
     callback_data.pObjects = &object_name;
 
-    while (pTrav) {
+    struct loader_debug_callbacks *callbacks = debug_callbacks_acquire(inst);
+    for (uint32_t i = 0; NULL != callbacks && i < callbacks->count; i++) {
+        const VkLayerDbgFunctionNode *pTrav = &callbacks->nodes[i];
         if (!pTrav->is_messenger && pTrav->report.msgFlags & msgFlags) {
             if (pTrav->report.pfnMsgCallback(msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, pMsg,
                                              pTrav->pUserData)) {
@@ -356,40 +499,39 @@ VkBool32 util_DebugReportMessage(const struct loader_instance *inst, VkFlags msg
                 bail = true;
             }
         }
-
-        pTrav = pTrav->pNext;
     }
+    debug_callbacks_release(callbacks);
 
     return bail;
 }
 
-void util_DestroyDebugReportCallback(struct loader_instance *inst, VkDebugReportCallbackEXT callback,
-                                     const VkAllocationCallbacks *pAllocator) {
-    VkLayerDbgFunctionNode *pTrav = inst->DbgFunctionHead;
-    VkLayerDbgFunctionNode *pPrev = pTrav;
-
-    while (pTrav) {
-        if (!pTrav->is_messenger && pTrav->report.msgCallback == callback) {
-            pPrev->pNext = pTrav->pNext;
-            if (inst->DbgFunctionHead == pTrav) inst->DbgFunctionHead = pTrav->pNext;
-            loader_free_with_instance_fallback(pAllocator, inst, pTrav);
+void util_DestroyDebugReportCallback(struct loader_instance *inst, VkDebugReportCallbackEXT callback) {
+    bool removed = true;
+    loader_platform_thread_lock_mutex(&loader_debug_callback_lock);
+    struct loader_debug_callbacks *callbacks = inst->debug_callbacks;
+    for (uint32_t i = 0; NULL != callbacks && i < callbacks->count; i++) {
+        if (!callbacks->nodes[i].is_messenger && callbacks->nodes[i].report.msgCallback == callback) {
+            removed = debug_callbacks_remove(inst, i);
             break;
         }
-        pPrev = pTrav;
-        pTrav = pTrav->pNext;
+    }
+    loader_platform_thread_unlock_mutex(&loader_debug_callback_lock);
+    if (removed) {
+        debug_callbacks_wait_for_readers(inst, VK_NULL_HANDLE, callback);
+    } else {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
+                   "vkDestroyDebugReportCallbackEXT: Out of memory, the callback will be called until the instance is destroyed");
     }
 }
 
-VkResult util_CreateDebugReportCallbacks(struct loader_instance *inst, const void *pChain,
-                                         const VkAllocationCallbacks *pAllocator) {
+VkResult util_CreateDebugReportCallbacks(struct loader_instance *inst, const void *pChain) {
     const void *pNext = pChain;
     while (pNext) {
         if (((VkBaseInStructure *)pNext)->sType == VK_STRUCTURE_TYPE_DEBUG_REPORT_CREATE_INFO_EXT) {
             // Assign a unique handle to each callback (just use the address of the VkDebugReportCallbackCreateInfoEXT):
             // This is only being used this way due to it being for an 'anonymous' callback during instance creation
             VkDebugReportCallbackEXT report_handle = (VkDebugReportCallbackEXT)(uintptr_t)pNext;
-            VkResult ret =
-                util_CreateDebugReportCallback(inst, (const VkDebugReportCallbackCreateInfoEXT *)pNext, pAllocator, report_handle);
+            VkResult ret = util_CreateDebugReportCallback(inst, (const VkDebugReportCallbackCreateInfoEXT *)pNext, report_handle);
             if (ret != VK_SUCCESS) {
                 return ret;
             }
@@ -402,11 +544,7 @@ VkResult util_CreateDebugReportCallbacks(struct loader_instance *inst, const voi
 static VKAPI_ATTR void VKAPI_CALL debug_utils_DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback,
                                                                             const VkAllocationCallbacks *pAllocator) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
-
     inst->disp->layer_inst_disp.DestroyDebugReportCallbackEXT(inst->instance, callback, pAllocator);
-
-    loader_platform_thread_unlock_mutex(&loader_lock);
 }
 
 static VKAPI_ATTR void VKAPI_CALL debug_utils_DebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags,
@@ -430,7 +568,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugReportCallbackEXT(VkInstanc
     struct loader_instance *inst = (struct loader_instance *)instance;
     VkResult res = VK_SUCCESS;
     uint32_t storage_idx;
-    VkLayerDbgFunctionNode *pNewDbgFuncNode = NULL;
+
+    // A callback is created in every driver, so any driver instance which was deferred must exist first
+    res = loader_create_deferred_icd_instances(inst);
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
 
     icd_info = ((VkDebugReportCallbackEXT *)loader_calloc_with_instance_fallback(
         pAllocator, inst, inst->total_icd_count * sizeof(VkDebugReportCallbackEXT), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
@@ -456,23 +599,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugReportCallbackEXT(VkInstanc
     // Setup the debug report callback in the terminator since a layer may want
     // to grab the information itself (RenderDoc) and then return back to the
     // user callback a sub-set of the messages.
-    pNewDbgFuncNode = (VkLayerDbgFunctionNode *)loader_calloc_with_instance_fallback(
-        pAllocator, inst, sizeof(VkLayerDbgFunctionNode), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
-
-    if (!pNewDbgFuncNode) {
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
-    }
-
-    pNewDbgFuncNode->is_messenger = false;
-    pNewDbgFuncNode->report.pfnMsgCallback = pCreateInfo->pfnCallback;
-    pNewDbgFuncNode->report.msgFlags = pCreateInfo->flags;
-    pNewDbgFuncNode->pUserData = pCreateInfo->pUserData;
-    pNewDbgFuncNode->pNext = inst->DbgFunctionHead;
-    inst->DbgFunctionHead = pNewDbgFuncNode;
-
     *(VkDebugReportCallbackEXT **)pCallback = icd_info;
-    pNewDbgFuncNode->report.msgCallback = *pCallback;
+    res = util_CreateDebugReportCallback(inst, pCreateInfo, *pCallback);
 
 out:
 
@@ -489,7 +617,6 @@ out:
             }
             storage_idx++;
         }
-        loader_free_with_instance_fallback(pAllocator, inst, pNewDbgFuncNode);
         loader_free_with_instance_fallback(pAllocator, inst, icd_info);
     }
 
@@ -517,7 +644,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyDebugReportCallbackEXT(VkInstance i
         storage_idx++;
     }
 
-    util_DestroyDebugReportCallback(inst, callback, pAllocator);
+    util_DestroyDebugReportCallback(inst, callback);
 
     loader_free_with_instance_fallback(pAllocator, inst, icd_info);
 }
@@ -537,13 +664,12 @@ VKAPI_ATTR void VKAPI_CALL terminator_DebugReportMessageEXT(VkInstance instance,
                                                      pMsg);
         }
     }
+    loader_platform_thread_unlock_mutex(&loader_lock);
 
     // Now that all ICDs have seen the message, call the necessary callbacks.  Ignoring "bail" return value
     // as there is nothing to bail from at this point.
 
     util_DebugReportMessage(inst, flags, objType, object, location, msgCode, pLayerPrefix, pMsg);
-
-    loader_platform_thread_unlock_mutex(&loader_lock);
 }
 
 // General utilities
@@ -553,15 +679,29 @@ static const VkExtensionProperties debug_utils_extension_info[] = {
     {VK_EXT_DEBUG_UTILS_EXTENSION_NAME, VK_EXT_DEBUG_UTILS_SPEC_VERSION},
 };
 
-void destroy_debug_callbacks_chain(struct loader_instance *inst, const VkAllocationCallbacks *pAllocator) {
-    VkLayerDbgFunctionNode *pTrav = inst->DbgFunctionHead;
-    VkLayerDbgFunctionNode *pNext = NULL;
-    while (pTrav) {
-        pNext = pTrav->pNext;
-        loader_free_with_instance_fallback(pAllocator, inst, pTrav);
-        pTrav = pNext;
-    }
-    inst->DbgFunctionHead = NULL;
+// Only called during instance creation and destruction, when no other thread may use the instance
+void destroy_debug_callbacks_chain(struct loader_instance *inst) {
+    loader_platform_thread_lock_mutex(&loader_debug_callback_lock);
+    debug_callbacks_free(inst, inst->retired_debug_callbacks);
+    inst->retired_debug_callbacks = NULL;
+    debug_callbacks_free(inst, inst->debug_callbacks);
+    loader_platform_atomic_store_ptr((void *volatile *)&inst->debug_callbacks, NULL);
+    loader_platform_thread_unlock_mutex(&loader_debug_callback_lock);
+}
+
+void stash_instance_creation_debug_callbacks(struct loader_instance *inst) {
+    loader_platform_thread_lock_mutex(&loader_debug_callback_lock);
+    inst->instance_creation_debug_callbacks = inst->debug_callbacks;
+    loader_platform_atomic_store_ptr((void *volatile *)&inst->debug_callbacks, NULL);
+    loader_platform_thread_unlock_mutex(&loader_debug_callback_lock);
+}
+
+// Must be called after destroy_debug_callbacks_chain
+void restore_instance_creation_debug_callbacks(struct loader_instance *inst) {
+    loader_platform_thread_lock_mutex(&loader_debug_callback_lock);
+    loader_platform_atomic_store_ptr((void *volatile *)&inst->debug_callbacks, inst->instance_creation_debug_callbacks);
+    inst->instance_creation_debug_callbacks = NULL;
+    loader_platform_thread_unlock_mutex(&loader_debug_callback_lock);
 }
 
 void add_debug_extensions_to_ext_list(const struct loader_instance *inst, struct loader_extension_list *ext_list) {
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "driver_timeout.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "allocation.h"
+#include "loader.h"
+#include "loader_environment.h"
+#include "log.h"
+
+// Longest time the waiting thread sleeps between checks for the driver call having returned
+#define DRIVER_CALL_MAX_POLL_INTERVAL_US 1000
+
+void loader_get_driver_budget(const struct loader_instance *inst, struct loader_driver_budget *budget) {
+    budget->timeout_us = 0;
+    budget->library_load_abandoned = false;
+    char *env_value = loader_getenv("VK_LOADER_DRIVER_TIMEOUT_MS", inst);
+    if (NULL != env_value && atoi(env_value) > 0) {
+        budget->timeout_us = (uint64_t)atoi(env_value) * 1000;
+    }
+    loader_free_getenv(env_value, inst);
+
+    // Writing to a file named by the environment isn't something a process with elevated privileges should do
+    budget->quarantine_file = loader_secure_getenv("VK_LOADER_DRIVER_QUARANTINE_FILE", inst);
+    if (NULL != budget->quarantine_file && '\0' == budget->quarantine_file[0]) {
+        loader_free_getenv(budget->quarantine_file, inst);
+        budget->quarantine_file = NULL;
+    }
+}
+
+void loader_free_driver_budget(const struct loader_instance *inst, struct loader_driver_budget *budget) {
+    loader_free_getenv(budget->quarantine_file, inst);
+    budget->quarantine_file = NULL;
+}
+
+// Shared between the thread calling into the driver and the thread waiting on it. Whichever of them is last to be done with it
+// frees it, which is the calling thread when the call is abandoned.
+struct loader_driver_call {
+    loader_platform_thread_mutex lock;
+    bool complete;
+    bool abandoned;
+    void (*func)(void *data);
+    void (*free_data)(void *data);
+    void *data;
+};
+
+static LOADER_PLATFORM_THREAD_PROC(loader_driver_call_thread, arg) {
+    struct loader_driver_call *call = (struct loader_driver_call *)arg;
+    call->func(call->data);
+
+    loader_platform_thread_lock_mutex(&call->lock);
+    call->complete = true;
+    bool abandoned = call->abandoned;
+    loader_platform_thread_unlock_mutex(&call->lock);
+
+    if (abandoned) {
+        call->free_data(call->data);
+        loader_platform_thread_delete_mutex(&call->lock);
+        loader_free(NULL, call);
+    }
+    return 0;
+}
+
+bool loader_call_driver_with_budget(const struct loader_instance *inst, const struct loader_driver_budget *budget,
+                                    void (*func)(void *data), void (*free_data)(void *data), void *data) {
+    if (0 == budget->timeout_us) {
+        func(data);
+        return true;
+    }
+
+    // Allocated from the system rather than the instance, as an abandoned call can outlive the instance
+    struct loader_driver_call *call = loader_calloc(NULL, sizeof(struct loader_driver_call), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == call) {
+        func(data);
+        return true;
+    }
+    call->func = func;
+    call->free_data = free_data;
+    call->data = data;
+    loader_platform_thread_create_mutex(&call->lock);
+
+    loader_platform_thread thread;
+    if (!loader_platform_thread_create(&thread, loader_driver_call_thread, call)) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_call_driver_with_budget: Failed to start a thread to call the driver on, calling it without a time "
+                   "limit");
+        loader_platform_thread_delete_mutex(&call->lock);
+        loader_free(NULL, call);
+        func(data);
+        return true;
+    }
+
+    // Drivers usually return quickly, so start with short sleeps and back off to longer ones
+    uint64_t start_time = loader_platform_get_time_us();
+    uint64_t poll_interval_us = 10;
+    while (true) {
+        uint64_t elapsed_us = loader_platform_get_time_us() - start_time;
+
+        loader_platform_thread_lock_mutex(&call->lock);
+        bool complete = call->complete;
+        if (!complete && elapsed_us >= budget->timeout_us) {
+            call->abandoned = true;
+        }
+        loader_platform_thread_unlock_mutex(&call->lock);
+
+        if (complete) {
+            loader_platform_thread_join(thread);
+            loader_platform_thread_delete_mutex(&call->lock);
+            loader_free(NULL, call);
+            return true;
+        }
+        if (elapsed_us >= budget->timeout_us) {
+            // call now belongs to the thread, which may already have freed it
+            loader_platform_thread_detach(thread);
+            return false;
+        }
+
+        uint64_t remaining_us = budget->timeout_us - elapsed_us;
+        loader_platform_sleep_us(poll_interval_us < remaining_us ? poll_interval_us : remaining_us);
+        if (poll_interval_us < DRIVER_CALL_MAX_POLL_INTERVAL_US) {
+            poll_interval_us *= 2;
+        }
+    }
+}
+
+// The driver libraries whose load or vkCreateInstance exceeded the timeout in this process, guarded by
+// loader_timed_out_driver_lock. Abandoned calls may still be running in them, and without a quarantine file they would
+// otherwise be waited on for the whole timeout by every scan.
+struct loader_timed_out_driver {
+    struct loader_timed_out_driver *next;
+    char *lib_name;
+};
+static struct loader_timed_out_driver *timed_out_drivers;
+
+static bool loader_driver_timed_out_in_process(const char *lib_name) {
+    bool timed_out = false;
+    loader_platform_thread_lock_mutex(&loader_timed_out_driver_lock);
+    for (struct loader_timed_out_driver *driver = timed_out_drivers; NULL != driver && !timed_out; driver = driver->next) {
+        timed_out = 0 == strcmp(driver->lib_name, lib_name);
+    }
+    loader_platform_thread_unlock_mutex(&loader_timed_out_driver_lock);
+    return timed_out;
+}
+
+static void loader_add_timed_out_driver(const struct loader_instance *inst, const char *lib_name) {
+    if (loader_driver_timed_out_in_process(lib_name)) {
+        return;
+    }
+    // Allocated from the system rather than the instance, as it outlives the instance
+    struct loader_timed_out_driver *driver =
+        loader_alloc(NULL, sizeof(struct loader_timed_out_driver) + strlen(lib_name) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == driver) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "Out of memory, driver \"%s\" will be waited on again by later instances", lib_name);
+        return;
+    }
+    driver->lib_name = (char *)(driver + 1);
+    strcpy(driver->lib_name, lib_name);
+    loader_platform_thread_lock_mutex(&loader_timed_out_driver_lock);
+    driver->next = timed_out_drivers;
+    timed_out_drivers = driver;
+    loader_platform_thread_unlock_mutex(&loader_timed_out_driver_lock);
+}
+
+void loader_clear_timed_out_drivers(void) {
+    while (NULL != timed_out_drivers) {
+        struct loader_timed_out_driver *next = timed_out_drivers->next;
+        loader_free(NULL, timed_out_drivers);
+        timed_out_drivers = next;
+    }
+}
+
+// Replacing or rebuilding a library lifts its quarantine. Libraries which are found through the system search path rather than
+// by a path can't be looked at, and are identified by their name alone.
+void loader_get_library_identity(const char *lib_name, uint64_t *size, int64_t *modification_time) {
+    *size = 0;
+    *modification_time = 0;
+#if defined(_WIN32)
+    struct _stat64 lib_stat;
+    if (0 == _stat64(lib_name, &lib_stat)) {
+#else
+    struct stat lib_stat;
+    if (0 == stat(lib_name, &lib_stat)) {
+#endif
+        *size = (uint64_t)lib_stat.st_size;
+        *modification_time = (int64_t)lib_stat.st_mtime;
+    }
+}
+
+// Each line of the quarantine file is "<size> <modification time> <library>"
+bool loader_driver_is_quarantined(const struct loader_instance *inst, const struct loader_driver_budget *budget,
+                                  const char *lib_name) {
+    if (loader_driver_timed_out_in_process(lib_name)) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "Driver \"%s\" ignored because it exceeded VK_LOADER_DRIVER_TIMEOUT_MS earlier in this process", lib_name);
+        return true;
+    }
+    if (NULL == budget->quarantine_file) {
+        return false;
+    }
+    FILE *file = fopen(budget->quarantine_file, "r");
+    if (NULL == file) {
+        // Nothing has been quarantined yet
+        return false;
+    }
+
+    uint64_t size;
+    int64_t modification_time;
+    loader_get_library_identity(lib_name, &size, &modification_time);
+
+    bool quarantined = false;
+    char line[MAX_STRING_SIZE + 64];
+    while (!quarantined && NULL != fgets(line, sizeof(line), file)) {
+        size_t length = strlen(line);
+        if (length > 0 && '\n' == line[length - 1]) {
+            line[--length] = '\0';
+        }
+        if (length > 0 && '\r' == line[length - 1]) {
+            line[--length] = '\0';
+        }
+        char *next = NULL;
+        uint64_t line_size = (uint64_t)strtoull(line, &next, 10);
+        if (next == line || ' ' != *next) {
+            continue;
+        }
+        char *time_start = next + 1;
+        int64_t line_modification_time = (int64_t)strtoll(time_start, &next, 10);
+        if (next == time_start || ' ' != *next) {
+            continue;
+        }
+        quarantined = line_size == size && line_modification_time == modification_time && 0 == strcmp(next + 1, lib_name);
+    }
+    fclose(file);
+
+    if (quarantined) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "Driver \"%s\" ignored because it is quarantined by \'%s\' for exceeding VK_LOADER_DRIVER_TIMEOUT_MS", lib_name,
+                   budget->quarantine_file);
+    }
+    return quarantined;
+}
+
+void loader_quarantine_driver(const struct loader_instance *inst, const struct loader_driver_budget *budget, const char *lib_name) {
+    loader_add_timed_out_driver(inst, lib_name);
+    if (NULL == budget->quarantine_file) {
+        return;
+    }
+    uint64_t size;
+    int64_t modification_time;
+    loader_get_library_identity(lib_name, &size, &modification_time);
+
+    // Appending keeps entries written by other processes at the same time intact
+    FILE *file = fopen(budget->quarantine_file, "a");
+    bool written = NULL != file && fprintf(file, "%" PRIu64 " %" PRId64 " %s\n", size, modification_time, lib_name) > 0;
+    if (NULL != file && 0 != fclose(file)) {
+        written = false;
+    }
+    if (written) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "Driver \"%s\" quarantined by \'%s\', later processes skip it until the library changes", lib_name,
+                   budget->quarantine_file);
+    } else {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "Failed to quarantine driver \"%s\" in \'%s\'",
+                   lib_name, budget->quarantine_file);
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "loader_common.h"
+
+// How long each driver may take to load and to create an instance, set by VK_LOADER_DRIVER_TIMEOUT_MS, along with the file
+// which drivers exceeding it are recorded in, set by VK_LOADER_DRIVER_QUARANTINE_FILE. Either may be unset.
+struct loader_driver_budget {
+    uint64_t timeout_us;
+    char *quarantine_file;
+    // Set once a driver library is abandoned while opening. It may still be running its constructors, during which the C library
+    // keeps any other library from being opened, so the drivers after it would time out through no fault of their own.
+    bool library_load_abandoned;
+};
+
+void loader_get_driver_budget(const struct loader_instance *inst, struct loader_driver_budget *budget);
+void loader_free_driver_budget(const struct loader_instance *inst, struct loader_driver_budget *budget);
+
+// Runs func(data) on a separate thread when a timeout is set, and waits at most the timeout for it to return. Returns false if
+// it didn't, in which case the call is abandoned: it keeps running, and the thread calls free_data(data) once func returns, so
+// data must not be used or freed by the caller, and must not point to anything the caller may free. Otherwise the caller still
+// owns data. Without a timeout, or if a thread can't be started, func is called directly.
+bool loader_call_driver_with_budget(const struct loader_instance *inst, const struct loader_driver_budget *budget,
+                                    void (*func)(void *data), void (*free_data)(void *data), void *data);
+
+// Whether the driver library lib_name exceeded the timeout earlier in this process, or was recorded in the quarantine file and
+// hasn't changed since it was
+bool loader_driver_is_quarantined(const struct loader_instance *inst, const struct loader_driver_budget *budget,
+                                  const char *lib_name);
+
+// Records that the driver library lib_name exceeded the timeout, so that later scans in this process skip it, and in the
+// quarantine file, if one is set, so that later processes skip it too
+void loader_quarantine_driver(const struct loader_instance *inst, const struct loader_driver_budget *budget, const char *lib_name);
+
+// Identifies the contents of a library by its size and modification time, both 0 when it can't be looked at
+void loader_get_library_identity(const char *lib_name, uint64_t *size, int64_t *modification_time);
+
+// Forgets the drivers which exceeded the timeout in this process, only called when the loader is released
+void loader_clear_timed_out_drivers(void);
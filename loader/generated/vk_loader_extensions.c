@@ -1407,1060 +1407,1431 @@ void init_extension_device_proc_terminator_dispatch(struct loader_device *dev) {
 #endif // None
 }
 
-// Device command lookup function
-VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-    name += 2;
-
-    // ---- Core 1_0 commands
-    if (!strcmp(name, "GetDeviceProcAddr")) return (void *)table->GetDeviceProcAddr;
-    if (!strcmp(name, "DestroyDevice")) return (void *)table->DestroyDevice;
-    if (!strcmp(name, "GetDeviceQueue")) return (void *)table->GetDeviceQueue;
-    if (!strcmp(name, "QueueSubmit")) return (void *)table->QueueSubmit;
-    if (!strcmp(name, "QueueWaitIdle")) return (void *)table->QueueWaitIdle;
-    if (!strcmp(name, "DeviceWaitIdle")) return (void *)table->DeviceWaitIdle;
-    if (!strcmp(name, "AllocateMemory")) return (void *)table->AllocateMemory;
-    if (!strcmp(name, "FreeMemory")) return (void *)table->FreeMemory;
-    if (!strcmp(name, "MapMemory")) return (void *)table->MapMemory;
-    if (!strcmp(name, "UnmapMemory")) return (void *)table->UnmapMemory;
-    if (!strcmp(name, "FlushMappedMemoryRanges")) return (void *)table->FlushMappedMemoryRanges;
-    if (!strcmp(name, "InvalidateMappedMemoryRanges")) return (void *)table->InvalidateMappedMemoryRanges;
-    if (!strcmp(name, "GetDeviceMemoryCommitment")) return (void *)table->GetDeviceMemoryCommitment;
-    if (!strcmp(name, "BindBufferMemory")) return (void *)table->BindBufferMemory;
-    if (!strcmp(name, "BindImageMemory")) return (void *)table->BindImageMemory;
-    if (!strcmp(name, "GetBufferMemoryRequirements")) return (void *)table->GetBufferMemoryRequirements;
-    if (!strcmp(name, "GetImageMemoryRequirements")) return (void *)table->GetImageMemoryRequirements;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements")) return (void *)table->GetImageSparseMemoryRequirements;
-    if (!strcmp(name, "QueueBindSparse")) return (void *)table->QueueBindSparse;
-    if (!strcmp(name, "CreateFence")) return (void *)table->CreateFence;
-    if (!strcmp(name, "DestroyFence")) return (void *)table->DestroyFence;
-    if (!strcmp(name, "ResetFences")) return (void *)table->ResetFences;
-    if (!strcmp(name, "GetFenceStatus")) return (void *)table->GetFenceStatus;
-    if (!strcmp(name, "WaitForFences")) return (void *)table->WaitForFences;
-    if (!strcmp(name, "CreateSemaphore")) return (void *)table->CreateSemaphore;
-    if (!strcmp(name, "DestroySemaphore")) return (void *)table->DestroySemaphore;
-    if (!strcmp(name, "CreateEvent")) return (void *)table->CreateEvent;
-    if (!strcmp(name, "DestroyEvent")) return (void *)table->DestroyEvent;
-    if (!strcmp(name, "GetEventStatus")) return (void *)table->GetEventStatus;
-    if (!strcmp(name, "SetEvent")) return (void *)table->SetEvent;
-    if (!strcmp(name, "ResetEvent")) return (void *)table->ResetEvent;
-    if (!strcmp(name, "CreateQueryPool")) return (void *)table->CreateQueryPool;
-    if (!strcmp(name, "DestroyQueryPool")) return (void *)table->DestroyQueryPool;
-    if (!strcmp(name, "GetQueryPoolResults")) return (void *)table->GetQueryPoolResults;
-    if (!strcmp(name, "CreateBuffer")) return (void *)table->CreateBuffer;
-    if (!strcmp(name, "DestroyBuffer")) return (void *)table->DestroyBuffer;
-    if (!strcmp(name, "CreateBufferView")) return (void *)table->CreateBufferView;
-    if (!strcmp(name, "DestroyBufferView")) return (void *)table->DestroyBufferView;
-    if (!strcmp(name, "CreateImage")) return (void *)table->CreateImage;
-    if (!strcmp(name, "DestroyImage")) return (void *)table->DestroyImage;
-    if (!strcmp(name, "GetImageSubresourceLayout")) return (void *)table->GetImageSubresourceLayout;
-    if (!strcmp(name, "CreateImageView")) return (void *)table->CreateImageView;
-    if (!strcmp(name, "DestroyImageView")) return (void *)table->DestroyImageView;
-    if (!strcmp(name, "CreateShaderModule")) return (void *)table->CreateShaderModule;
-    if (!strcmp(name, "DestroyShaderModule")) return (void *)table->DestroyShaderModule;
-    if (!strcmp(name, "CreatePipelineCache")) return (void *)table->CreatePipelineCache;
-    if (!strcmp(name, "DestroyPipelineCache")) return (void *)table->DestroyPipelineCache;
-    if (!strcmp(name, "GetPipelineCacheData")) return (void *)table->GetPipelineCacheData;
-    if (!strcmp(name, "MergePipelineCaches")) return (void *)table->MergePipelineCaches;
-    if (!strcmp(name, "CreateGraphicsPipelines")) return (void *)table->CreateGraphicsPipelines;
-    if (!strcmp(name, "CreateComputePipelines")) return (void *)table->CreateComputePipelines;
-    if (!strcmp(name, "DestroyPipeline")) return (void *)table->DestroyPipeline;
-    if (!strcmp(name, "CreatePipelineLayout")) return (void *)table->CreatePipelineLayout;
-    if (!strcmp(name, "DestroyPipelineLayout")) return (void *)table->DestroyPipelineLayout;
-    if (!strcmp(name, "CreateSampler")) return (void *)table->CreateSampler;
-    if (!strcmp(name, "DestroySampler")) return (void *)table->DestroySampler;
-    if (!strcmp(name, "CreateDescriptorSetLayout")) return (void *)table->CreateDescriptorSetLayout;
-    if (!strcmp(name, "DestroyDescriptorSetLayout")) return (void *)table->DestroyDescriptorSetLayout;
-    if (!strcmp(name, "CreateDescriptorPool")) return (void *)table->CreateDescriptorPool;
-    if (!strcmp(name, "DestroyDescriptorPool")) return (void *)table->DestroyDescriptorPool;
-    if (!strcmp(name, "ResetDescriptorPool")) return (void *)table->ResetDescriptorPool;
-    if (!strcmp(name, "AllocateDescriptorSets")) return (void *)table->AllocateDescriptorSets;
-    if (!strcmp(name, "FreeDescriptorSets")) return (void *)table->FreeDescriptorSets;
-    if (!strcmp(name, "UpdateDescriptorSets")) return (void *)table->UpdateDescriptorSets;
-    if (!strcmp(name, "CreateFramebuffer")) return (void *)table->CreateFramebuffer;
-    if (!strcmp(name, "DestroyFramebuffer")) return (void *)table->DestroyFramebuffer;
-    if (!strcmp(name, "CreateRenderPass")) return (void *)table->CreateRenderPass;
-    if (!strcmp(name, "DestroyRenderPass")) return (void *)table->DestroyRenderPass;
-    if (!strcmp(name, "GetRenderAreaGranularity")) return (void *)table->GetRenderAreaGranularity;
-    if (!strcmp(name, "CreateCommandPool")) return (void *)table->CreateCommandPool;
-    if (!strcmp(name, "DestroyCommandPool")) return (void *)table->DestroyCommandPool;
-    if (!strcmp(name, "ResetCommandPool")) return (void *)table->ResetCommandPool;
-    if (!strcmp(name, "AllocateCommandBuffers")) return (void *)table->AllocateCommandBuffers;
-    if (!strcmp(name, "FreeCommandBuffers")) return (void *)table->FreeCommandBuffers;
-    if (!strcmp(name, "BeginCommandBuffer")) return (void *)table->BeginCommandBuffer;
-    if (!strcmp(name, "EndCommandBuffer")) return (void *)table->EndCommandBuffer;
-    if (!strcmp(name, "ResetCommandBuffer")) return (void *)table->ResetCommandBuffer;
-    if (!strcmp(name, "CmdBindPipeline")) return (void *)table->CmdBindPipeline;
-    if (!strcmp(name, "CmdSetViewport")) return (void *)table->CmdSetViewport;
-    if (!strcmp(name, "CmdSetScissor")) return (void *)table->CmdSetScissor;
-    if (!strcmp(name, "CmdSetLineWidth")) return (void *)table->CmdSetLineWidth;
-    if (!strcmp(name, "CmdSetDepthBias")) return (void *)table->CmdSetDepthBias;
-    if (!strcmp(name, "CmdSetBlendConstants")) return (void *)table->CmdSetBlendConstants;
-    if (!strcmp(name, "CmdSetDepthBounds")) return (void *)table->CmdSetDepthBounds;
-    if (!strcmp(name, "CmdSetStencilCompareMask")) return (void *)table->CmdSetStencilCompareMask;
-    if (!strcmp(name, "CmdSetStencilWriteMask")) return (void *)table->CmdSetStencilWriteMask;
-    if (!strcmp(name, "CmdSetStencilReference")) return (void *)table->CmdSetStencilReference;
-    if (!strcmp(name, "CmdBindDescriptorSets")) return (void *)table->CmdBindDescriptorSets;
-    if (!strcmp(name, "CmdBindIndexBuffer")) return (void *)table->CmdBindIndexBuffer;
-    if (!strcmp(name, "CmdBindVertexBuffers")) return (void *)table->CmdBindVertexBuffers;
-    if (!strcmp(name, "CmdDraw")) return (void *)table->CmdDraw;
-    if (!strcmp(name, "CmdDrawIndexed")) return (void *)table->CmdDrawIndexed;
-    if (!strcmp(name, "CmdDrawIndirect")) return (void *)table->CmdDrawIndirect;
-    if (!strcmp(name, "CmdDrawIndexedIndirect")) return (void *)table->CmdDrawIndexedIndirect;
-    if (!strcmp(name, "CmdDispatch")) return (void *)table->CmdDispatch;
-    if (!strcmp(name, "CmdDispatchIndirect")) return (void *)table->CmdDispatchIndirect;
-    if (!strcmp(name, "CmdCopyBuffer")) return (void *)table->CmdCopyBuffer;
-    if (!strcmp(name, "CmdCopyImage")) return (void *)table->CmdCopyImage;
-    if (!strcmp(name, "CmdBlitImage")) return (void *)table->CmdBlitImage;
-    if (!strcmp(name, "CmdCopyBufferToImage")) return (void *)table->CmdCopyBufferToImage;
-    if (!strcmp(name, "CmdCopyImageToBuffer")) return (void *)table->CmdCopyImageToBuffer;
-    if (!strcmp(name, "CmdUpdateBuffer")) return (void *)table->CmdUpdateBuffer;
-    if (!strcmp(name, "CmdFillBuffer")) return (void *)table->CmdFillBuffer;
-    if (!strcmp(name, "CmdClearColorImage")) return (void *)table->CmdClearColorImage;
-    if (!strcmp(name, "CmdClearDepthStencilImage")) return (void *)table->CmdClearDepthStencilImage;
-    if (!strcmp(name, "CmdClearAttachments")) return (void *)table->CmdClearAttachments;
-    if (!strcmp(name, "CmdResolveImage")) return (void *)table->CmdResolveImage;
-    if (!strcmp(name, "CmdSetEvent")) return (void *)table->CmdSetEvent;
-    if (!strcmp(name, "CmdResetEvent")) return (void *)table->CmdResetEvent;
-    if (!strcmp(name, "CmdWaitEvents")) return (void *)table->CmdWaitEvents;
-    if (!strcmp(name, "CmdPipelineBarrier")) return (void *)table->CmdPipelineBarrier;
-    if (!strcmp(name, "CmdBeginQuery")) return (void *)table->CmdBeginQuery;
-    if (!strcmp(name, "CmdEndQuery")) return (void *)table->CmdEndQuery;
-    if (!strcmp(name, "CmdResetQueryPool")) return (void *)table->CmdResetQueryPool;
-    if (!strcmp(name, "CmdWriteTimestamp")) return (void *)table->CmdWriteTimestamp;
-    if (!strcmp(name, "CmdCopyQueryPoolResults")) return (void *)table->CmdCopyQueryPoolResults;
-    if (!strcmp(name, "CmdPushConstants")) return (void *)table->CmdPushConstants;
-    if (!strcmp(name, "CmdBeginRenderPass")) return (void *)table->CmdBeginRenderPass;
-    if (!strcmp(name, "CmdNextSubpass")) return (void *)table->CmdNextSubpass;
-    if (!strcmp(name, "CmdEndRenderPass")) return (void *)table->CmdEndRenderPass;
-    if (!strcmp(name, "CmdExecuteCommands")) return (void *)table->CmdExecuteCommands;
-
-    // ---- Core 1_1 commands
-    if (!strcmp(name, "BindBufferMemory2")) return (void *)table->BindBufferMemory2;
-    if (!strcmp(name, "BindImageMemory2")) return (void *)table->BindImageMemory2;
-    if (!strcmp(name, "GetDeviceGroupPeerMemoryFeatures")) return (void *)table->GetDeviceGroupPeerMemoryFeatures;
-    if (!strcmp(name, "CmdSetDeviceMask")) return (void *)table->CmdSetDeviceMask;
-    if (!strcmp(name, "CmdDispatchBase")) return (void *)table->CmdDispatchBase;
-    if (!strcmp(name, "GetImageMemoryRequirements2")) return (void *)table->GetImageMemoryRequirements2;
-    if (!strcmp(name, "GetBufferMemoryRequirements2")) return (void *)table->GetBufferMemoryRequirements2;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements2")) return (void *)table->GetImageSparseMemoryRequirements2;
-    if (!strcmp(name, "TrimCommandPool")) return (void *)table->TrimCommandPool;
-    if (!strcmp(name, "GetDeviceQueue2")) return (void *)table->GetDeviceQueue2;
-    if (!strcmp(name, "CreateSamplerYcbcrConversion")) return (void *)table->CreateSamplerYcbcrConversion;
-    if (!strcmp(name, "DestroySamplerYcbcrConversion")) return (void *)table->DestroySamplerYcbcrConversion;
-    if (!strcmp(name, "CreateDescriptorUpdateTemplate")) return (void *)table->CreateDescriptorUpdateTemplate;
-    if (!strcmp(name, "DestroyDescriptorUpdateTemplate")) return (void *)table->DestroyDescriptorUpdateTemplate;
-    if (!strcmp(name, "UpdateDescriptorSetWithTemplate")) return (void *)table->UpdateDescriptorSetWithTemplate;
-    if (!strcmp(name, "GetDescriptorSetLayoutSupport")) return (void *)table->GetDescriptorSetLayoutSupport;
-
-    // ---- Core 1_2 commands
-    if (!strcmp(name, "CmdDrawIndirectCount")) return (void *)table->CmdDrawIndirectCount;
-    if (!strcmp(name, "CmdDrawIndexedIndirectCount")) return (void *)table->CmdDrawIndexedIndirectCount;
-    if (!strcmp(name, "CreateRenderPass2")) return (void *)table->CreateRenderPass2;
-    if (!strcmp(name, "CmdBeginRenderPass2")) return (void *)table->CmdBeginRenderPass2;
-    if (!strcmp(name, "CmdNextSubpass2")) return (void *)table->CmdNextSubpass2;
-    if (!strcmp(name, "CmdEndRenderPass2")) return (void *)table->CmdEndRenderPass2;
-    if (!strcmp(name, "ResetQueryPool")) return (void *)table->ResetQueryPool;
-    if (!strcmp(name, "GetSemaphoreCounterValue")) return (void *)table->GetSemaphoreCounterValue;
-    if (!strcmp(name, "WaitSemaphores")) return (void *)table->WaitSemaphores;
-    if (!strcmp(name, "SignalSemaphore")) return (void *)table->SignalSemaphore;
-    if (!strcmp(name, "GetBufferDeviceAddress")) return (void *)table->GetBufferDeviceAddress;
-    if (!strcmp(name, "GetBufferOpaqueCaptureAddress")) return (void *)table->GetBufferOpaqueCaptureAddress;
-    if (!strcmp(name, "GetDeviceMemoryOpaqueCaptureAddress")) return (void *)table->GetDeviceMemoryOpaqueCaptureAddress;
-
-    // ---- Core 1_3 commands
-    if (!strcmp(name, "CreatePrivateDataSlot")) return (void *)table->CreatePrivateDataSlot;
-    if (!strcmp(name, "DestroyPrivateDataSlot")) return (void *)table->DestroyPrivateDataSlot;
-    if (!strcmp(name, "SetPrivateData")) return (void *)table->SetPrivateData;
-    if (!strcmp(name, "GetPrivateData")) return (void *)table->GetPrivateData;
-    if (!strcmp(name, "CmdSetEvent2")) return (void *)table->CmdSetEvent2;
-    if (!strcmp(name, "CmdResetEvent2")) return (void *)table->CmdResetEvent2;
-    if (!strcmp(name, "CmdWaitEvents2")) return (void *)table->CmdWaitEvents2;
-    if (!strcmp(name, "CmdPipelineBarrier2")) return (void *)table->CmdPipelineBarrier2;
-    if (!strcmp(name, "CmdWriteTimestamp2")) return (void *)table->CmdWriteTimestamp2;
-    if (!strcmp(name, "QueueSubmit2")) return (void *)table->QueueSubmit2;
-    if (!strcmp(name, "CmdCopyBuffer2")) return (void *)table->CmdCopyBuffer2;
-    if (!strcmp(name, "CmdCopyImage2")) return (void *)table->CmdCopyImage2;
-    if (!strcmp(name, "CmdCopyBufferToImage2")) return (void *)table->CmdCopyBufferToImage2;
-    if (!strcmp(name, "CmdCopyImageToBuffer2")) return (void *)table->CmdCopyImageToBuffer2;
-    if (!strcmp(name, "CmdBlitImage2")) return (void *)table->CmdBlitImage2;
-    if (!strcmp(name, "CmdResolveImage2")) return (void *)table->CmdResolveImage2;
-    if (!strcmp(name, "CmdBeginRendering")) return (void *)table->CmdBeginRendering;
-    if (!strcmp(name, "CmdEndRendering")) return (void *)table->CmdEndRendering;
-    if (!strcmp(name, "CmdSetCullMode")) return (void *)table->CmdSetCullMode;
-    if (!strcmp(name, "CmdSetFrontFace")) return (void *)table->CmdSetFrontFace;
-    if (!strcmp(name, "CmdSetPrimitiveTopology")) return (void *)table->CmdSetPrimitiveTopology;
-    if (!strcmp(name, "CmdSetViewportWithCount")) return (void *)table->CmdSetViewportWithCount;
-    if (!strcmp(name, "CmdSetScissorWithCount")) return (void *)table->CmdSetScissorWithCount;
-    if (!strcmp(name, "CmdBindVertexBuffers2")) return (void *)table->CmdBindVertexBuffers2;
-    if (!strcmp(name, "CmdSetDepthTestEnable")) return (void *)table->CmdSetDepthTestEnable;
-    if (!strcmp(name, "CmdSetDepthWriteEnable")) return (void *)table->CmdSetDepthWriteEnable;
-    if (!strcmp(name, "CmdSetDepthCompareOp")) return (void *)table->CmdSetDepthCompareOp;
-    if (!strcmp(name, "CmdSetDepthBoundsTestEnable")) return (void *)table->CmdSetDepthBoundsTestEnable;
-    if (!strcmp(name, "CmdSetStencilTestEnable")) return (void *)table->CmdSetStencilTestEnable;
-    if (!strcmp(name, "CmdSetStencilOp")) return (void *)table->CmdSetStencilOp;
-    if (!strcmp(name, "CmdSetRasterizerDiscardEnable")) return (void *)table->CmdSetRasterizerDiscardEnable;
-    if (!strcmp(name, "CmdSetDepthBiasEnable")) return (void *)table->CmdSetDepthBiasEnable;
-    if (!strcmp(name, "CmdSetPrimitiveRestartEnable")) return (void *)table->CmdSetPrimitiveRestartEnable;
-    if (!strcmp(name, "GetDeviceBufferMemoryRequirements")) return (void *)table->GetDeviceBufferMemoryRequirements;
-    if (!strcmp(name, "GetDeviceImageMemoryRequirements")) return (void *)table->GetDeviceImageMemoryRequirements;
-    if (!strcmp(name, "GetDeviceImageSparseMemoryRequirements")) return (void *)table->GetDeviceImageSparseMemoryRequirements;
-
-    // ---- VK_KHR_swapchain extension commands
-    if (!strcmp(name, "CreateSwapchainKHR")) return (void *)table->CreateSwapchainKHR;
-    if (!strcmp(name, "DestroySwapchainKHR")) return (void *)table->DestroySwapchainKHR;
-    if (!strcmp(name, "GetSwapchainImagesKHR")) return (void *)table->GetSwapchainImagesKHR;
-    if (!strcmp(name, "AcquireNextImageKHR")) return (void *)table->AcquireNextImageKHR;
-    if (!strcmp(name, "QueuePresentKHR")) return (void *)table->QueuePresentKHR;
-    if (!strcmp(name, "GetDeviceGroupPresentCapabilitiesKHR")) return (void *)table->GetDeviceGroupPresentCapabilitiesKHR;
-    if (!strcmp(name, "GetDeviceGroupSurfacePresentModesKHR")) return (void *)table->GetDeviceGroupSurfacePresentModesKHR;
-    if (!strcmp(name, "AcquireNextImage2KHR")) return (void *)table->AcquireNextImage2KHR;
+// The offsets of a command name in the names of a dispatch table, and of its member in the dispatch table
+struct loader_dispatch_table_entry {
+    uint16_t name_offset;
+    uint16_t table_offset;
+};
 
-    // ---- VK_KHR_display_swapchain extension commands
-    if (!strcmp(name, "CreateSharedSwapchainsKHR")) return (void *)table->CreateSharedSwapchainsKHR;
+// Binary searches entries, which are sorted by name, for name. Returns whether it was found, and the function pointer
+// stored in table for it in *function.
+static bool loader_lookup_dispatch_table(const void *table, const char *names, const struct loader_dispatch_table_entry *entries,
+                                         size_t entry_count, const char *name, void **function) {
+    size_t low = 0;
+    size_t high = entry_count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        int comparison = strcmp(name, &names[entries[middle].name_offset]);
+        if (0 == comparison) {
+            PFN_vkVoidFunction entry;
+            memcpy(&entry, (const char *)table + entries[middle].table_offset, sizeof(entry));
+            *function = (void *)entry;
+            return true;
+        }
+        if (comparison < 0) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    *function = NULL;
+    return false;
+}
 
-    // ---- VK_KHR_video_queue extension commands
+// Names of the device commands in VkLayerDispatchTable, without their "vk" prefix
+static const char loader_device_dispatch_table_names[] =
+    "AcquireFullScreenExclusiveModeEXT\0"
+    "AcquireNextImage2KHR\0"
+    "AcquireNextImageKHR\0"
+    "AcquirePerformanceConfigurationINTEL\0"
+    "AcquireProfilingLockKHR\0"
+    "AllocateCommandBuffers\0"
+    "AllocateDescriptorSets\0"
+    "AllocateMemory\0"
+    "BeginCommandBuffer\0"
+    "BindAccelerationStructureMemoryNV\0"
+    "BindBufferMemory\0"
+    "BindBufferMemory2\0"
+    "BindBufferMemory2KHR\0"
+    "BindImageMemory\0"
+    "BindImageMemory2\0"
+    "BindImageMemory2KHR\0"
+    "BindOpticalFlowSessionImageNV\0"
+    "BindVideoSessionMemoryKHR\0"
+    "BuildAccelerationStructuresKHR\0"
+    "BuildMicromapsEXT\0"
+    "CmdBeginConditionalRenderingEXT\0"
+    "CmdBeginDebugUtilsLabelEXT\0"
+    "CmdBeginQuery\0"
+    "CmdBeginQueryIndexedEXT\0"
+    "CmdBeginRenderPass\0"
+    "CmdBeginRenderPass2\0"
+    "CmdBeginRenderPass2KHR\0"
+    "CmdBeginRendering\0"
+    "CmdBeginRenderingKHR\0"
+    "CmdBeginTransformFeedbackEXT\0"
+    "CmdBeginVideoCodingKHR\0"
+    "CmdBindDescriptorBufferEmbeddedSamplersEXT\0"
+    "CmdBindDescriptorBuffersEXT\0"
+    "CmdBindDescriptorSets\0"
+    "CmdBindIndexBuffer\0"
+    "CmdBindInvocationMaskHUAWEI\0"
+    "CmdBindPipeline\0"
+    "CmdBindPipelineShaderGroupNV\0"
+    "CmdBindShadingRateImageNV\0"
+    "CmdBindTransformFeedbackBuffersEXT\0"
+    "CmdBindVertexBuffers\0"
+    "CmdBindVertexBuffers2\0"
+    "CmdBindVertexBuffers2EXT\0"
+    "CmdBlitImage\0"
+    "CmdBlitImage2\0"
+    "CmdBlitImage2KHR\0"
+    "CmdBuildAccelerationStructureNV\0"
+    "CmdBuildAccelerationStructuresIndirectKHR\0"
+    "CmdBuildAccelerationStructuresKHR\0"
+    "CmdBuildMicromapsEXT\0"
+    "CmdClearAttachments\0"
+    "CmdClearColorImage\0"
+    "CmdClearDepthStencilImage\0"
+    "CmdControlVideoCodingKHR\0"
+    "CmdCopyAccelerationStructureKHR\0"
+    "CmdCopyAccelerationStructureNV\0"
+    "CmdCopyAccelerationStructureToMemoryKHR\0"
+    "CmdCopyBuffer\0"
+    "CmdCopyBuffer2\0"
+    "CmdCopyBuffer2KHR\0"
+    "CmdCopyBufferToImage\0"
+    "CmdCopyBufferToImage2\0"
+    "CmdCopyBufferToImage2KHR\0"
+    "CmdCopyImage\0"
+    "CmdCopyImage2\0"
+    "CmdCopyImage2KHR\0"
+    "CmdCopyImageToBuffer\0"
+    "CmdCopyImageToBuffer2\0"
+    "CmdCopyImageToBuffer2KHR\0"
+    "CmdCopyMemoryIndirectNV\0"
+    "CmdCopyMemoryToAccelerationStructureKHR\0"
+    "CmdCopyMemoryToImageIndirectNV\0"
+    "CmdCopyMemoryToMicromapEXT\0"
+    "CmdCopyMicromapEXT\0"
+    "CmdCopyMicromapToMemoryEXT\0"
+    "CmdCopyQueryPoolResults\0"
+    "CmdCuLaunchKernelNVX\0"
+    "CmdDebugMarkerBeginEXT\0"
+    "CmdDebugMarkerEndEXT\0"
+    "CmdDebugMarkerInsertEXT\0"
+    "CmdDecodeVideoKHR\0"
+    "CmdDecompressMemoryIndirectCountNV\0"
+    "CmdDecompressMemoryNV\0"
+    "CmdDispatch\0"
+    "CmdDispatchBase\0"
+    "CmdDispatchBaseKHR\0"
+    "CmdDispatchIndirect\0"
+    "CmdDraw\0"
+    "CmdDrawIndexed\0"
+    "CmdDrawIndexedIndirect\0"
+    "CmdDrawIndexedIndirectCount\0"
+    "CmdDrawIndexedIndirectCountAMD\0"
+    "CmdDrawIndexedIndirectCountKHR\0"
+    "CmdDrawIndirect\0"
+    "CmdDrawIndirectByteCountEXT\0"
+    "CmdDrawIndirectCount\0"
+    "CmdDrawIndirectCountAMD\0"
+    "CmdDrawIndirectCountKHR\0"
+    "CmdDrawMeshTasksEXT\0"
+    "CmdDrawMeshTasksIndirectCountEXT\0"
+    "CmdDrawMeshTasksIndirectCountNV\0"
+    "CmdDrawMeshTasksIndirectEXT\0"
+    "CmdDrawMeshTasksIndirectNV\0"
+    "CmdDrawMeshTasksNV\0"
+    "CmdDrawMultiEXT\0"
+    "CmdDrawMultiIndexedEXT\0"
+    "CmdEncodeVideoKHR\0"
+    "CmdEndConditionalRenderingEXT\0"
+    "CmdEndDebugUtilsLabelEXT\0"
+    "CmdEndQuery\0"
+    "CmdEndQueryIndexedEXT\0"
+    "CmdEndRenderPass\0"
+    "CmdEndRenderPass2\0"
+    "CmdEndRenderPass2KHR\0"
+    "CmdEndRendering\0"
+    "CmdEndRenderingKHR\0"
+    "CmdEndTransformFeedbackEXT\0"
+    "CmdEndVideoCodingKHR\0"
+    "CmdExecuteCommands\0"
+    "CmdExecuteGeneratedCommandsNV\0"
+    "CmdFillBuffer\0"
+    "CmdInsertDebugUtilsLabelEXT\0"
+    "CmdNextSubpass\0"
+    "CmdNextSubpass2\0"
+    "CmdNextSubpass2KHR\0"
+    "CmdOpticalFlowExecuteNV\0"
+    "CmdPipelineBarrier\0"
+    "CmdPipelineBarrier2\0"
+    "CmdPipelineBarrier2KHR\0"
+    "CmdPreprocessGeneratedCommandsNV\0"
+    "CmdPushConstants\0"
+    "CmdPushDescriptorSetKHR\0"
+    "CmdPushDescriptorSetWithTemplateKHR\0"
+    "CmdResetEvent\0"
+    "CmdResetEvent2\0"
+    "CmdResetEvent2KHR\0"
+    "CmdResetQueryPool\0"
+    "CmdResolveImage\0"
+    "CmdResolveImage2\0"
+    "CmdResolveImage2KHR\0"
+    "CmdSetAlphaToCoverageEnableEXT\0"
+    "CmdSetAlphaToOneEnableEXT\0"
+    "CmdSetBlendConstants\0"
+    "CmdSetCheckpointNV\0"
+    "CmdSetCoarseSampleOrderNV\0"
+    "CmdSetColorBlendAdvancedEXT\0"
+    "CmdSetColorBlendEnableEXT\0"
+    "CmdSetColorBlendEquationEXT\0"
+    "CmdSetColorWriteEnableEXT\0"
+    "CmdSetColorWriteMaskEXT\0"
+    "CmdSetConservativeRasterizationModeEXT\0"
+    "CmdSetCoverageModulationModeNV\0"
+    "CmdSetCoverageModulationTableEnableNV\0"
+    "CmdSetCoverageModulationTableNV\0"
+    "CmdSetCoverageReductionModeNV\0"
+    "CmdSetCoverageToColorEnableNV\0"
+    "CmdSetCoverageToColorLocationNV\0"
+    "CmdSetCullMode\0"
+    "CmdSetCullModeEXT\0"
+    "CmdSetDepthBias\0"
+    "CmdSetDepthBiasEnable\0"
+    "CmdSetDepthBiasEnableEXT\0"
+    "CmdSetDepthBounds\0"
+    "CmdSetDepthBoundsTestEnable\0"
+    "CmdSetDepthBoundsTestEnableEXT\0"
+    "CmdSetDepthClampEnableEXT\0"
+    "CmdSetDepthClipEnableEXT\0"
+    "CmdSetDepthClipNegativeOneToOneEXT\0"
+    "CmdSetDepthCompareOp\0"
+    "CmdSetDepthCompareOpEXT\0"
+    "CmdSetDepthTestEnable\0"
+    "CmdSetDepthTestEnableEXT\0"
+    "CmdSetDepthWriteEnable\0"
+    "CmdSetDepthWriteEnableEXT\0"
+    "CmdSetDescriptorBufferOffsetsEXT\0"
+    "CmdSetDeviceMask\0"
+    "CmdSetDeviceMaskKHR\0"
+    "CmdSetDiscardRectangleEXT\0"
+    "CmdSetEvent\0"
+    "CmdSetEvent2\0"
+    "CmdSetEvent2KHR\0"
+    "CmdSetExclusiveScissorNV\0"
+    "CmdSetExtraPrimitiveOverestimationSizeEXT\0"
+    "CmdSetFragmentShadingRateEnumNV\0"
+    "CmdSetFragmentShadingRateKHR\0"
+    "CmdSetFrontFace\0"
+    "CmdSetFrontFaceEXT\0"
+    "CmdSetLineRasterizationModeEXT\0"
+    "CmdSetLineStippleEXT\0"
+    "CmdSetLineStippleEnableEXT\0"
+    "CmdSetLineWidth\0"
+    "CmdSetLogicOpEXT\0"
+    "CmdSetLogicOpEnableEXT\0"
+    "CmdSetPatchControlPointsEXT\0"
+    "CmdSetPerformanceMarkerINTEL\0"
+    "CmdSetPerformanceOverrideINTEL\0"
+    "CmdSetPerformanceStreamMarkerINTEL\0"
+    "CmdSetPolygonModeEXT\0"
+    "CmdSetPrimitiveRestartEnable\0"
+    "CmdSetPrimitiveRestartEnableEXT\0"
+    "CmdSetPrimitiveTopology\0"
+    "CmdSetPrimitiveTopologyEXT\0"
+    "CmdSetProvokingVertexModeEXT\0"
+    "CmdSetRasterizationSamplesEXT\0"
+    "CmdSetRasterizationStreamEXT\0"
+    "CmdSetRasterizerDiscardEnable\0"
+    "CmdSetRasterizerDiscardEnableEXT\0"
+    "CmdSetRayTracingPipelineStackSizeKHR\0"
+    "CmdSetRepresentativeFragmentTestEnableNV\0"
+    "CmdSetSampleLocationsEXT\0"
+    "CmdSetSampleLocationsEnableEXT\0"
+    "CmdSetSampleMaskEXT\0"
+    "CmdSetScissor\0"
+    "CmdSetScissorWithCount\0"
+    "CmdSetScissorWithCountEXT\0"
+    "CmdSetShadingRateImageEnableNV\0"
+    "CmdSetStencilCompareMask\0"
+    "CmdSetStencilOp\0"
+    "CmdSetStencilOpEXT\0"
+    "CmdSetStencilReference\0"
+    "CmdSetStencilTestEnable\0"
+    "CmdSetStencilTestEnableEXT\0"
+    "CmdSetStencilWriteMask\0"
+    "CmdSetTessellationDomainOriginEXT\0"
+    "CmdSetVertexInputEXT\0"
+    "CmdSetViewport\0"
+    "CmdSetViewportShadingRatePaletteNV\0"
+    "CmdSetViewportSwizzleNV\0"
+    "CmdSetViewportWScalingEnableNV\0"
+    "CmdSetViewportWScalingNV\0"
+    "CmdSetViewportWithCount\0"
+    "CmdSetViewportWithCountEXT\0"
+    "CmdSubpassShadingHUAWEI\0"
+    "CmdTraceRaysIndirect2KHR\0"
+    "CmdTraceRaysIndirectKHR\0"
+    "CmdTraceRaysKHR\0"
+    "CmdTraceRaysNV\0"
+    "CmdUpdateBuffer\0"
+    "CmdWaitEvents\0"
+    "CmdWaitEvents2\0"
+    "CmdWaitEvents2KHR\0"
+    "CmdWriteAccelerationStructuresPropertiesKHR\0"
+    "CmdWriteAccelerationStructuresPropertiesNV\0"
+    "CmdWriteBufferMarker2AMD\0"
+    "CmdWriteBufferMarkerAMD\0"
+    "CmdWriteMicromapsPropertiesEXT\0"
+    "CmdWriteTimestamp\0"
+    "CmdWriteTimestamp2\0"
+    "CmdWriteTimestamp2KHR\0"
+    "CompileDeferredNV\0"
+    "CopyAccelerationStructureKHR\0"
+    "CopyAccelerationStructureToMemoryKHR\0"
+    "CopyMemoryToAccelerationStructureKHR\0"
+    "CopyMemoryToMicromapEXT\0"
+    "CopyMicromapEXT\0"
+    "CopyMicromapToMemoryEXT\0"
+    "CreateAccelerationStructureKHR\0"
+    "CreateAccelerationStructureNV\0"
+    "CreateBuffer\0"
+    "CreateBufferCollectionFUCHSIA\0"
+    "CreateBufferView\0"
+    "CreateCommandPool\0"
+    "CreateComputePipelines\0"
+    "CreateCuFunctionNVX\0"
+    "CreateCuModuleNVX\0"
+    "CreateDeferredOperationKHR\0"
+    "CreateDescriptorPool\0"
+    "CreateDescriptorSetLayout\0"
+    "CreateDescriptorUpdateTemplate\0"
+    "CreateDescriptorUpdateTemplateKHR\0"
+    "CreateEvent\0"
+    "CreateFence\0"
+    "CreateFramebuffer\0"
+    "CreateGraphicsPipelines\0"
+    "CreateImage\0"
+    "CreateImageView\0"
+    "CreateIndirectCommandsLayoutNV\0"
+    "CreateMicromapEXT\0"
+    "CreateOpticalFlowSessionNV\0"
+    "CreatePipelineCache\0"
+    "CreatePipelineLayout\0"
+    "CreatePrivateDataSlot\0"
+    "CreatePrivateDataSlotEXT\0"
+    "CreateQueryPool\0"
+    "CreateRayTracingPipelinesKHR\0"
+    "CreateRayTracingPipelinesNV\0"
+    "CreateRenderPass\0"
+    "CreateRenderPass2\0"
+    "CreateRenderPass2KHR\0"
+    "CreateSampler\0"
+    "CreateSamplerYcbcrConversion\0"
+    "CreateSamplerYcbcrConversionKHR\0"
+    "CreateSemaphore\0"
+    "CreateShaderModule\0"
+    "CreateSharedSwapchainsKHR\0"
+    "CreateSwapchainKHR\0"
+    "CreateValidationCacheEXT\0"
+    "CreateVideoSessionKHR\0"
+    "CreateVideoSessionParametersKHR\0"
+    "DebugMarkerSetObjectNameEXT\0"
+    "DebugMarkerSetObjectTagEXT\0"
+    "DeferredOperationJoinKHR\0"
+    "DestroyAccelerationStructureKHR\0"
+    "DestroyAccelerationStructureNV\0"
+    "DestroyBuffer\0"
+    "DestroyBufferCollectionFUCHSIA\0"
+    "DestroyBufferView\0"
+    "DestroyCommandPool\0"
+    "DestroyCuFunctionNVX\0"
+    "DestroyCuModuleNVX\0"
+    "DestroyDeferredOperationKHR\0"
+    "DestroyDescriptorPool\0"
+    "DestroyDescriptorSetLayout\0"
+    "DestroyDescriptorUpdateTemplate\0"
+    "DestroyDescriptorUpdateTemplateKHR\0"
+    "DestroyDevice\0"
+    "DestroyEvent\0"
+    "DestroyFence\0"
+    "DestroyFramebuffer\0"
+    "DestroyImage\0"
+    "DestroyImageView\0"
+    "DestroyIndirectCommandsLayoutNV\0"
+    "DestroyMicromapEXT\0"
+    "DestroyOpticalFlowSessionNV\0"
+    "DestroyPipeline\0"
+    "DestroyPipelineCache\0"
+    "DestroyPipelineLayout\0"
+    "DestroyPrivateDataSlot\0"
+    "DestroyPrivateDataSlotEXT\0"
+    "DestroyQueryPool\0"
+    "DestroyRenderPass\0"
+    "DestroySampler\0"
+    "DestroySamplerYcbcrConversion\0"
+    "DestroySamplerYcbcrConversionKHR\0"
+    "DestroySemaphore\0"
+    "DestroyShaderModule\0"
+    "DestroySwapchainKHR\0"
+    "DestroyValidationCacheEXT\0"
+    "DestroyVideoSessionKHR\0"
+    "DestroyVideoSessionParametersKHR\0"
+    "DeviceWaitIdle\0"
+    "DisplayPowerControlEXT\0"
+    "EndCommandBuffer\0"
+    "ExportMetalObjectsEXT\0"
+    "FlushMappedMemoryRanges\0"
+    "FreeCommandBuffers\0"
+    "FreeDescriptorSets\0"
+    "FreeMemory\0"
+    "GetAccelerationStructureBuildSizesKHR\0"
+    "GetAccelerationStructureDeviceAddressKHR\0"
+    "GetAccelerationStructureHandleNV\0"
+    "GetAccelerationStructureMemoryRequirementsNV\0"
+    "GetAccelerationStructureOpaqueCaptureDescriptorDataEXT\0"
+    "GetAndroidHardwareBufferPropertiesANDROID\0"
+    "GetBufferCollectionPropertiesFUCHSIA\0"
+    "GetBufferDeviceAddress\0"
+    "GetBufferDeviceAddressEXT\0"
+    "GetBufferDeviceAddressKHR\0"
+    "GetBufferMemoryRequirements\0"
+    "GetBufferMemoryRequirements2\0"
+    "GetBufferMemoryRequirements2KHR\0"
+    "GetBufferOpaqueCaptureAddress\0"
+    "GetBufferOpaqueCaptureAddressKHR\0"
+    "GetBufferOpaqueCaptureDescriptorDataEXT\0"
+    "GetCalibratedTimestampsEXT\0"
+    "GetDeferredOperationMaxConcurrencyKHR\0"
+    "GetDeferredOperationResultKHR\0"
+    "GetDescriptorEXT\0"
+    "GetDescriptorSetHostMappingVALVE\0"
+    "GetDescriptorSetLayoutBindingOffsetEXT\0"
+    "GetDescriptorSetLayoutHostMappingInfoVALVE\0"
+    "GetDescriptorSetLayoutSizeEXT\0"
+    "GetDescriptorSetLayoutSupport\0"
+    "GetDescriptorSetLayoutSupportKHR\0"
+    "GetDeviceAccelerationStructureCompatibilityKHR\0"
+    "GetDeviceBufferMemoryRequirements\0"
+    "GetDeviceBufferMemoryRequirementsKHR\0"
+    "GetDeviceFaultInfoEXT\0"
+    "GetDeviceGroupPeerMemoryFeatures\0"
+    "GetDeviceGroupPeerMemoryFeaturesKHR\0"
+    "GetDeviceGroupPresentCapabilitiesKHR\0"
+    "GetDeviceGroupSurfacePresentModes2EXT\0"
+    "GetDeviceGroupSurfacePresentModesKHR\0"
+    "GetDeviceImageMemoryRequirements\0"
+    "GetDeviceImageMemoryRequirementsKHR\0"
+    "GetDeviceImageSparseMemoryRequirements\0"
+    "GetDeviceImageSparseMemoryRequirementsKHR\0"
+    "GetDeviceMemoryCommitment\0"
+    "GetDeviceMemoryOpaqueCaptureAddress\0"
+    "GetDeviceMemoryOpaqueCaptureAddressKHR\0"
+    "GetDeviceMicromapCompatibilityEXT\0"
+    "GetDeviceProcAddr\0"
+    "GetDeviceQueue\0"
+    "GetDeviceQueue2\0"
+    "GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI\0"
+    "GetDynamicRenderingTilePropertiesQCOM\0"
+    "GetEventStatus\0"
+    "GetFenceFdKHR\0"
+    "GetFenceStatus\0"
+    "GetFenceWin32HandleKHR\0"
+    "GetFramebufferTilePropertiesQCOM\0"
+    "GetGeneratedCommandsMemoryRequirementsNV\0"
+    "GetImageDrmFormatModifierPropertiesEXT\0"
+    "GetImageMemoryRequirements\0"
+    "GetImageMemoryRequirements2\0"
+    "GetImageMemoryRequirements2KHR\0"
+    "GetImageOpaqueCaptureDescriptorDataEXT\0"
+    "GetImageSparseMemoryRequirements\0"
+    "GetImageSparseMemoryRequirements2\0"
+    "GetImageSparseMemoryRequirements2KHR\0"
+    "GetImageSubresourceLayout\0"
+    "GetImageSubresourceLayout2EXT\0"
+    "GetImageViewAddressNVX\0"
+    "GetImageViewHandleNVX\0"
+    "GetImageViewOpaqueCaptureDescriptorDataEXT\0"
+    "GetMemoryAndroidHardwareBufferANDROID\0"
+    "GetMemoryFdKHR\0"
+    "GetMemoryFdPropertiesKHR\0"
+    "GetMemoryHostPointerPropertiesEXT\0"
+    "GetMemoryRemoteAddressNV\0"
+    "GetMemoryWin32HandleKHR\0"
+    "GetMemoryWin32HandleNV\0"
+    "GetMemoryWin32HandlePropertiesKHR\0"
+    "GetMemoryZirconHandleFUCHSIA\0"
+    "GetMemoryZirconHandlePropertiesFUCHSIA\0"
+    "GetMicromapBuildSizesEXT\0"
+    "GetPastPresentationTimingGOOGLE\0"
+    "GetPerformanceParameterINTEL\0"
+    "GetPipelineCacheData\0"
+    "GetPipelineExecutableInternalRepresentationsKHR\0"
+    "GetPipelineExecutablePropertiesKHR\0"
+    "GetPipelineExecutableStatisticsKHR\0"
+    "GetPipelinePropertiesEXT\0"
+    "GetPrivateData\0"
+    "GetPrivateDataEXT\0"
+    "GetQueryPoolResults\0"
+    "GetQueueCheckpointData2NV\0"
+    "GetQueueCheckpointDataNV\0"
+    "GetRayTracingCaptureReplayShaderGroupHandlesKHR\0"
+    "GetRayTracingShaderGroupHandlesKHR\0"
+    "GetRayTracingShaderGroupHandlesNV\0"
+    "GetRayTracingShaderGroupStackSizeKHR\0"
+    "GetRefreshCycleDurationGOOGLE\0"
+    "GetRenderAreaGranularity\0"
+    "GetSamplerOpaqueCaptureDescriptorDataEXT\0"
+    "GetSemaphoreCounterValue\0"
+    "GetSemaphoreCounterValueKHR\0"
+    "GetSemaphoreFdKHR\0"
+    "GetSemaphoreWin32HandleKHR\0"
+    "GetSemaphoreZirconHandleFUCHSIA\0"
+    "GetShaderInfoAMD\0"
+    "GetShaderModuleCreateInfoIdentifierEXT\0"
+    "GetShaderModuleIdentifierEXT\0"
+    "GetSwapchainCounterEXT\0"
+    "GetSwapchainImagesKHR\0"
+    "GetSwapchainStatusKHR\0"
+    "GetValidationCacheDataEXT\0"
+    "GetVideoSessionMemoryRequirementsKHR\0"
+    "ImportFenceFdKHR\0"
+    "ImportFenceWin32HandleKHR\0"
+    "ImportSemaphoreFdKHR\0"
+    "ImportSemaphoreWin32HandleKHR\0"
+    "ImportSemaphoreZirconHandleFUCHSIA\0"
+    "InitializePerformanceApiINTEL\0"
+    "InvalidateMappedMemoryRanges\0"
+    "MapMemory\0"
+    "MergePipelineCaches\0"
+    "MergeValidationCachesEXT\0"
+    "QueueBeginDebugUtilsLabelEXT\0"
+    "QueueBindSparse\0"
+    "QueueEndDebugUtilsLabelEXT\0"
+    "QueueInsertDebugUtilsLabelEXT\0"
+    "QueuePresentKHR\0"
+    "QueueSetPerformanceConfigurationINTEL\0"
+    "QueueSubmit\0"
+    "QueueSubmit2\0"
+    "QueueSubmit2KHR\0"
+    "QueueWaitIdle\0"
+    "RegisterDeviceEventEXT\0"
+    "RegisterDisplayEventEXT\0"
+    "ReleaseFullScreenExclusiveModeEXT\0"
+    "ReleasePerformanceConfigurationINTEL\0"
+    "ReleaseProfilingLockKHR\0"
+    "ResetCommandBuffer\0"
+    "ResetCommandPool\0"
+    "ResetDescriptorPool\0"
+    "ResetEvent\0"
+    "ResetFences\0"
+    "ResetQueryPool\0"
+    "ResetQueryPoolEXT\0"
+    "SetBufferCollectionBufferConstraintsFUCHSIA\0"
+    "SetBufferCollectionImageConstraintsFUCHSIA\0"
+    "SetDebugUtilsObjectNameEXT\0"
+    "SetDebugUtilsObjectTagEXT\0"
+    "SetDeviceMemoryPriorityEXT\0"
+    "SetEvent\0"
+    "SetHdrMetadataEXT\0"
+    "SetLocalDimmingAMD\0"
+    "SetPrivateData\0"
+    "SetPrivateDataEXT\0"
+    "SignalSemaphore\0"
+    "SignalSemaphoreKHR\0"
+    "TrimCommandPool\0"
+    "TrimCommandPoolKHR\0"
+    "UninitializePerformanceApiINTEL\0"
+    "UnmapMemory\0"
+    "UpdateDescriptorSetWithTemplate\0"
+    "UpdateDescriptorSetWithTemplateKHR\0"
+    "UpdateDescriptorSets\0"
+    "UpdateVideoSessionParametersKHR\0"
+    "WaitForFences\0"
+    "WaitForPresentKHR\0"
+    "WaitSemaphores\0"
+    "WaitSemaphoresKHR\0"
+    "WriteAccelerationStructuresPropertiesKHR\0"
+    "WriteMicromapsPropertiesEXT\0"
+    ;
+
+static const struct loader_dispatch_table_entry loader_device_dispatch_table_entries[] = {
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {0, offsetof(VkLayerDispatchTable, AcquireFullScreenExclusiveModeEXT)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {34, offsetof(VkLayerDispatchTable, AcquireNextImage2KHR)},
+    {55, offsetof(VkLayerDispatchTable, AcquireNextImageKHR)},
+    {75, offsetof(VkLayerDispatchTable, AcquirePerformanceConfigurationINTEL)},
+    {112, offsetof(VkLayerDispatchTable, AcquireProfilingLockKHR)},
+    {136, offsetof(VkLayerDispatchTable, AllocateCommandBuffers)},
+    {159, offsetof(VkLayerDispatchTable, AllocateDescriptorSets)},
+    {182, offsetof(VkLayerDispatchTable, AllocateMemory)},
+    {197, offsetof(VkLayerDispatchTable, BeginCommandBuffer)},
+    {216, offsetof(VkLayerDispatchTable, BindAccelerationStructureMemoryNV)},
+    {250, offsetof(VkLayerDispatchTable, BindBufferMemory)},
+    {267, offsetof(VkLayerDispatchTable, BindBufferMemory2)},
+    {285, offsetof(VkLayerDispatchTable, BindBufferMemory2KHR)},
+    {306, offsetof(VkLayerDispatchTable, BindImageMemory)},
+    {322, offsetof(VkLayerDispatchTable, BindImageMemory2)},
+    {339, offsetof(VkLayerDispatchTable, BindImageMemory2KHR)},
+    {359, offsetof(VkLayerDispatchTable, BindOpticalFlowSessionImageNV)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CreateVideoSessionKHR")) return (void *)table->CreateVideoSessionKHR;
+    {389, offsetof(VkLayerDispatchTable, BindVideoSessionMemoryKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {415, offsetof(VkLayerDispatchTable, BuildAccelerationStructuresKHR)},
+    {446, offsetof(VkLayerDispatchTable, BuildMicromapsEXT)},
+    {464, offsetof(VkLayerDispatchTable, CmdBeginConditionalRenderingEXT)},
+    {496, offsetof(VkLayerDispatchTable, CmdBeginDebugUtilsLabelEXT)},
+    {523, offsetof(VkLayerDispatchTable, CmdBeginQuery)},
+    {537, offsetof(VkLayerDispatchTable, CmdBeginQueryIndexedEXT)},
+    {561, offsetof(VkLayerDispatchTable, CmdBeginRenderPass)},
+    {580, offsetof(VkLayerDispatchTable, CmdBeginRenderPass2)},
+    {600, offsetof(VkLayerDispatchTable, CmdBeginRenderPass2KHR)},
+    {623, offsetof(VkLayerDispatchTable, CmdBeginRendering)},
+    {641, offsetof(VkLayerDispatchTable, CmdBeginRenderingKHR)},
+    {662, offsetof(VkLayerDispatchTable, CmdBeginTransformFeedbackEXT)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "DestroyVideoSessionKHR")) return (void *)table->DestroyVideoSessionKHR;
+    {691, offsetof(VkLayerDispatchTable, CmdBeginVideoCodingKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {714, offsetof(VkLayerDispatchTable, CmdBindDescriptorBufferEmbeddedSamplersEXT)},
+    {757, offsetof(VkLayerDispatchTable, CmdBindDescriptorBuffersEXT)},
+    {785, offsetof(VkLayerDispatchTable, CmdBindDescriptorSets)},
+    {807, offsetof(VkLayerDispatchTable, CmdBindIndexBuffer)},
+    {826, offsetof(VkLayerDispatchTable, CmdBindInvocationMaskHUAWEI)},
+    {854, offsetof(VkLayerDispatchTable, CmdBindPipeline)},
+    {870, offsetof(VkLayerDispatchTable, CmdBindPipelineShaderGroupNV)},
+    {899, offsetof(VkLayerDispatchTable, CmdBindShadingRateImageNV)},
+    {925, offsetof(VkLayerDispatchTable, CmdBindTransformFeedbackBuffersEXT)},
+    {960, offsetof(VkLayerDispatchTable, CmdBindVertexBuffers)},
+    {981, offsetof(VkLayerDispatchTable, CmdBindVertexBuffers2)},
+    {1003, offsetof(VkLayerDispatchTable, CmdBindVertexBuffers2EXT)},
+    {1028, offsetof(VkLayerDispatchTable, CmdBlitImage)},
+    {1041, offsetof(VkLayerDispatchTable, CmdBlitImage2)},
+    {1055, offsetof(VkLayerDispatchTable, CmdBlitImage2KHR)},
+    {1072, offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructureNV)},
+    {1104, offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructuresIndirectKHR)},
+    {1146, offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructuresKHR)},
+    {1180, offsetof(VkLayerDispatchTable, CmdBuildMicromapsEXT)},
+    {1201, offsetof(VkLayerDispatchTable, CmdClearAttachments)},
+    {1221, offsetof(VkLayerDispatchTable, CmdClearColorImage)},
+    {1240, offsetof(VkLayerDispatchTable, CmdClearDepthStencilImage)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "GetVideoSessionMemoryRequirementsKHR")) return (void *)table->GetVideoSessionMemoryRequirementsKHR;
+    {1266, offsetof(VkLayerDispatchTable, CmdControlVideoCodingKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {1291, offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureKHR)},
+    {1323, offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureNV)},
+    {1354, offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureToMemoryKHR)},
+    {1394, offsetof(VkLayerDispatchTable, CmdCopyBuffer)},
+    {1408, offsetof(VkLayerDispatchTable, CmdCopyBuffer2)},
+    {1423, offsetof(VkLayerDispatchTable, CmdCopyBuffer2KHR)},
+    {1441, offsetof(VkLayerDispatchTable, CmdCopyBufferToImage)},
+    {1462, offsetof(VkLayerDispatchTable, CmdCopyBufferToImage2)},
+    {1484, offsetof(VkLayerDispatchTable, CmdCopyBufferToImage2KHR)},
+    {1509, offsetof(VkLayerDispatchTable, CmdCopyImage)},
+    {1522, offsetof(VkLayerDispatchTable, CmdCopyImage2)},
+    {1536, offsetof(VkLayerDispatchTable, CmdCopyImage2KHR)},
+    {1553, offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer)},
+    {1574, offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer2)},
+    {1596, offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer2KHR)},
+    {1621, offsetof(VkLayerDispatchTable, CmdCopyMemoryIndirectNV)},
+    {1645, offsetof(VkLayerDispatchTable, CmdCopyMemoryToAccelerationStructureKHR)},
+    {1685, offsetof(VkLayerDispatchTable, CmdCopyMemoryToImageIndirectNV)},
+    {1716, offsetof(VkLayerDispatchTable, CmdCopyMemoryToMicromapEXT)},
+    {1743, offsetof(VkLayerDispatchTable, CmdCopyMicromapEXT)},
+    {1762, offsetof(VkLayerDispatchTable, CmdCopyMicromapToMemoryEXT)},
+    {1789, offsetof(VkLayerDispatchTable, CmdCopyQueryPoolResults)},
+    {1813, offsetof(VkLayerDispatchTable, CmdCuLaunchKernelNVX)},
+    {1834, offsetof(VkLayerDispatchTable, CmdDebugMarkerBeginEXT)},
+    {1857, offsetof(VkLayerDispatchTable, CmdDebugMarkerEndEXT)},
+    {1878, offsetof(VkLayerDispatchTable, CmdDebugMarkerInsertEXT)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "BindVideoSessionMemoryKHR")) return (void *)table->BindVideoSessionMemoryKHR;
+    {1902, offsetof(VkLayerDispatchTable, CmdDecodeVideoKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {1920, offsetof(VkLayerDispatchTable, CmdDecompressMemoryIndirectCountNV)},
+    {1955, offsetof(VkLayerDispatchTable, CmdDecompressMemoryNV)},
+    {1977, offsetof(VkLayerDispatchTable, CmdDispatch)},
+    {1989, offsetof(VkLayerDispatchTable, CmdDispatchBase)},
+    {2005, offsetof(VkLayerDispatchTable, CmdDispatchBaseKHR)},
+    {2024, offsetof(VkLayerDispatchTable, CmdDispatchIndirect)},
+    {2044, offsetof(VkLayerDispatchTable, CmdDraw)},
+    {2052, offsetof(VkLayerDispatchTable, CmdDrawIndexed)},
+    {2067, offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirect)},
+    {2090, offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCount)},
+    {2118, offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCountAMD)},
+    {2149, offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCountKHR)},
+    {2180, offsetof(VkLayerDispatchTable, CmdDrawIndirect)},
+    {2196, offsetof(VkLayerDispatchTable, CmdDrawIndirectByteCountEXT)},
+    {2224, offsetof(VkLayerDispatchTable, CmdDrawIndirectCount)},
+    {2245, offsetof(VkLayerDispatchTable, CmdDrawIndirectCountAMD)},
+    {2269, offsetof(VkLayerDispatchTable, CmdDrawIndirectCountKHR)},
+    {2293, offsetof(VkLayerDispatchTable, CmdDrawMeshTasksEXT)},
+    {2313, offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectCountEXT)},
+    {2346, offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectCountNV)},
+    {2378, offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectEXT)},
+    {2406, offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectNV)},
+    {2433, offsetof(VkLayerDispatchTable, CmdDrawMeshTasksNV)},
+    {2452, offsetof(VkLayerDispatchTable, CmdDrawMultiEXT)},
+    {2468, offsetof(VkLayerDispatchTable, CmdDrawMultiIndexedEXT)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CreateVideoSessionParametersKHR")) return (void *)table->CreateVideoSessionParametersKHR;
+    {2491, offsetof(VkLayerDispatchTable, CmdEncodeVideoKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {2509, offsetof(VkLayerDispatchTable, CmdEndConditionalRenderingEXT)},
+    {2539, offsetof(VkLayerDispatchTable, CmdEndDebugUtilsLabelEXT)},
+    {2564, offsetof(VkLayerDispatchTable, CmdEndQuery)},
+    {2576, offsetof(VkLayerDispatchTable, CmdEndQueryIndexedEXT)},
+    {2598, offsetof(VkLayerDispatchTable, CmdEndRenderPass)},
+    {2615, offsetof(VkLayerDispatchTable, CmdEndRenderPass2)},
+    {2633, offsetof(VkLayerDispatchTable, CmdEndRenderPass2KHR)},
+    {2654, offsetof(VkLayerDispatchTable, CmdEndRendering)},
+    {2670, offsetof(VkLayerDispatchTable, CmdEndRenderingKHR)},
+    {2689, offsetof(VkLayerDispatchTable, CmdEndTransformFeedbackEXT)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "UpdateVideoSessionParametersKHR")) return (void *)table->UpdateVideoSessionParametersKHR;
+    {2716, offsetof(VkLayerDispatchTable, CmdEndVideoCodingKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {2737, offsetof(VkLayerDispatchTable, CmdExecuteCommands)},
+    {2756, offsetof(VkLayerDispatchTable, CmdExecuteGeneratedCommandsNV)},
+    {2786, offsetof(VkLayerDispatchTable, CmdFillBuffer)},
+    {2800, offsetof(VkLayerDispatchTable, CmdInsertDebugUtilsLabelEXT)},
+    {2828, offsetof(VkLayerDispatchTable, CmdNextSubpass)},
+    {2843, offsetof(VkLayerDispatchTable, CmdNextSubpass2)},
+    {2859, offsetof(VkLayerDispatchTable, CmdNextSubpass2KHR)},
+    {2878, offsetof(VkLayerDispatchTable, CmdOpticalFlowExecuteNV)},
+    {2902, offsetof(VkLayerDispatchTable, CmdPipelineBarrier)},
+    {2921, offsetof(VkLayerDispatchTable, CmdPipelineBarrier2)},
+    {2941, offsetof(VkLayerDispatchTable, CmdPipelineBarrier2KHR)},
+    {2964, offsetof(VkLayerDispatchTable, CmdPreprocessGeneratedCommandsNV)},
+    {2997, offsetof(VkLayerDispatchTable, CmdPushConstants)},
+    {3014, offsetof(VkLayerDispatchTable, CmdPushDescriptorSetKHR)},
+    {3038, offsetof(VkLayerDispatchTable, CmdPushDescriptorSetWithTemplateKHR)},
+    {3074, offsetof(VkLayerDispatchTable, CmdResetEvent)},
+    {3088, offsetof(VkLayerDispatchTable, CmdResetEvent2)},
+    {3103, offsetof(VkLayerDispatchTable, CmdResetEvent2KHR)},
+    {3121, offsetof(VkLayerDispatchTable, CmdResetQueryPool)},
+    {3139, offsetof(VkLayerDispatchTable, CmdResolveImage)},
+    {3155, offsetof(VkLayerDispatchTable, CmdResolveImage2)},
+    {3172, offsetof(VkLayerDispatchTable, CmdResolveImage2KHR)},
+    {3192, offsetof(VkLayerDispatchTable, CmdSetAlphaToCoverageEnableEXT)},
+    {3223, offsetof(VkLayerDispatchTable, CmdSetAlphaToOneEnableEXT)},
+    {3249, offsetof(VkLayerDispatchTable, CmdSetBlendConstants)},
+    {3270, offsetof(VkLayerDispatchTable, CmdSetCheckpointNV)},
+    {3289, offsetof(VkLayerDispatchTable, CmdSetCoarseSampleOrderNV)},
+    {3315, offsetof(VkLayerDispatchTable, CmdSetColorBlendAdvancedEXT)},
+    {3343, offsetof(VkLayerDispatchTable, CmdSetColorBlendEnableEXT)},
+    {3369, offsetof(VkLayerDispatchTable, CmdSetColorBlendEquationEXT)},
+    {3397, offsetof(VkLayerDispatchTable, CmdSetColorWriteEnableEXT)},
+    {3423, offsetof(VkLayerDispatchTable, CmdSetColorWriteMaskEXT)},
+    {3447, offsetof(VkLayerDispatchTable, CmdSetConservativeRasterizationModeEXT)},
+    {3486, offsetof(VkLayerDispatchTable, CmdSetCoverageModulationModeNV)},
+    {3517, offsetof(VkLayerDispatchTable, CmdSetCoverageModulationTableEnableNV)},
+    {3555, offsetof(VkLayerDispatchTable, CmdSetCoverageModulationTableNV)},
+    {3587, offsetof(VkLayerDispatchTable, CmdSetCoverageReductionModeNV)},
+    {3617, offsetof(VkLayerDispatchTable, CmdSetCoverageToColorEnableNV)},
+    {3647, offsetof(VkLayerDispatchTable, CmdSetCoverageToColorLocationNV)},
+    {3679, offsetof(VkLayerDispatchTable, CmdSetCullMode)},
+    {3694, offsetof(VkLayerDispatchTable, CmdSetCullModeEXT)},
+    {3712, offsetof(VkLayerDispatchTable, CmdSetDepthBias)},
+    {3728, offsetof(VkLayerDispatchTable, CmdSetDepthBiasEnable)},
+    {3750, offsetof(VkLayerDispatchTable, CmdSetDepthBiasEnableEXT)},
+    {3775, offsetof(VkLayerDispatchTable, CmdSetDepthBounds)},
+    {3793, offsetof(VkLayerDispatchTable, CmdSetDepthBoundsTestEnable)},
+    {3821, offsetof(VkLayerDispatchTable, CmdSetDepthBoundsTestEnableEXT)},
+    {3852, offsetof(VkLayerDispatchTable, CmdSetDepthClampEnableEXT)},
+    {3878, offsetof(VkLayerDispatchTable, CmdSetDepthClipEnableEXT)},
+    {3903, offsetof(VkLayerDispatchTable, CmdSetDepthClipNegativeOneToOneEXT)},
+    {3938, offsetof(VkLayerDispatchTable, CmdSetDepthCompareOp)},
+    {3959, offsetof(VkLayerDispatchTable, CmdSetDepthCompareOpEXT)},
+    {3983, offsetof(VkLayerDispatchTable, CmdSetDepthTestEnable)},
+    {4005, offsetof(VkLayerDispatchTable, CmdSetDepthTestEnableEXT)},
+    {4030, offsetof(VkLayerDispatchTable, CmdSetDepthWriteEnable)},
+    {4053, offsetof(VkLayerDispatchTable, CmdSetDepthWriteEnableEXT)},
+    {4079, offsetof(VkLayerDispatchTable, CmdSetDescriptorBufferOffsetsEXT)},
+    {4112, offsetof(VkLayerDispatchTable, CmdSetDeviceMask)},
+    {4129, offsetof(VkLayerDispatchTable, CmdSetDeviceMaskKHR)},
+    {4149, offsetof(VkLayerDispatchTable, CmdSetDiscardRectangleEXT)},
+    {4175, offsetof(VkLayerDispatchTable, CmdSetEvent)},
+    {4187, offsetof(VkLayerDispatchTable, CmdSetEvent2)},
+    {4200, offsetof(VkLayerDispatchTable, CmdSetEvent2KHR)},
+    {4216, offsetof(VkLayerDispatchTable, CmdSetExclusiveScissorNV)},
+    {4241, offsetof(VkLayerDispatchTable, CmdSetExtraPrimitiveOverestimationSizeEXT)},
+    {4283, offsetof(VkLayerDispatchTable, CmdSetFragmentShadingRateEnumNV)},
+    {4315, offsetof(VkLayerDispatchTable, CmdSetFragmentShadingRateKHR)},
+    {4344, offsetof(VkLayerDispatchTable, CmdSetFrontFace)},
+    {4360, offsetof(VkLayerDispatchTable, CmdSetFrontFaceEXT)},
+    {4379, offsetof(VkLayerDispatchTable, CmdSetLineRasterizationModeEXT)},
+    {4410, offsetof(VkLayerDispatchTable, CmdSetLineStippleEXT)},
+    {4431, offsetof(VkLayerDispatchTable, CmdSetLineStippleEnableEXT)},
+    {4458, offsetof(VkLayerDispatchTable, CmdSetLineWidth)},
+    {4474, offsetof(VkLayerDispatchTable, CmdSetLogicOpEXT)},
+    {4491, offsetof(VkLayerDispatchTable, CmdSetLogicOpEnableEXT)},
+    {4514, offsetof(VkLayerDispatchTable, CmdSetPatchControlPointsEXT)},
+    {4542, offsetof(VkLayerDispatchTable, CmdSetPerformanceMarkerINTEL)},
+    {4571, offsetof(VkLayerDispatchTable, CmdSetPerformanceOverrideINTEL)},
+    {4602, offsetof(VkLayerDispatchTable, CmdSetPerformanceStreamMarkerINTEL)},
+    {4637, offsetof(VkLayerDispatchTable, CmdSetPolygonModeEXT)},
+    {4658, offsetof(VkLayerDispatchTable, CmdSetPrimitiveRestartEnable)},
+    {4687, offsetof(VkLayerDispatchTable, CmdSetPrimitiveRestartEnableEXT)},
+    {4719, offsetof(VkLayerDispatchTable, CmdSetPrimitiveTopology)},
+    {4743, offsetof(VkLayerDispatchTable, CmdSetPrimitiveTopologyEXT)},
+    {4770, offsetof(VkLayerDispatchTable, CmdSetProvokingVertexModeEXT)},
+    {4799, offsetof(VkLayerDispatchTable, CmdSetRasterizationSamplesEXT)},
+    {4829, offsetof(VkLayerDispatchTable, CmdSetRasterizationStreamEXT)},
+    {4858, offsetof(VkLayerDispatchTable, CmdSetRasterizerDiscardEnable)},
+    {4888, offsetof(VkLayerDispatchTable, CmdSetRasterizerDiscardEnableEXT)},
+    {4921, offsetof(VkLayerDispatchTable, CmdSetRayTracingPipelineStackSizeKHR)},
+    {4958, offsetof(VkLayerDispatchTable, CmdSetRepresentativeFragmentTestEnableNV)},
+    {4999, offsetof(VkLayerDispatchTable, CmdSetSampleLocationsEXT)},
+    {5024, offsetof(VkLayerDispatchTable, CmdSetSampleLocationsEnableEXT)},
+    {5055, offsetof(VkLayerDispatchTable, CmdSetSampleMaskEXT)},
+    {5075, offsetof(VkLayerDispatchTable, CmdSetScissor)},
+    {5089, offsetof(VkLayerDispatchTable, CmdSetScissorWithCount)},
+    {5112, offsetof(VkLayerDispatchTable, CmdSetScissorWithCountEXT)},
+    {5138, offsetof(VkLayerDispatchTable, CmdSetShadingRateImageEnableNV)},
+    {5169, offsetof(VkLayerDispatchTable, CmdSetStencilCompareMask)},
+    {5194, offsetof(VkLayerDispatchTable, CmdSetStencilOp)},
+    {5210, offsetof(VkLayerDispatchTable, CmdSetStencilOpEXT)},
+    {5229, offsetof(VkLayerDispatchTable, CmdSetStencilReference)},
+    {5252, offsetof(VkLayerDispatchTable, CmdSetStencilTestEnable)},
+    {5276, offsetof(VkLayerDispatchTable, CmdSetStencilTestEnableEXT)},
+    {5303, offsetof(VkLayerDispatchTable, CmdSetStencilWriteMask)},
+    {5326, offsetof(VkLayerDispatchTable, CmdSetTessellationDomainOriginEXT)},
+    {5360, offsetof(VkLayerDispatchTable, CmdSetVertexInputEXT)},
+    {5381, offsetof(VkLayerDispatchTable, CmdSetViewport)},
+    {5396, offsetof(VkLayerDispatchTable, CmdSetViewportShadingRatePaletteNV)},
+    {5431, offsetof(VkLayerDispatchTable, CmdSetViewportSwizzleNV)},
+    {5455, offsetof(VkLayerDispatchTable, CmdSetViewportWScalingEnableNV)},
+    {5486, offsetof(VkLayerDispatchTable, CmdSetViewportWScalingNV)},
+    {5511, offsetof(VkLayerDispatchTable, CmdSetViewportWithCount)},
+    {5535, offsetof(VkLayerDispatchTable, CmdSetViewportWithCountEXT)},
+    {5562, offsetof(VkLayerDispatchTable, CmdSubpassShadingHUAWEI)},
+    {5586, offsetof(VkLayerDispatchTable, CmdTraceRaysIndirect2KHR)},
+    {5611, offsetof(VkLayerDispatchTable, CmdTraceRaysIndirectKHR)},
+    {5635, offsetof(VkLayerDispatchTable, CmdTraceRaysKHR)},
+    {5651, offsetof(VkLayerDispatchTable, CmdTraceRaysNV)},
+    {5666, offsetof(VkLayerDispatchTable, CmdUpdateBuffer)},
+    {5682, offsetof(VkLayerDispatchTable, CmdWaitEvents)},
+    {5696, offsetof(VkLayerDispatchTable, CmdWaitEvents2)},
+    {5711, offsetof(VkLayerDispatchTable, CmdWaitEvents2KHR)},
+    {5729, offsetof(VkLayerDispatchTable, CmdWriteAccelerationStructuresPropertiesKHR)},
+    {5773, offsetof(VkLayerDispatchTable, CmdWriteAccelerationStructuresPropertiesNV)},
+    {5816, offsetof(VkLayerDispatchTable, CmdWriteBufferMarker2AMD)},
+    {5841, offsetof(VkLayerDispatchTable, CmdWriteBufferMarkerAMD)},
+    {5865, offsetof(VkLayerDispatchTable, CmdWriteMicromapsPropertiesEXT)},
+    {5896, offsetof(VkLayerDispatchTable, CmdWriteTimestamp)},
+    {5914, offsetof(VkLayerDispatchTable, CmdWriteTimestamp2)},
+    {5933, offsetof(VkLayerDispatchTable, CmdWriteTimestamp2KHR)},
+    {5955, offsetof(VkLayerDispatchTable, CompileDeferredNV)},
+    {5973, offsetof(VkLayerDispatchTable, CopyAccelerationStructureKHR)},
+    {6002, offsetof(VkLayerDispatchTable, CopyAccelerationStructureToMemoryKHR)},
+    {6039, offsetof(VkLayerDispatchTable, CopyMemoryToAccelerationStructureKHR)},
+    {6076, offsetof(VkLayerDispatchTable, CopyMemoryToMicromapEXT)},
+    {6100, offsetof(VkLayerDispatchTable, CopyMicromapEXT)},
+    {6116, offsetof(VkLayerDispatchTable, CopyMicromapToMemoryEXT)},
+    {6140, offsetof(VkLayerDispatchTable, CreateAccelerationStructureKHR)},
+    {6171, offsetof(VkLayerDispatchTable, CreateAccelerationStructureNV)},
+    {6201, offsetof(VkLayerDispatchTable, CreateBuffer)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {6214, offsetof(VkLayerDispatchTable, CreateBufferCollectionFUCHSIA)},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {6244, offsetof(VkLayerDispatchTable, CreateBufferView)},
+    {6261, offsetof(VkLayerDispatchTable, CreateCommandPool)},
+    {6279, offsetof(VkLayerDispatchTable, CreateComputePipelines)},
+    {6302, offsetof(VkLayerDispatchTable, CreateCuFunctionNVX)},
+    {6322, offsetof(VkLayerDispatchTable, CreateCuModuleNVX)},
+    {6340, offsetof(VkLayerDispatchTable, CreateDeferredOperationKHR)},
+    {6367, offsetof(VkLayerDispatchTable, CreateDescriptorPool)},
+    {6388, offsetof(VkLayerDispatchTable, CreateDescriptorSetLayout)},
+    {6414, offsetof(VkLayerDispatchTable, CreateDescriptorUpdateTemplate)},
+    {6445, offsetof(VkLayerDispatchTable, CreateDescriptorUpdateTemplateKHR)},
+    {6479, offsetof(VkLayerDispatchTable, CreateEvent)},
+    {6491, offsetof(VkLayerDispatchTable, CreateFence)},
+    {6503, offsetof(VkLayerDispatchTable, CreateFramebuffer)},
+    {6521, offsetof(VkLayerDispatchTable, CreateGraphicsPipelines)},
+    {6545, offsetof(VkLayerDispatchTable, CreateImage)},
+    {6557, offsetof(VkLayerDispatchTable, CreateImageView)},
+    {6573, offsetof(VkLayerDispatchTable, CreateIndirectCommandsLayoutNV)},
+    {6604, offsetof(VkLayerDispatchTable, CreateMicromapEXT)},
+    {6622, offsetof(VkLayerDispatchTable, CreateOpticalFlowSessionNV)},
+    {6649, offsetof(VkLayerDispatchTable, CreatePipelineCache)},
+    {6669, offsetof(VkLayerDispatchTable, CreatePipelineLayout)},
+    {6690, offsetof(VkLayerDispatchTable, CreatePrivateDataSlot)},
+    {6712, offsetof(VkLayerDispatchTable, CreatePrivateDataSlotEXT)},
+    {6737, offsetof(VkLayerDispatchTable, CreateQueryPool)},
+    {6753, offsetof(VkLayerDispatchTable, CreateRayTracingPipelinesKHR)},
+    {6782, offsetof(VkLayerDispatchTable, CreateRayTracingPipelinesNV)},
+    {6810, offsetof(VkLayerDispatchTable, CreateRenderPass)},
+    {6827, offsetof(VkLayerDispatchTable, CreateRenderPass2)},
+    {6845, offsetof(VkLayerDispatchTable, CreateRenderPass2KHR)},
+    {6866, offsetof(VkLayerDispatchTable, CreateSampler)},
+    {6880, offsetof(VkLayerDispatchTable, CreateSamplerYcbcrConversion)},
+    {6909, offsetof(VkLayerDispatchTable, CreateSamplerYcbcrConversionKHR)},
+    {6941, offsetof(VkLayerDispatchTable, CreateSemaphore)},
+    {6957, offsetof(VkLayerDispatchTable, CreateShaderModule)},
+    {6976, offsetof(VkLayerDispatchTable, CreateSharedSwapchainsKHR)},
+    {7002, offsetof(VkLayerDispatchTable, CreateSwapchainKHR)},
+    {7021, offsetof(VkLayerDispatchTable, CreateValidationCacheEXT)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "DestroyVideoSessionParametersKHR")) return (void *)table->DestroyVideoSessionParametersKHR;
+    {7046, offsetof(VkLayerDispatchTable, CreateVideoSessionKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdBeginVideoCodingKHR")) return (void *)table->CmdBeginVideoCodingKHR;
+    {7068, offsetof(VkLayerDispatchTable, CreateVideoSessionParametersKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {7100, offsetof(VkLayerDispatchTable, DebugMarkerSetObjectNameEXT)},
+    {7128, offsetof(VkLayerDispatchTable, DebugMarkerSetObjectTagEXT)},
+    {7155, offsetof(VkLayerDispatchTable, DeferredOperationJoinKHR)},
+    {7180, offsetof(VkLayerDispatchTable, DestroyAccelerationStructureKHR)},
+    {7212, offsetof(VkLayerDispatchTable, DestroyAccelerationStructureNV)},
+    {7243, offsetof(VkLayerDispatchTable, DestroyBuffer)},
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {7257, offsetof(VkLayerDispatchTable, DestroyBufferCollectionFUCHSIA)},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {7288, offsetof(VkLayerDispatchTable, DestroyBufferView)},
+    {7306, offsetof(VkLayerDispatchTable, DestroyCommandPool)},
+    {7325, offsetof(VkLayerDispatchTable, DestroyCuFunctionNVX)},
+    {7346, offsetof(VkLayerDispatchTable, DestroyCuModuleNVX)},
+    {7365, offsetof(VkLayerDispatchTable, DestroyDeferredOperationKHR)},
+    {7393, offsetof(VkLayerDispatchTable, DestroyDescriptorPool)},
+    {7415, offsetof(VkLayerDispatchTable, DestroyDescriptorSetLayout)},
+    {7442, offsetof(VkLayerDispatchTable, DestroyDescriptorUpdateTemplate)},
+    {7474, offsetof(VkLayerDispatchTable, DestroyDescriptorUpdateTemplateKHR)},
+    {7509, offsetof(VkLayerDispatchTable, DestroyDevice)},
+    {7523, offsetof(VkLayerDispatchTable, DestroyEvent)},
+    {7536, offsetof(VkLayerDispatchTable, DestroyFence)},
+    {7549, offsetof(VkLayerDispatchTable, DestroyFramebuffer)},
+    {7568, offsetof(VkLayerDispatchTable, DestroyImage)},
+    {7581, offsetof(VkLayerDispatchTable, DestroyImageView)},
+    {7598, offsetof(VkLayerDispatchTable, DestroyIndirectCommandsLayoutNV)},
+    {7630, offsetof(VkLayerDispatchTable, DestroyMicromapEXT)},
+    {7649, offsetof(VkLayerDispatchTable, DestroyOpticalFlowSessionNV)},
+    {7677, offsetof(VkLayerDispatchTable, DestroyPipeline)},
+    {7693, offsetof(VkLayerDispatchTable, DestroyPipelineCache)},
+    {7714, offsetof(VkLayerDispatchTable, DestroyPipelineLayout)},
+    {7736, offsetof(VkLayerDispatchTable, DestroyPrivateDataSlot)},
+    {7759, offsetof(VkLayerDispatchTable, DestroyPrivateDataSlotEXT)},
+    {7785, offsetof(VkLayerDispatchTable, DestroyQueryPool)},
+    {7802, offsetof(VkLayerDispatchTable, DestroyRenderPass)},
+    {7820, offsetof(VkLayerDispatchTable, DestroySampler)},
+    {7835, offsetof(VkLayerDispatchTable, DestroySamplerYcbcrConversion)},
+    {7865, offsetof(VkLayerDispatchTable, DestroySamplerYcbcrConversionKHR)},
+    {7898, offsetof(VkLayerDispatchTable, DestroySemaphore)},
+    {7915, offsetof(VkLayerDispatchTable, DestroyShaderModule)},
+    {7935, offsetof(VkLayerDispatchTable, DestroySwapchainKHR)},
+    {7955, offsetof(VkLayerDispatchTable, DestroyValidationCacheEXT)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdEndVideoCodingKHR")) return (void *)table->CmdEndVideoCodingKHR;
+    {7981, offsetof(VkLayerDispatchTable, DestroyVideoSessionKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdControlVideoCodingKHR")) return (void *)table->CmdControlVideoCodingKHR;
+    {8004, offsetof(VkLayerDispatchTable, DestroyVideoSessionParametersKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
-
-    // ---- VK_KHR_video_decode_queue extension commands
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdDecodeVideoKHR")) return (void *)table->CmdDecodeVideoKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
-
-    // ---- VK_KHR_dynamic_rendering extension commands
-    if (!strcmp(name, "CmdBeginRenderingKHR")) return (void *)table->CmdBeginRenderingKHR;
-    if (!strcmp(name, "CmdEndRenderingKHR")) return (void *)table->CmdEndRenderingKHR;
-
-    // ---- VK_KHR_device_group extension commands
-    if (!strcmp(name, "GetDeviceGroupPeerMemoryFeaturesKHR")) return (void *)table->GetDeviceGroupPeerMemoryFeaturesKHR;
-    if (!strcmp(name, "CmdSetDeviceMaskKHR")) return (void *)table->CmdSetDeviceMaskKHR;
-    if (!strcmp(name, "CmdDispatchBaseKHR")) return (void *)table->CmdDispatchBaseKHR;
-
-    // ---- VK_KHR_maintenance1 extension commands
-    if (!strcmp(name, "TrimCommandPoolKHR")) return (void *)table->TrimCommandPoolKHR;
-
-    // ---- VK_KHR_external_memory_win32 extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetMemoryWin32HandleKHR")) return (void *)table->GetMemoryWin32HandleKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetMemoryWin32HandlePropertiesKHR")) return (void *)table->GetMemoryWin32HandlePropertiesKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_KHR_external_memory_fd extension commands
-    if (!strcmp(name, "GetMemoryFdKHR")) return (void *)table->GetMemoryFdKHR;
-    if (!strcmp(name, "GetMemoryFdPropertiesKHR")) return (void *)table->GetMemoryFdPropertiesKHR;
-
-    // ---- VK_KHR_external_semaphore_win32 extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "ImportSemaphoreWin32HandleKHR")) return (void *)table->ImportSemaphoreWin32HandleKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetSemaphoreWin32HandleKHR")) return (void *)table->GetSemaphoreWin32HandleKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_KHR_external_semaphore_fd extension commands
-    if (!strcmp(name, "ImportSemaphoreFdKHR")) return (void *)table->ImportSemaphoreFdKHR;
-    if (!strcmp(name, "GetSemaphoreFdKHR")) return (void *)table->GetSemaphoreFdKHR;
-
-    // ---- VK_KHR_push_descriptor extension commands
-    if (!strcmp(name, "CmdPushDescriptorSetKHR")) return (void *)table->CmdPushDescriptorSetKHR;
-    if (!strcmp(name, "CmdPushDescriptorSetWithTemplateKHR")) return (void *)table->CmdPushDescriptorSetWithTemplateKHR;
-
-    // ---- VK_KHR_descriptor_update_template extension commands
-    if (!strcmp(name, "CreateDescriptorUpdateTemplateKHR")) return (void *)table->CreateDescriptorUpdateTemplateKHR;
-    if (!strcmp(name, "DestroyDescriptorUpdateTemplateKHR")) return (void *)table->DestroyDescriptorUpdateTemplateKHR;
-    if (!strcmp(name, "UpdateDescriptorSetWithTemplateKHR")) return (void *)table->UpdateDescriptorSetWithTemplateKHR;
-
-    // ---- VK_KHR_create_renderpass2 extension commands
-    if (!strcmp(name, "CreateRenderPass2KHR")) return (void *)table->CreateRenderPass2KHR;
-    if (!strcmp(name, "CmdBeginRenderPass2KHR")) return (void *)table->CmdBeginRenderPass2KHR;
-    if (!strcmp(name, "CmdNextSubpass2KHR")) return (void *)table->CmdNextSubpass2KHR;
-    if (!strcmp(name, "CmdEndRenderPass2KHR")) return (void *)table->CmdEndRenderPass2KHR;
-
-    // ---- VK_KHR_shared_presentable_image extension commands
-    if (!strcmp(name, "GetSwapchainStatusKHR")) return (void *)table->GetSwapchainStatusKHR;
-
-    // ---- VK_KHR_external_fence_win32 extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "ImportFenceWin32HandleKHR")) return (void *)table->ImportFenceWin32HandleKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
+    {8037, offsetof(VkLayerDispatchTable, DeviceWaitIdle)},
+    {8052, offsetof(VkLayerDispatchTable, DisplayPowerControlEXT)},
+    {8075, offsetof(VkLayerDispatchTable, EndCommandBuffer)},
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    {8092, offsetof(VkLayerDispatchTable, ExportMetalObjectsEXT)},
+#endif // VK_USE_PLATFORM_METAL_EXT
+    {8114, offsetof(VkLayerDispatchTable, FlushMappedMemoryRanges)},
+    {8138, offsetof(VkLayerDispatchTable, FreeCommandBuffers)},
+    {8157, offsetof(VkLayerDispatchTable, FreeDescriptorSets)},
+    {8176, offsetof(VkLayerDispatchTable, FreeMemory)},
+    {8187, offsetof(VkLayerDispatchTable, GetAccelerationStructureBuildSizesKHR)},
+    {8225, offsetof(VkLayerDispatchTable, GetAccelerationStructureDeviceAddressKHR)},
+    {8266, offsetof(VkLayerDispatchTable, GetAccelerationStructureHandleNV)},
+    {8299, offsetof(VkLayerDispatchTable, GetAccelerationStructureMemoryRequirementsNV)},
+    {8344, offsetof(VkLayerDispatchTable, GetAccelerationStructureOpaqueCaptureDescriptorDataEXT)},
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {8399, offsetof(VkLayerDispatchTable, GetAndroidHardwareBufferPropertiesANDROID)},
+#endif // VK_USE_PLATFORM_ANDROID_KHR
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    {8441, offsetof(VkLayerDispatchTable, GetBufferCollectionPropertiesFUCHSIA)},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {8478, offsetof(VkLayerDispatchTable, GetBufferDeviceAddress)},
+    {8501, offsetof(VkLayerDispatchTable, GetBufferDeviceAddressEXT)},
+    {8527, offsetof(VkLayerDispatchTable, GetBufferDeviceAddressKHR)},
+    {8553, offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements)},
+    {8581, offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements2)},
+    {8610, offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements2KHR)},
+    {8642, offsetof(VkLayerDispatchTable, GetBufferOpaqueCaptureAddress)},
+    {8672, offsetof(VkLayerDispatchTable, GetBufferOpaqueCaptureAddressKHR)},
+    {8705, offsetof(VkLayerDispatchTable, GetBufferOpaqueCaptureDescriptorDataEXT)},
+    {8745, offsetof(VkLayerDispatchTable, GetCalibratedTimestampsEXT)},
+    {8772, offsetof(VkLayerDispatchTable, GetDeferredOperationMaxConcurrencyKHR)},
+    {8810, offsetof(VkLayerDispatchTable, GetDeferredOperationResultKHR)},
+    {8840, offsetof(VkLayerDispatchTable, GetDescriptorEXT)},
+    {8857, offsetof(VkLayerDispatchTable, GetDescriptorSetHostMappingVALVE)},
+    {8890, offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutBindingOffsetEXT)},
+    {8929, offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutHostMappingInfoVALVE)},
+    {8972, offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutSizeEXT)},
+    {9002, offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutSupport)},
+    {9032, offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutSupportKHR)},
+    {9065, offsetof(VkLayerDispatchTable, GetDeviceAccelerationStructureCompatibilityKHR)},
+    {9112, offsetof(VkLayerDispatchTable, GetDeviceBufferMemoryRequirements)},
+    {9146, offsetof(VkLayerDispatchTable, GetDeviceBufferMemoryRequirementsKHR)},
+    {9183, offsetof(VkLayerDispatchTable, GetDeviceFaultInfoEXT)},
+    {9205, offsetof(VkLayerDispatchTable, GetDeviceGroupPeerMemoryFeatures)},
+    {9238, offsetof(VkLayerDispatchTable, GetDeviceGroupPeerMemoryFeaturesKHR)},
+    {9274, offsetof(VkLayerDispatchTable, GetDeviceGroupPresentCapabilitiesKHR)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetFenceWin32HandleKHR")) return (void *)table->GetFenceWin32HandleKHR;
+    {9311, offsetof(VkLayerDispatchTable, GetDeviceGroupSurfacePresentModes2EXT)},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_KHR_external_fence_fd extension commands
-    if (!strcmp(name, "ImportFenceFdKHR")) return (void *)table->ImportFenceFdKHR;
-    if (!strcmp(name, "GetFenceFdKHR")) return (void *)table->GetFenceFdKHR;
-
-    // ---- VK_KHR_performance_query extension commands
-    if (!strcmp(name, "AcquireProfilingLockKHR")) return (void *)table->AcquireProfilingLockKHR;
-    if (!strcmp(name, "ReleaseProfilingLockKHR")) return (void *)table->ReleaseProfilingLockKHR;
-
-    // ---- VK_KHR_get_memory_requirements2 extension commands
-    if (!strcmp(name, "GetImageMemoryRequirements2KHR")) return (void *)table->GetImageMemoryRequirements2KHR;
-    if (!strcmp(name, "GetBufferMemoryRequirements2KHR")) return (void *)table->GetBufferMemoryRequirements2KHR;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements2KHR")) return (void *)table->GetImageSparseMemoryRequirements2KHR;
-
-    // ---- VK_KHR_sampler_ycbcr_conversion extension commands
-    if (!strcmp(name, "CreateSamplerYcbcrConversionKHR")) return (void *)table->CreateSamplerYcbcrConversionKHR;
-    if (!strcmp(name, "DestroySamplerYcbcrConversionKHR")) return (void *)table->DestroySamplerYcbcrConversionKHR;
-
-    // ---- VK_KHR_bind_memory2 extension commands
-    if (!strcmp(name, "BindBufferMemory2KHR")) return (void *)table->BindBufferMemory2KHR;
-    if (!strcmp(name, "BindImageMemory2KHR")) return (void *)table->BindImageMemory2KHR;
-
-    // ---- VK_KHR_maintenance3 extension commands
-    if (!strcmp(name, "GetDescriptorSetLayoutSupportKHR")) return (void *)table->GetDescriptorSetLayoutSupportKHR;
-
-    // ---- VK_KHR_draw_indirect_count extension commands
-    if (!strcmp(name, "CmdDrawIndirectCountKHR")) return (void *)table->CmdDrawIndirectCountKHR;
-    if (!strcmp(name, "CmdDrawIndexedIndirectCountKHR")) return (void *)table->CmdDrawIndexedIndirectCountKHR;
-
-    // ---- VK_KHR_timeline_semaphore extension commands
-    if (!strcmp(name, "GetSemaphoreCounterValueKHR")) return (void *)table->GetSemaphoreCounterValueKHR;
-    if (!strcmp(name, "WaitSemaphoresKHR")) return (void *)table->WaitSemaphoresKHR;
-    if (!strcmp(name, "SignalSemaphoreKHR")) return (void *)table->SignalSemaphoreKHR;
-
-    // ---- VK_KHR_fragment_shading_rate extension commands
-    if (!strcmp(name, "CmdSetFragmentShadingRateKHR")) return (void *)table->CmdSetFragmentShadingRateKHR;
-
-    // ---- VK_KHR_present_wait extension commands
-    if (!strcmp(name, "WaitForPresentKHR")) return (void *)table->WaitForPresentKHR;
-
-    // ---- VK_KHR_buffer_device_address extension commands
-    if (!strcmp(name, "GetBufferDeviceAddressKHR")) return (void *)table->GetBufferDeviceAddressKHR;
-    if (!strcmp(name, "GetBufferOpaqueCaptureAddressKHR")) return (void *)table->GetBufferOpaqueCaptureAddressKHR;
-    if (!strcmp(name, "GetDeviceMemoryOpaqueCaptureAddressKHR")) return (void *)table->GetDeviceMemoryOpaqueCaptureAddressKHR;
-
-    // ---- VK_KHR_deferred_host_operations extension commands
-    if (!strcmp(name, "CreateDeferredOperationKHR")) return (void *)table->CreateDeferredOperationKHR;
-    if (!strcmp(name, "DestroyDeferredOperationKHR")) return (void *)table->DestroyDeferredOperationKHR;
-    if (!strcmp(name, "GetDeferredOperationMaxConcurrencyKHR")) return (void *)table->GetDeferredOperationMaxConcurrencyKHR;
-    if (!strcmp(name, "GetDeferredOperationResultKHR")) return (void *)table->GetDeferredOperationResultKHR;
-    if (!strcmp(name, "DeferredOperationJoinKHR")) return (void *)table->DeferredOperationJoinKHR;
-
-    // ---- VK_KHR_pipeline_executable_properties extension commands
-    if (!strcmp(name, "GetPipelineExecutablePropertiesKHR")) return (void *)table->GetPipelineExecutablePropertiesKHR;
-    if (!strcmp(name, "GetPipelineExecutableStatisticsKHR")) return (void *)table->GetPipelineExecutableStatisticsKHR;
-    if (!strcmp(name, "GetPipelineExecutableInternalRepresentationsKHR")) return (void *)table->GetPipelineExecutableInternalRepresentationsKHR;
-
-    // ---- VK_KHR_video_encode_queue extension commands
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "CmdEncodeVideoKHR")) return (void *)table->CmdEncodeVideoKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
-
-    // ---- VK_KHR_synchronization2 extension commands
-    if (!strcmp(name, "CmdSetEvent2KHR")) return (void *)table->CmdSetEvent2KHR;
-    if (!strcmp(name, "CmdResetEvent2KHR")) return (void *)table->CmdResetEvent2KHR;
-    if (!strcmp(name, "CmdWaitEvents2KHR")) return (void *)table->CmdWaitEvents2KHR;
-    if (!strcmp(name, "CmdPipelineBarrier2KHR")) return (void *)table->CmdPipelineBarrier2KHR;
-    if (!strcmp(name, "CmdWriteTimestamp2KHR")) return (void *)table->CmdWriteTimestamp2KHR;
-    if (!strcmp(name, "QueueSubmit2KHR")) return (void *)table->QueueSubmit2KHR;
-    if (!strcmp(name, "CmdWriteBufferMarker2AMD")) return (void *)table->CmdWriteBufferMarker2AMD;
-    if (!strcmp(name, "GetQueueCheckpointData2NV")) return (void *)table->GetQueueCheckpointData2NV;
-
-    // ---- VK_KHR_copy_commands2 extension commands
-    if (!strcmp(name, "CmdCopyBuffer2KHR")) return (void *)table->CmdCopyBuffer2KHR;
-    if (!strcmp(name, "CmdCopyImage2KHR")) return (void *)table->CmdCopyImage2KHR;
-    if (!strcmp(name, "CmdCopyBufferToImage2KHR")) return (void *)table->CmdCopyBufferToImage2KHR;
-    if (!strcmp(name, "CmdCopyImageToBuffer2KHR")) return (void *)table->CmdCopyImageToBuffer2KHR;
-    if (!strcmp(name, "CmdBlitImage2KHR")) return (void *)table->CmdBlitImage2KHR;
-    if (!strcmp(name, "CmdResolveImage2KHR")) return (void *)table->CmdResolveImage2KHR;
-
-    // ---- VK_KHR_ray_tracing_maintenance1 extension commands
-    if (!strcmp(name, "CmdTraceRaysIndirect2KHR")) return (void *)table->CmdTraceRaysIndirect2KHR;
-
-    // ---- VK_KHR_maintenance4 extension commands
-    if (!strcmp(name, "GetDeviceBufferMemoryRequirementsKHR")) return (void *)table->GetDeviceBufferMemoryRequirementsKHR;
-    if (!strcmp(name, "GetDeviceImageMemoryRequirementsKHR")) return (void *)table->GetDeviceImageMemoryRequirementsKHR;
-    if (!strcmp(name, "GetDeviceImageSparseMemoryRequirementsKHR")) return (void *)table->GetDeviceImageSparseMemoryRequirementsKHR;
-
-    // ---- VK_EXT_debug_marker extension commands
-    if (!strcmp(name, "DebugMarkerSetObjectTagEXT")) return (void *)table->DebugMarkerSetObjectTagEXT;
-    if (!strcmp(name, "DebugMarkerSetObjectNameEXT")) return (void *)table->DebugMarkerSetObjectNameEXT;
-    if (!strcmp(name, "CmdDebugMarkerBeginEXT")) return (void *)table->CmdDebugMarkerBeginEXT;
-    if (!strcmp(name, "CmdDebugMarkerEndEXT")) return (void *)table->CmdDebugMarkerEndEXT;
-    if (!strcmp(name, "CmdDebugMarkerInsertEXT")) return (void *)table->CmdDebugMarkerInsertEXT;
-
-    // ---- VK_EXT_transform_feedback extension commands
-    if (!strcmp(name, "CmdBindTransformFeedbackBuffersEXT")) return (void *)table->CmdBindTransformFeedbackBuffersEXT;
-    if (!strcmp(name, "CmdBeginTransformFeedbackEXT")) return (void *)table->CmdBeginTransformFeedbackEXT;
-    if (!strcmp(name, "CmdEndTransformFeedbackEXT")) return (void *)table->CmdEndTransformFeedbackEXT;
-    if (!strcmp(name, "CmdBeginQueryIndexedEXT")) return (void *)table->CmdBeginQueryIndexedEXT;
-    if (!strcmp(name, "CmdEndQueryIndexedEXT")) return (void *)table->CmdEndQueryIndexedEXT;
-    if (!strcmp(name, "CmdDrawIndirectByteCountEXT")) return (void *)table->CmdDrawIndirectByteCountEXT;
-
-    // ---- VK_NVX_binary_import extension commands
-    if (!strcmp(name, "CreateCuModuleNVX")) return (void *)table->CreateCuModuleNVX;
-    if (!strcmp(name, "CreateCuFunctionNVX")) return (void *)table->CreateCuFunctionNVX;
-    if (!strcmp(name, "DestroyCuModuleNVX")) return (void *)table->DestroyCuModuleNVX;
-    if (!strcmp(name, "DestroyCuFunctionNVX")) return (void *)table->DestroyCuFunctionNVX;
-    if (!strcmp(name, "CmdCuLaunchKernelNVX")) return (void *)table->CmdCuLaunchKernelNVX;
-
-    // ---- VK_NVX_image_view_handle extension commands
-    if (!strcmp(name, "GetImageViewHandleNVX")) return (void *)table->GetImageViewHandleNVX;
-    if (!strcmp(name, "GetImageViewAddressNVX")) return (void *)table->GetImageViewAddressNVX;
-
-    // ---- VK_AMD_draw_indirect_count extension commands
-    if (!strcmp(name, "CmdDrawIndirectCountAMD")) return (void *)table->CmdDrawIndirectCountAMD;
-    if (!strcmp(name, "CmdDrawIndexedIndirectCountAMD")) return (void *)table->CmdDrawIndexedIndirectCountAMD;
-
-    // ---- VK_AMD_shader_info extension commands
-    if (!strcmp(name, "GetShaderInfoAMD")) return (void *)table->GetShaderInfoAMD;
-
-    // ---- VK_NV_external_memory_win32 extension commands
+    {9349, offsetof(VkLayerDispatchTable, GetDeviceGroupSurfacePresentModesKHR)},
+    {9386, offsetof(VkLayerDispatchTable, GetDeviceImageMemoryRequirements)},
+    {9419, offsetof(VkLayerDispatchTable, GetDeviceImageMemoryRequirementsKHR)},
+    {9455, offsetof(VkLayerDispatchTable, GetDeviceImageSparseMemoryRequirements)},
+    {9494, offsetof(VkLayerDispatchTable, GetDeviceImageSparseMemoryRequirementsKHR)},
+    {9536, offsetof(VkLayerDispatchTable, GetDeviceMemoryCommitment)},
+    {9562, offsetof(VkLayerDispatchTable, GetDeviceMemoryOpaqueCaptureAddress)},
+    {9598, offsetof(VkLayerDispatchTable, GetDeviceMemoryOpaqueCaptureAddressKHR)},
+    {9637, offsetof(VkLayerDispatchTable, GetDeviceMicromapCompatibilityEXT)},
+    {9671, offsetof(VkLayerDispatchTable, GetDeviceProcAddr)},
+    {9689, offsetof(VkLayerDispatchTable, GetDeviceQueue)},
+    {9704, offsetof(VkLayerDispatchTable, GetDeviceQueue2)},
+    {9720, offsetof(VkLayerDispatchTable, GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI)},
+    {9766, offsetof(VkLayerDispatchTable, GetDynamicRenderingTilePropertiesQCOM)},
+    {9804, offsetof(VkLayerDispatchTable, GetEventStatus)},
+    {9819, offsetof(VkLayerDispatchTable, GetFenceFdKHR)},
+    {9833, offsetof(VkLayerDispatchTable, GetFenceStatus)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetMemoryWin32HandleNV")) return (void *)table->GetMemoryWin32HandleNV;
+    {9848, offsetof(VkLayerDispatchTable, GetFenceWin32HandleKHR)},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_EXT_conditional_rendering extension commands
-    if (!strcmp(name, "CmdBeginConditionalRenderingEXT")) return (void *)table->CmdBeginConditionalRenderingEXT;
-    if (!strcmp(name, "CmdEndConditionalRenderingEXT")) return (void *)table->CmdEndConditionalRenderingEXT;
-
-    // ---- VK_NV_clip_space_w_scaling extension commands
-    if (!strcmp(name, "CmdSetViewportWScalingNV")) return (void *)table->CmdSetViewportWScalingNV;
-
-    // ---- VK_EXT_display_control extension commands
-    if (!strcmp(name, "DisplayPowerControlEXT")) return (void *)table->DisplayPowerControlEXT;
-    if (!strcmp(name, "RegisterDeviceEventEXT")) return (void *)table->RegisterDeviceEventEXT;
-    if (!strcmp(name, "RegisterDisplayEventEXT")) return (void *)table->RegisterDisplayEventEXT;
-    if (!strcmp(name, "GetSwapchainCounterEXT")) return (void *)table->GetSwapchainCounterEXT;
-
-    // ---- VK_GOOGLE_display_timing extension commands
-    if (!strcmp(name, "GetRefreshCycleDurationGOOGLE")) return (void *)table->GetRefreshCycleDurationGOOGLE;
-    if (!strcmp(name, "GetPastPresentationTimingGOOGLE")) return (void *)table->GetPastPresentationTimingGOOGLE;
-
-    // ---- VK_EXT_discard_rectangles extension commands
-    if (!strcmp(name, "CmdSetDiscardRectangleEXT")) return (void *)table->CmdSetDiscardRectangleEXT;
-
-    // ---- VK_EXT_hdr_metadata extension commands
-    if (!strcmp(name, "SetHdrMetadataEXT")) return (void *)table->SetHdrMetadataEXT;
-
-    // ---- VK_EXT_debug_utils extension commands
-    if (!strcmp(name, "SetDebugUtilsObjectNameEXT")) return (void *)table->SetDebugUtilsObjectNameEXT;
-    if (!strcmp(name, "SetDebugUtilsObjectTagEXT")) return (void *)table->SetDebugUtilsObjectTagEXT;
-    if (!strcmp(name, "QueueBeginDebugUtilsLabelEXT")) return (void *)table->QueueBeginDebugUtilsLabelEXT;
-    if (!strcmp(name, "QueueEndDebugUtilsLabelEXT")) return (void *)table->QueueEndDebugUtilsLabelEXT;
-    if (!strcmp(name, "QueueInsertDebugUtilsLabelEXT")) return (void *)table->QueueInsertDebugUtilsLabelEXT;
-    if (!strcmp(name, "CmdBeginDebugUtilsLabelEXT")) return (void *)table->CmdBeginDebugUtilsLabelEXT;
-    if (!strcmp(name, "CmdEndDebugUtilsLabelEXT")) return (void *)table->CmdEndDebugUtilsLabelEXT;
-    if (!strcmp(name, "CmdInsertDebugUtilsLabelEXT")) return (void *)table->CmdInsertDebugUtilsLabelEXT;
-
-    // ---- VK_ANDROID_external_memory_android_hardware_buffer extension commands
+    {9871, offsetof(VkLayerDispatchTable, GetFramebufferTilePropertiesQCOM)},
+    {9904, offsetof(VkLayerDispatchTable, GetGeneratedCommandsMemoryRequirementsNV)},
+    {9945, offsetof(VkLayerDispatchTable, GetImageDrmFormatModifierPropertiesEXT)},
+    {9984, offsetof(VkLayerDispatchTable, GetImageMemoryRequirements)},
+    {10011, offsetof(VkLayerDispatchTable, GetImageMemoryRequirements2)},
+    {10039, offsetof(VkLayerDispatchTable, GetImageMemoryRequirements2KHR)},
+    {10070, offsetof(VkLayerDispatchTable, GetImageOpaqueCaptureDescriptorDataEXT)},
+    {10109, offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements)},
+    {10142, offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements2)},
+    {10176, offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements2KHR)},
+    {10213, offsetof(VkLayerDispatchTable, GetImageSubresourceLayout)},
+    {10239, offsetof(VkLayerDispatchTable, GetImageSubresourceLayout2EXT)},
+    {10269, offsetof(VkLayerDispatchTable, GetImageViewAddressNVX)},
+    {10292, offsetof(VkLayerDispatchTable, GetImageViewHandleNVX)},
+    {10314, offsetof(VkLayerDispatchTable, GetImageViewOpaqueCaptureDescriptorDataEXT)},
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-    if (!strcmp(name, "GetAndroidHardwareBufferPropertiesANDROID")) return (void *)table->GetAndroidHardwareBufferPropertiesANDROID;
+    {10357, offsetof(VkLayerDispatchTable, GetMemoryAndroidHardwareBufferANDROID)},
 #endif // VK_USE_PLATFORM_ANDROID_KHR
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-    if (!strcmp(name, "GetMemoryAndroidHardwareBufferANDROID")) return (void *)table->GetMemoryAndroidHardwareBufferANDROID;
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-
-    // ---- VK_EXT_sample_locations extension commands
-    if (!strcmp(name, "CmdSetSampleLocationsEXT")) return (void *)table->CmdSetSampleLocationsEXT;
-
-    // ---- VK_EXT_image_drm_format_modifier extension commands
-    if (!strcmp(name, "GetImageDrmFormatModifierPropertiesEXT")) return (void *)table->GetImageDrmFormatModifierPropertiesEXT;
-
-    // ---- VK_EXT_validation_cache extension commands
-    if (!strcmp(name, "CreateValidationCacheEXT")) return (void *)table->CreateValidationCacheEXT;
-    if (!strcmp(name, "DestroyValidationCacheEXT")) return (void *)table->DestroyValidationCacheEXT;
-    if (!strcmp(name, "MergeValidationCachesEXT")) return (void *)table->MergeValidationCachesEXT;
-    if (!strcmp(name, "GetValidationCacheDataEXT")) return (void *)table->GetValidationCacheDataEXT;
-
-    // ---- VK_NV_shading_rate_image extension commands
-    if (!strcmp(name, "CmdBindShadingRateImageNV")) return (void *)table->CmdBindShadingRateImageNV;
-    if (!strcmp(name, "CmdSetViewportShadingRatePaletteNV")) return (void *)table->CmdSetViewportShadingRatePaletteNV;
-    if (!strcmp(name, "CmdSetCoarseSampleOrderNV")) return (void *)table->CmdSetCoarseSampleOrderNV;
-
-    // ---- VK_NV_ray_tracing extension commands
-    if (!strcmp(name, "CreateAccelerationStructureNV")) return (void *)table->CreateAccelerationStructureNV;
-    if (!strcmp(name, "DestroyAccelerationStructureNV")) return (void *)table->DestroyAccelerationStructureNV;
-    if (!strcmp(name, "GetAccelerationStructureMemoryRequirementsNV")) return (void *)table->GetAccelerationStructureMemoryRequirementsNV;
-    if (!strcmp(name, "BindAccelerationStructureMemoryNV")) return (void *)table->BindAccelerationStructureMemoryNV;
-    if (!strcmp(name, "CmdBuildAccelerationStructureNV")) return (void *)table->CmdBuildAccelerationStructureNV;
-    if (!strcmp(name, "CmdCopyAccelerationStructureNV")) return (void *)table->CmdCopyAccelerationStructureNV;
-    if (!strcmp(name, "CmdTraceRaysNV")) return (void *)table->CmdTraceRaysNV;
-    if (!strcmp(name, "CreateRayTracingPipelinesNV")) return (void *)table->CreateRayTracingPipelinesNV;
-    if (!strcmp(name, "GetRayTracingShaderGroupHandlesKHR")) return (void *)table->GetRayTracingShaderGroupHandlesKHR;
-    if (!strcmp(name, "GetRayTracingShaderGroupHandlesNV")) return (void *)table->GetRayTracingShaderGroupHandlesNV;
-    if (!strcmp(name, "GetAccelerationStructureHandleNV")) return (void *)table->GetAccelerationStructureHandleNV;
-    if (!strcmp(name, "CmdWriteAccelerationStructuresPropertiesNV")) return (void *)table->CmdWriteAccelerationStructuresPropertiesNV;
-    if (!strcmp(name, "CompileDeferredNV")) return (void *)table->CompileDeferredNV;
-
-    // ---- VK_EXT_external_memory_host extension commands
-    if (!strcmp(name, "GetMemoryHostPointerPropertiesEXT")) return (void *)table->GetMemoryHostPointerPropertiesEXT;
-
-    // ---- VK_AMD_buffer_marker extension commands
-    if (!strcmp(name, "CmdWriteBufferMarkerAMD")) return (void *)table->CmdWriteBufferMarkerAMD;
-
-    // ---- VK_EXT_calibrated_timestamps extension commands
-    if (!strcmp(name, "GetCalibratedTimestampsEXT")) return (void *)table->GetCalibratedTimestampsEXT;
-
-    // ---- VK_NV_mesh_shader extension commands
-    if (!strcmp(name, "CmdDrawMeshTasksNV")) return (void *)table->CmdDrawMeshTasksNV;
-    if (!strcmp(name, "CmdDrawMeshTasksIndirectNV")) return (void *)table->CmdDrawMeshTasksIndirectNV;
-    if (!strcmp(name, "CmdDrawMeshTasksIndirectCountNV")) return (void *)table->CmdDrawMeshTasksIndirectCountNV;
-
-    // ---- VK_NV_scissor_exclusive extension commands
-    if (!strcmp(name, "CmdSetExclusiveScissorNV")) return (void *)table->CmdSetExclusiveScissorNV;
-
-    // ---- VK_NV_device_diagnostic_checkpoints extension commands
-    if (!strcmp(name, "CmdSetCheckpointNV")) return (void *)table->CmdSetCheckpointNV;
-    if (!strcmp(name, "GetQueueCheckpointDataNV")) return (void *)table->GetQueueCheckpointDataNV;
-
-    // ---- VK_INTEL_performance_query extension commands
-    if (!strcmp(name, "InitializePerformanceApiINTEL")) return (void *)table->InitializePerformanceApiINTEL;
-    if (!strcmp(name, "UninitializePerformanceApiINTEL")) return (void *)table->UninitializePerformanceApiINTEL;
-    if (!strcmp(name, "CmdSetPerformanceMarkerINTEL")) return (void *)table->CmdSetPerformanceMarkerINTEL;
-    if (!strcmp(name, "CmdSetPerformanceStreamMarkerINTEL")) return (void *)table->CmdSetPerformanceStreamMarkerINTEL;
-    if (!strcmp(name, "CmdSetPerformanceOverrideINTEL")) return (void *)table->CmdSetPerformanceOverrideINTEL;
-    if (!strcmp(name, "AcquirePerformanceConfigurationINTEL")) return (void *)table->AcquirePerformanceConfigurationINTEL;
-    if (!strcmp(name, "ReleasePerformanceConfigurationINTEL")) return (void *)table->ReleasePerformanceConfigurationINTEL;
-    if (!strcmp(name, "QueueSetPerformanceConfigurationINTEL")) return (void *)table->QueueSetPerformanceConfigurationINTEL;
-    if (!strcmp(name, "GetPerformanceParameterINTEL")) return (void *)table->GetPerformanceParameterINTEL;
-
-    // ---- VK_AMD_display_native_hdr extension commands
-    if (!strcmp(name, "SetLocalDimmingAMD")) return (void *)table->SetLocalDimmingAMD;
-
-    // ---- VK_EXT_buffer_device_address extension commands
-    if (!strcmp(name, "GetBufferDeviceAddressEXT")) return (void *)table->GetBufferDeviceAddressEXT;
-
-    // ---- VK_EXT_full_screen_exclusive extension commands
+    {10395, offsetof(VkLayerDispatchTable, GetMemoryFdKHR)},
+    {10410, offsetof(VkLayerDispatchTable, GetMemoryFdPropertiesKHR)},
+    {10435, offsetof(VkLayerDispatchTable, GetMemoryHostPointerPropertiesEXT)},
+    {10469, offsetof(VkLayerDispatchTable, GetMemoryRemoteAddressNV)},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "AcquireFullScreenExclusiveModeEXT")) return (void *)table->AcquireFullScreenExclusiveModeEXT;
+    {10494, offsetof(VkLayerDispatchTable, GetMemoryWin32HandleKHR)},
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "ReleaseFullScreenExclusiveModeEXT")) return (void *)table->ReleaseFullScreenExclusiveModeEXT;
+    {10518, offsetof(VkLayerDispatchTable, GetMemoryWin32HandleNV)},
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetDeviceGroupSurfacePresentModes2EXT")) return (void *)table->GetDeviceGroupSurfacePresentModes2EXT;
+    {10541, offsetof(VkLayerDispatchTable, GetMemoryWin32HandlePropertiesKHR)},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_EXT_line_rasterization extension commands
-    if (!strcmp(name, "CmdSetLineStippleEXT")) return (void *)table->CmdSetLineStippleEXT;
-
-    // ---- VK_EXT_host_query_reset extension commands
-    if (!strcmp(name, "ResetQueryPoolEXT")) return (void *)table->ResetQueryPoolEXT;
-
-    // ---- VK_EXT_extended_dynamic_state extension commands
-    if (!strcmp(name, "CmdSetCullModeEXT")) return (void *)table->CmdSetCullModeEXT;
-    if (!strcmp(name, "CmdSetFrontFaceEXT")) return (void *)table->CmdSetFrontFaceEXT;
-    if (!strcmp(name, "CmdSetPrimitiveTopologyEXT")) return (void *)table->CmdSetPrimitiveTopologyEXT;
-    if (!strcmp(name, "CmdSetViewportWithCountEXT")) return (void *)table->CmdSetViewportWithCountEXT;
-    if (!strcmp(name, "CmdSetScissorWithCountEXT")) return (void *)table->CmdSetScissorWithCountEXT;
-    if (!strcmp(name, "CmdBindVertexBuffers2EXT")) return (void *)table->CmdBindVertexBuffers2EXT;
-    if (!strcmp(name, "CmdSetDepthTestEnableEXT")) return (void *)table->CmdSetDepthTestEnableEXT;
-    if (!strcmp(name, "CmdSetDepthWriteEnableEXT")) return (void *)table->CmdSetDepthWriteEnableEXT;
-    if (!strcmp(name, "CmdSetDepthCompareOpEXT")) return (void *)table->CmdSetDepthCompareOpEXT;
-    if (!strcmp(name, "CmdSetDepthBoundsTestEnableEXT")) return (void *)table->CmdSetDepthBoundsTestEnableEXT;
-    if (!strcmp(name, "CmdSetStencilTestEnableEXT")) return (void *)table->CmdSetStencilTestEnableEXT;
-    if (!strcmp(name, "CmdSetStencilOpEXT")) return (void *)table->CmdSetStencilOpEXT;
-
-    // ---- VK_NV_device_generated_commands extension commands
-    if (!strcmp(name, "GetGeneratedCommandsMemoryRequirementsNV")) return (void *)table->GetGeneratedCommandsMemoryRequirementsNV;
-    if (!strcmp(name, "CmdPreprocessGeneratedCommandsNV")) return (void *)table->CmdPreprocessGeneratedCommandsNV;
-    if (!strcmp(name, "CmdExecuteGeneratedCommandsNV")) return (void *)table->CmdExecuteGeneratedCommandsNV;
-    if (!strcmp(name, "CmdBindPipelineShaderGroupNV")) return (void *)table->CmdBindPipelineShaderGroupNV;
-    if (!strcmp(name, "CreateIndirectCommandsLayoutNV")) return (void *)table->CreateIndirectCommandsLayoutNV;
-    if (!strcmp(name, "DestroyIndirectCommandsLayoutNV")) return (void *)table->DestroyIndirectCommandsLayoutNV;
-
-    // ---- VK_EXT_private_data extension commands
-    if (!strcmp(name, "CreatePrivateDataSlotEXT")) return (void *)table->CreatePrivateDataSlotEXT;
-    if (!strcmp(name, "DestroyPrivateDataSlotEXT")) return (void *)table->DestroyPrivateDataSlotEXT;
-    if (!strcmp(name, "SetPrivateDataEXT")) return (void *)table->SetPrivateDataEXT;
-    if (!strcmp(name, "GetPrivateDataEXT")) return (void *)table->GetPrivateDataEXT;
-
-    // ---- VK_EXT_metal_objects extension commands
-#ifdef VK_USE_PLATFORM_METAL_EXT
-    if (!strcmp(name, "ExportMetalObjectsEXT")) return (void *)table->ExportMetalObjectsEXT;
-#endif // VK_USE_PLATFORM_METAL_EXT
-
-    // ---- VK_EXT_descriptor_buffer extension commands
-    if (!strcmp(name, "GetDescriptorSetLayoutSizeEXT")) return (void *)table->GetDescriptorSetLayoutSizeEXT;
-    if (!strcmp(name, "GetDescriptorSetLayoutBindingOffsetEXT")) return (void *)table->GetDescriptorSetLayoutBindingOffsetEXT;
-    if (!strcmp(name, "GetDescriptorEXT")) return (void *)table->GetDescriptorEXT;
-    if (!strcmp(name, "CmdBindDescriptorBuffersEXT")) return (void *)table->CmdBindDescriptorBuffersEXT;
-    if (!strcmp(name, "CmdSetDescriptorBufferOffsetsEXT")) return (void *)table->CmdSetDescriptorBufferOffsetsEXT;
-    if (!strcmp(name, "CmdBindDescriptorBufferEmbeddedSamplersEXT")) return (void *)table->CmdBindDescriptorBufferEmbeddedSamplersEXT;
-    if (!strcmp(name, "GetBufferOpaqueCaptureDescriptorDataEXT")) return (void *)table->GetBufferOpaqueCaptureDescriptorDataEXT;
-    if (!strcmp(name, "GetImageOpaqueCaptureDescriptorDataEXT")) return (void *)table->GetImageOpaqueCaptureDescriptorDataEXT;
-    if (!strcmp(name, "GetImageViewOpaqueCaptureDescriptorDataEXT")) return (void *)table->GetImageViewOpaqueCaptureDescriptorDataEXT;
-    if (!strcmp(name, "GetSamplerOpaqueCaptureDescriptorDataEXT")) return (void *)table->GetSamplerOpaqueCaptureDescriptorDataEXT;
-    if (!strcmp(name, "GetAccelerationStructureOpaqueCaptureDescriptorDataEXT")) return (void *)table->GetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
-
-    // ---- VK_NV_fragment_shading_rate_enums extension commands
-    if (!strcmp(name, "CmdSetFragmentShadingRateEnumNV")) return (void *)table->CmdSetFragmentShadingRateEnumNV;
-
-    // ---- VK_EXT_image_compression_control extension commands
-    if (!strcmp(name, "GetImageSubresourceLayout2EXT")) return (void *)table->GetImageSubresourceLayout2EXT;
-
-    // ---- VK_EXT_device_fault extension commands
-    if (!strcmp(name, "GetDeviceFaultInfoEXT")) return (void *)table->GetDeviceFaultInfoEXT;
-
-    // ---- VK_EXT_vertex_input_dynamic_state extension commands
-    if (!strcmp(name, "CmdSetVertexInputEXT")) return (void *)table->CmdSetVertexInputEXT;
-
-    // ---- VK_FUCHSIA_external_memory extension commands
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "GetMemoryZirconHandleFUCHSIA")) return (void *)table->GetMemoryZirconHandleFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "GetMemoryZirconHandlePropertiesFUCHSIA")) return (void *)table->GetMemoryZirconHandlePropertiesFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_FUCHSIA_external_semaphore extension commands
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "ImportSemaphoreZirconHandleFUCHSIA")) return (void *)table->ImportSemaphoreZirconHandleFUCHSIA;
+    {10575, offsetof(VkLayerDispatchTable, GetMemoryZirconHandleFUCHSIA)},
 #endif // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "GetSemaphoreZirconHandleFUCHSIA")) return (void *)table->GetSemaphoreZirconHandleFUCHSIA;
-#endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_FUCHSIA_buffer_collection extension commands
-#ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "CreateBufferCollectionFUCHSIA")) return (void *)table->CreateBufferCollectionFUCHSIA;
+    {10604, offsetof(VkLayerDispatchTable, GetMemoryZirconHandlePropertiesFUCHSIA)},
 #endif // VK_USE_PLATFORM_FUCHSIA
+    {10643, offsetof(VkLayerDispatchTable, GetMicromapBuildSizesEXT)},
+    {10668, offsetof(VkLayerDispatchTable, GetPastPresentationTimingGOOGLE)},
+    {10700, offsetof(VkLayerDispatchTable, GetPerformanceParameterINTEL)},
+    {10729, offsetof(VkLayerDispatchTable, GetPipelineCacheData)},
+    {10750, offsetof(VkLayerDispatchTable, GetPipelineExecutableInternalRepresentationsKHR)},
+    {10798, offsetof(VkLayerDispatchTable, GetPipelineExecutablePropertiesKHR)},
+    {10833, offsetof(VkLayerDispatchTable, GetPipelineExecutableStatisticsKHR)},
+    {10868, offsetof(VkLayerDispatchTable, GetPipelinePropertiesEXT)},
+    {10893, offsetof(VkLayerDispatchTable, GetPrivateData)},
+    {10908, offsetof(VkLayerDispatchTable, GetPrivateDataEXT)},
+    {10926, offsetof(VkLayerDispatchTable, GetQueryPoolResults)},
+    {10946, offsetof(VkLayerDispatchTable, GetQueueCheckpointData2NV)},
+    {10972, offsetof(VkLayerDispatchTable, GetQueueCheckpointDataNV)},
+    {10997, offsetof(VkLayerDispatchTable, GetRayTracingCaptureReplayShaderGroupHandlesKHR)},
+    {11045, offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupHandlesKHR)},
+    {11080, offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupHandlesNV)},
+    {11114, offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupStackSizeKHR)},
+    {11151, offsetof(VkLayerDispatchTable, GetRefreshCycleDurationGOOGLE)},
+    {11181, offsetof(VkLayerDispatchTable, GetRenderAreaGranularity)},
+    {11206, offsetof(VkLayerDispatchTable, GetSamplerOpaqueCaptureDescriptorDataEXT)},
+    {11247, offsetof(VkLayerDispatchTable, GetSemaphoreCounterValue)},
+    {11272, offsetof(VkLayerDispatchTable, GetSemaphoreCounterValueKHR)},
+    {11300, offsetof(VkLayerDispatchTable, GetSemaphoreFdKHR)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {11318, offsetof(VkLayerDispatchTable, GetSemaphoreWin32HandleKHR)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "SetBufferCollectionImageConstraintsFUCHSIA")) return (void *)table->SetBufferCollectionImageConstraintsFUCHSIA;
+    {11345, offsetof(VkLayerDispatchTable, GetSemaphoreZirconHandleFUCHSIA)},
 #endif // VK_USE_PLATFORM_FUCHSIA
+    {11377, offsetof(VkLayerDispatchTable, GetShaderInfoAMD)},
+    {11394, offsetof(VkLayerDispatchTable, GetShaderModuleCreateInfoIdentifierEXT)},
+    {11433, offsetof(VkLayerDispatchTable, GetShaderModuleIdentifierEXT)},
+    {11462, offsetof(VkLayerDispatchTable, GetSwapchainCounterEXT)},
+    {11485, offsetof(VkLayerDispatchTable, GetSwapchainImagesKHR)},
+    {11507, offsetof(VkLayerDispatchTable, GetSwapchainStatusKHR)},
+    {11529, offsetof(VkLayerDispatchTable, GetValidationCacheDataEXT)},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {11555, offsetof(VkLayerDispatchTable, GetVideoSessionMemoryRequirementsKHR)},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+    {11592, offsetof(VkLayerDispatchTable, ImportFenceFdKHR)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {11609, offsetof(VkLayerDispatchTable, ImportFenceWin32HandleKHR)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {11635, offsetof(VkLayerDispatchTable, ImportSemaphoreFdKHR)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {11656, offsetof(VkLayerDispatchTable, ImportSemaphoreWin32HandleKHR)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "SetBufferCollectionBufferConstraintsFUCHSIA")) return (void *)table->SetBufferCollectionBufferConstraintsFUCHSIA;
+    {11686, offsetof(VkLayerDispatchTable, ImportSemaphoreZirconHandleFUCHSIA)},
 #endif // VK_USE_PLATFORM_FUCHSIA
+    {11721, offsetof(VkLayerDispatchTable, InitializePerformanceApiINTEL)},
+    {11751, offsetof(VkLayerDispatchTable, InvalidateMappedMemoryRanges)},
+    {11780, offsetof(VkLayerDispatchTable, MapMemory)},
+    {11790, offsetof(VkLayerDispatchTable, MergePipelineCaches)},
+    {11810, offsetof(VkLayerDispatchTable, MergeValidationCachesEXT)},
+    {11835, offsetof(VkLayerDispatchTable, QueueBeginDebugUtilsLabelEXT)},
+    {11864, offsetof(VkLayerDispatchTable, QueueBindSparse)},
+    {11880, offsetof(VkLayerDispatchTable, QueueEndDebugUtilsLabelEXT)},
+    {11907, offsetof(VkLayerDispatchTable, QueueInsertDebugUtilsLabelEXT)},
+    {11937, offsetof(VkLayerDispatchTable, QueuePresentKHR)},
+    {11953, offsetof(VkLayerDispatchTable, QueueSetPerformanceConfigurationINTEL)},
+    {11991, offsetof(VkLayerDispatchTable, QueueSubmit)},
+    {12003, offsetof(VkLayerDispatchTable, QueueSubmit2)},
+    {12016, offsetof(VkLayerDispatchTable, QueueSubmit2KHR)},
+    {12032, offsetof(VkLayerDispatchTable, QueueWaitIdle)},
+    {12046, offsetof(VkLayerDispatchTable, RegisterDeviceEventEXT)},
+    {12069, offsetof(VkLayerDispatchTable, RegisterDisplayEventEXT)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {12093, offsetof(VkLayerDispatchTable, ReleaseFullScreenExclusiveModeEXT)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {12127, offsetof(VkLayerDispatchTable, ReleasePerformanceConfigurationINTEL)},
+    {12164, offsetof(VkLayerDispatchTable, ReleaseProfilingLockKHR)},
+    {12188, offsetof(VkLayerDispatchTable, ResetCommandBuffer)},
+    {12207, offsetof(VkLayerDispatchTable, ResetCommandPool)},
+    {12224, offsetof(VkLayerDispatchTable, ResetDescriptorPool)},
+    {12244, offsetof(VkLayerDispatchTable, ResetEvent)},
+    {12255, offsetof(VkLayerDispatchTable, ResetFences)},
+    {12267, offsetof(VkLayerDispatchTable, ResetQueryPool)},
+    {12282, offsetof(VkLayerDispatchTable, ResetQueryPoolEXT)},
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "DestroyBufferCollectionFUCHSIA")) return (void *)table->DestroyBufferCollectionFUCHSIA;
+    {12300, offsetof(VkLayerDispatchTable, SetBufferCollectionBufferConstraintsFUCHSIA)},
 #endif // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "GetBufferCollectionPropertiesFUCHSIA")) return (void *)table->GetBufferCollectionPropertiesFUCHSIA;
+    {12344, offsetof(VkLayerDispatchTable, SetBufferCollectionImageConstraintsFUCHSIA)},
 #endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_HUAWEI_subpass_shading extension commands
-    if (!strcmp(name, "GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI")) return (void *)table->GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
-    if (!strcmp(name, "CmdSubpassShadingHUAWEI")) return (void *)table->CmdSubpassShadingHUAWEI;
-
-    // ---- VK_HUAWEI_invocation_mask extension commands
-    if (!strcmp(name, "CmdBindInvocationMaskHUAWEI")) return (void *)table->CmdBindInvocationMaskHUAWEI;
-
-    // ---- VK_NV_external_memory_rdma extension commands
-    if (!strcmp(name, "GetMemoryRemoteAddressNV")) return (void *)table->GetMemoryRemoteAddressNV;
-
-    // ---- VK_EXT_pipeline_properties extension commands
-    if (!strcmp(name, "GetPipelinePropertiesEXT")) return (void *)table->GetPipelinePropertiesEXT;
-
-    // ---- VK_EXT_extended_dynamic_state2 extension commands
-    if (!strcmp(name, "CmdSetPatchControlPointsEXT")) return (void *)table->CmdSetPatchControlPointsEXT;
-    if (!strcmp(name, "CmdSetRasterizerDiscardEnableEXT")) return (void *)table->CmdSetRasterizerDiscardEnableEXT;
-    if (!strcmp(name, "CmdSetDepthBiasEnableEXT")) return (void *)table->CmdSetDepthBiasEnableEXT;
-    if (!strcmp(name, "CmdSetLogicOpEXT")) return (void *)table->CmdSetLogicOpEXT;
-    if (!strcmp(name, "CmdSetPrimitiveRestartEnableEXT")) return (void *)table->CmdSetPrimitiveRestartEnableEXT;
-
-    // ---- VK_EXT_color_write_enable extension commands
-    if (!strcmp(name, "CmdSetColorWriteEnableEXT")) return (void *)table->CmdSetColorWriteEnableEXT;
-
-    // ---- VK_EXT_multi_draw extension commands
-    if (!strcmp(name, "CmdDrawMultiEXT")) return (void *)table->CmdDrawMultiEXT;
-    if (!strcmp(name, "CmdDrawMultiIndexedEXT")) return (void *)table->CmdDrawMultiIndexedEXT;
-
-    // ---- VK_EXT_opacity_micromap extension commands
-    if (!strcmp(name, "CreateMicromapEXT")) return (void *)table->CreateMicromapEXT;
-    if (!strcmp(name, "DestroyMicromapEXT")) return (void *)table->DestroyMicromapEXT;
-    if (!strcmp(name, "CmdBuildMicromapsEXT")) return (void *)table->CmdBuildMicromapsEXT;
-    if (!strcmp(name, "BuildMicromapsEXT")) return (void *)table->BuildMicromapsEXT;
-    if (!strcmp(name, "CopyMicromapEXT")) return (void *)table->CopyMicromapEXT;
-    if (!strcmp(name, "CopyMicromapToMemoryEXT")) return (void *)table->CopyMicromapToMemoryEXT;
-    if (!strcmp(name, "CopyMemoryToMicromapEXT")) return (void *)table->CopyMemoryToMicromapEXT;
-    if (!strcmp(name, "WriteMicromapsPropertiesEXT")) return (void *)table->WriteMicromapsPropertiesEXT;
-    if (!strcmp(name, "CmdCopyMicromapEXT")) return (void *)table->CmdCopyMicromapEXT;
-    if (!strcmp(name, "CmdCopyMicromapToMemoryEXT")) return (void *)table->CmdCopyMicromapToMemoryEXT;
-    if (!strcmp(name, "CmdCopyMemoryToMicromapEXT")) return (void *)table->CmdCopyMemoryToMicromapEXT;
-    if (!strcmp(name, "CmdWriteMicromapsPropertiesEXT")) return (void *)table->CmdWriteMicromapsPropertiesEXT;
-    if (!strcmp(name, "GetDeviceMicromapCompatibilityEXT")) return (void *)table->GetDeviceMicromapCompatibilityEXT;
-    if (!strcmp(name, "GetMicromapBuildSizesEXT")) return (void *)table->GetMicromapBuildSizesEXT;
-
-    // ---- VK_EXT_pageable_device_local_memory extension commands
-    if (!strcmp(name, "SetDeviceMemoryPriorityEXT")) return (void *)table->SetDeviceMemoryPriorityEXT;
-
-    // ---- VK_VALVE_descriptor_set_host_mapping extension commands
-    if (!strcmp(name, "GetDescriptorSetLayoutHostMappingInfoVALVE")) return (void *)table->GetDescriptorSetLayoutHostMappingInfoVALVE;
-    if (!strcmp(name, "GetDescriptorSetHostMappingVALVE")) return (void *)table->GetDescriptorSetHostMappingVALVE;
-
-    // ---- VK_NV_copy_memory_indirect extension commands
-    if (!strcmp(name, "CmdCopyMemoryIndirectNV")) return (void *)table->CmdCopyMemoryIndirectNV;
-    if (!strcmp(name, "CmdCopyMemoryToImageIndirectNV")) return (void *)table->CmdCopyMemoryToImageIndirectNV;
-
-    // ---- VK_NV_memory_decompression extension commands
-    if (!strcmp(name, "CmdDecompressMemoryNV")) return (void *)table->CmdDecompressMemoryNV;
-    if (!strcmp(name, "CmdDecompressMemoryIndirectCountNV")) return (void *)table->CmdDecompressMemoryIndirectCountNV;
-
-    // ---- VK_EXT_extended_dynamic_state3 extension commands
-    if (!strcmp(name, "CmdSetTessellationDomainOriginEXT")) return (void *)table->CmdSetTessellationDomainOriginEXT;
-    if (!strcmp(name, "CmdSetDepthClampEnableEXT")) return (void *)table->CmdSetDepthClampEnableEXT;
-    if (!strcmp(name, "CmdSetPolygonModeEXT")) return (void *)table->CmdSetPolygonModeEXT;
-    if (!strcmp(name, "CmdSetRasterizationSamplesEXT")) return (void *)table->CmdSetRasterizationSamplesEXT;
-    if (!strcmp(name, "CmdSetSampleMaskEXT")) return (void *)table->CmdSetSampleMaskEXT;
-    if (!strcmp(name, "CmdSetAlphaToCoverageEnableEXT")) return (void *)table->CmdSetAlphaToCoverageEnableEXT;
-    if (!strcmp(name, "CmdSetAlphaToOneEnableEXT")) return (void *)table->CmdSetAlphaToOneEnableEXT;
-    if (!strcmp(name, "CmdSetLogicOpEnableEXT")) return (void *)table->CmdSetLogicOpEnableEXT;
-    if (!strcmp(name, "CmdSetColorBlendEnableEXT")) return (void *)table->CmdSetColorBlendEnableEXT;
-    if (!strcmp(name, "CmdSetColorBlendEquationEXT")) return (void *)table->CmdSetColorBlendEquationEXT;
-    if (!strcmp(name, "CmdSetColorWriteMaskEXT")) return (void *)table->CmdSetColorWriteMaskEXT;
-    if (!strcmp(name, "CmdSetRasterizationStreamEXT")) return (void *)table->CmdSetRasterizationStreamEXT;
-    if (!strcmp(name, "CmdSetConservativeRasterizationModeEXT")) return (void *)table->CmdSetConservativeRasterizationModeEXT;
-    if (!strcmp(name, "CmdSetExtraPrimitiveOverestimationSizeEXT")) return (void *)table->CmdSetExtraPrimitiveOverestimationSizeEXT;
-    if (!strcmp(name, "CmdSetDepthClipEnableEXT")) return (void *)table->CmdSetDepthClipEnableEXT;
-    if (!strcmp(name, "CmdSetSampleLocationsEnableEXT")) return (void *)table->CmdSetSampleLocationsEnableEXT;
-    if (!strcmp(name, "CmdSetColorBlendAdvancedEXT")) return (void *)table->CmdSetColorBlendAdvancedEXT;
-    if (!strcmp(name, "CmdSetProvokingVertexModeEXT")) return (void *)table->CmdSetProvokingVertexModeEXT;
-    if (!strcmp(name, "CmdSetLineRasterizationModeEXT")) return (void *)table->CmdSetLineRasterizationModeEXT;
-    if (!strcmp(name, "CmdSetLineStippleEnableEXT")) return (void *)table->CmdSetLineStippleEnableEXT;
-    if (!strcmp(name, "CmdSetDepthClipNegativeOneToOneEXT")) return (void *)table->CmdSetDepthClipNegativeOneToOneEXT;
-    if (!strcmp(name, "CmdSetViewportWScalingEnableNV")) return (void *)table->CmdSetViewportWScalingEnableNV;
-    if (!strcmp(name, "CmdSetViewportSwizzleNV")) return (void *)table->CmdSetViewportSwizzleNV;
-    if (!strcmp(name, "CmdSetCoverageToColorEnableNV")) return (void *)table->CmdSetCoverageToColorEnableNV;
-    if (!strcmp(name, "CmdSetCoverageToColorLocationNV")) return (void *)table->CmdSetCoverageToColorLocationNV;
-    if (!strcmp(name, "CmdSetCoverageModulationModeNV")) return (void *)table->CmdSetCoverageModulationModeNV;
-    if (!strcmp(name, "CmdSetCoverageModulationTableEnableNV")) return (void *)table->CmdSetCoverageModulationTableEnableNV;
-    if (!strcmp(name, "CmdSetCoverageModulationTableNV")) return (void *)table->CmdSetCoverageModulationTableNV;
-    if (!strcmp(name, "CmdSetShadingRateImageEnableNV")) return (void *)table->CmdSetShadingRateImageEnableNV;
-    if (!strcmp(name, "CmdSetRepresentativeFragmentTestEnableNV")) return (void *)table->CmdSetRepresentativeFragmentTestEnableNV;
-    if (!strcmp(name, "CmdSetCoverageReductionModeNV")) return (void *)table->CmdSetCoverageReductionModeNV;
-
-    // ---- VK_EXT_shader_module_identifier extension commands
-    if (!strcmp(name, "GetShaderModuleIdentifierEXT")) return (void *)table->GetShaderModuleIdentifierEXT;
-    if (!strcmp(name, "GetShaderModuleCreateInfoIdentifierEXT")) return (void *)table->GetShaderModuleCreateInfoIdentifierEXT;
-
-    // ---- VK_NV_optical_flow extension commands
-    if (!strcmp(name, "CreateOpticalFlowSessionNV")) return (void *)table->CreateOpticalFlowSessionNV;
-    if (!strcmp(name, "DestroyOpticalFlowSessionNV")) return (void *)table->DestroyOpticalFlowSessionNV;
-    if (!strcmp(name, "BindOpticalFlowSessionImageNV")) return (void *)table->BindOpticalFlowSessionImageNV;
-    if (!strcmp(name, "CmdOpticalFlowExecuteNV")) return (void *)table->CmdOpticalFlowExecuteNV;
-
-    // ---- VK_QCOM_tile_properties extension commands
-    if (!strcmp(name, "GetFramebufferTilePropertiesQCOM")) return (void *)table->GetFramebufferTilePropertiesQCOM;
-    if (!strcmp(name, "GetDynamicRenderingTilePropertiesQCOM")) return (void *)table->GetDynamicRenderingTilePropertiesQCOM;
-
-    // ---- VK_KHR_acceleration_structure extension commands
-    if (!strcmp(name, "CreateAccelerationStructureKHR")) return (void *)table->CreateAccelerationStructureKHR;
-    if (!strcmp(name, "DestroyAccelerationStructureKHR")) return (void *)table->DestroyAccelerationStructureKHR;
-    if (!strcmp(name, "CmdBuildAccelerationStructuresKHR")) return (void *)table->CmdBuildAccelerationStructuresKHR;
-    if (!strcmp(name, "CmdBuildAccelerationStructuresIndirectKHR")) return (void *)table->CmdBuildAccelerationStructuresIndirectKHR;
-    if (!strcmp(name, "BuildAccelerationStructuresKHR")) return (void *)table->BuildAccelerationStructuresKHR;
-    if (!strcmp(name, "CopyAccelerationStructureKHR")) return (void *)table->CopyAccelerationStructureKHR;
-    if (!strcmp(name, "CopyAccelerationStructureToMemoryKHR")) return (void *)table->CopyAccelerationStructureToMemoryKHR;
-    if (!strcmp(name, "CopyMemoryToAccelerationStructureKHR")) return (void *)table->CopyMemoryToAccelerationStructureKHR;
-    if (!strcmp(name, "WriteAccelerationStructuresPropertiesKHR")) return (void *)table->WriteAccelerationStructuresPropertiesKHR;
-    if (!strcmp(name, "CmdCopyAccelerationStructureKHR")) return (void *)table->CmdCopyAccelerationStructureKHR;
-    if (!strcmp(name, "CmdCopyAccelerationStructureToMemoryKHR")) return (void *)table->CmdCopyAccelerationStructureToMemoryKHR;
-    if (!strcmp(name, "CmdCopyMemoryToAccelerationStructureKHR")) return (void *)table->CmdCopyMemoryToAccelerationStructureKHR;
-    if (!strcmp(name, "GetAccelerationStructureDeviceAddressKHR")) return (void *)table->GetAccelerationStructureDeviceAddressKHR;
-    if (!strcmp(name, "CmdWriteAccelerationStructuresPropertiesKHR")) return (void *)table->CmdWriteAccelerationStructuresPropertiesKHR;
-    if (!strcmp(name, "GetDeviceAccelerationStructureCompatibilityKHR")) return (void *)table->GetDeviceAccelerationStructureCompatibilityKHR;
-    if (!strcmp(name, "GetAccelerationStructureBuildSizesKHR")) return (void *)table->GetAccelerationStructureBuildSizesKHR;
-
-    // ---- VK_KHR_ray_tracing_pipeline extension commands
-    if (!strcmp(name, "CmdTraceRaysKHR")) return (void *)table->CmdTraceRaysKHR;
-    if (!strcmp(name, "CreateRayTracingPipelinesKHR")) return (void *)table->CreateRayTracingPipelinesKHR;
-    if (!strcmp(name, "GetRayTracingCaptureReplayShaderGroupHandlesKHR")) return (void *)table->GetRayTracingCaptureReplayShaderGroupHandlesKHR;
-    if (!strcmp(name, "CmdTraceRaysIndirectKHR")) return (void *)table->CmdTraceRaysIndirectKHR;
-    if (!strcmp(name, "GetRayTracingShaderGroupStackSizeKHR")) return (void *)table->GetRayTracingShaderGroupStackSizeKHR;
-    if (!strcmp(name, "CmdSetRayTracingPipelineStackSizeKHR")) return (void *)table->CmdSetRayTracingPipelineStackSizeKHR;
-
-    // ---- VK_EXT_mesh_shader extension commands
-    if (!strcmp(name, "CmdDrawMeshTasksEXT")) return (void *)table->CmdDrawMeshTasksEXT;
-    if (!strcmp(name, "CmdDrawMeshTasksIndirectEXT")) return (void *)table->CmdDrawMeshTasksIndirectEXT;
-    if (!strcmp(name, "CmdDrawMeshTasksIndirectCountEXT")) return (void *)table->CmdDrawMeshTasksIndirectCountEXT;
-
-    return NULL;
-}
-
-// Instance command lookup function
-VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,
-                                                                 bool *found_name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') {
-        *found_name = false;
-        return NULL;
-    }
-
-    *found_name = true;
-    name += 2;
-
-    // ---- Core 1_0 commands
-    if (!strcmp(name, "DestroyInstance")) return (void *)table->DestroyInstance;
-    if (!strcmp(name, "EnumeratePhysicalDevices")) return (void *)table->EnumeratePhysicalDevices;
-    if (!strcmp(name, "GetPhysicalDeviceFeatures")) return (void *)table->GetPhysicalDeviceFeatures;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties")) return (void *)table->GetPhysicalDeviceFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties")) return (void *)table->GetPhysicalDeviceImageFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceProperties")) return (void *)table->GetPhysicalDeviceProperties;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties")) return (void *)table->GetPhysicalDeviceQueueFamilyProperties;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties")) return (void *)table->GetPhysicalDeviceMemoryProperties;
-    if (!strcmp(name, "GetInstanceProcAddr")) return (void *)table->GetInstanceProcAddr;
-    if (!strcmp(name, "EnumerateDeviceExtensionProperties")) return (void *)table->EnumerateDeviceExtensionProperties;
-    if (!strcmp(name, "EnumerateDeviceLayerProperties")) return (void *)table->EnumerateDeviceLayerProperties;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties")) return (void *)table->GetPhysicalDeviceSparseImageFormatProperties;
-
-    // ---- Core 1_1 commands
-    if (!strcmp(name, "EnumeratePhysicalDeviceGroups")) return (void *)table->EnumeratePhysicalDeviceGroups;
-    if (!strcmp(name, "GetPhysicalDeviceFeatures2")) return (void *)table->GetPhysicalDeviceFeatures2;
-    if (!strcmp(name, "GetPhysicalDeviceProperties2")) return (void *)table->GetPhysicalDeviceProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties2")) return (void *)table->GetPhysicalDeviceFormatProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties2")) return (void *)table->GetPhysicalDeviceImageFormatProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties2")) return (void *)table->GetPhysicalDeviceQueueFamilyProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties2")) return (void *)table->GetPhysicalDeviceMemoryProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties2")) return (void *)table->GetPhysicalDeviceSparseImageFormatProperties2;
-    if (!strcmp(name, "GetPhysicalDeviceExternalBufferProperties")) return (void *)table->GetPhysicalDeviceExternalBufferProperties;
-    if (!strcmp(name, "GetPhysicalDeviceExternalFenceProperties")) return (void *)table->GetPhysicalDeviceExternalFenceProperties;
-    if (!strcmp(name, "GetPhysicalDeviceExternalSemaphoreProperties")) return (void *)table->GetPhysicalDeviceExternalSemaphoreProperties;
-
-    // ---- Core 1_3 commands
-    if (!strcmp(name, "GetPhysicalDeviceToolProperties")) return (void *)table->GetPhysicalDeviceToolProperties;
-
-    // ---- VK_KHR_surface extension commands
-    if (!strcmp(name, "DestroySurfaceKHR")) return (void *)table->DestroySurfaceKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceSupportKHR")) return (void *)table->GetPhysicalDeviceSurfaceSupportKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceCapabilitiesKHR")) return (void *)table->GetPhysicalDeviceSurfaceCapabilitiesKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceFormatsKHR")) return (void *)table->GetPhysicalDeviceSurfaceFormatsKHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfacePresentModesKHR")) return (void *)table->GetPhysicalDeviceSurfacePresentModesKHR;
-
-    // ---- VK_KHR_swapchain extension commands
-    if (!strcmp(name, "GetPhysicalDevicePresentRectanglesKHR")) return (void *)table->GetPhysicalDevicePresentRectanglesKHR;
-
-    // ---- VK_KHR_display extension commands
-    if (!strcmp(name, "GetPhysicalDeviceDisplayPropertiesKHR")) return (void *)table->GetPhysicalDeviceDisplayPropertiesKHR;
-    if (!strcmp(name, "GetPhysicalDeviceDisplayPlanePropertiesKHR")) return (void *)table->GetPhysicalDeviceDisplayPlanePropertiesKHR;
-    if (!strcmp(name, "GetDisplayPlaneSupportedDisplaysKHR")) return (void *)table->GetDisplayPlaneSupportedDisplaysKHR;
-    if (!strcmp(name, "GetDisplayModePropertiesKHR")) return (void *)table->GetDisplayModePropertiesKHR;
-    if (!strcmp(name, "CreateDisplayModeKHR")) return (void *)table->CreateDisplayModeKHR;
-    if (!strcmp(name, "GetDisplayPlaneCapabilitiesKHR")) return (void *)table->GetDisplayPlaneCapabilitiesKHR;
-    if (!strcmp(name, "CreateDisplayPlaneSurfaceKHR")) return (void *)table->CreateDisplayPlaneSurfaceKHR;
-
-    // ---- VK_KHR_xlib_surface extension commands
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-    if (!strcmp(name, "CreateXlibSurfaceKHR")) return (void *)table->CreateXlibSurfaceKHR;
-#endif // VK_USE_PLATFORM_XLIB_KHR
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-    if (!strcmp(name, "GetPhysicalDeviceXlibPresentationSupportKHR")) return (void *)table->GetPhysicalDeviceXlibPresentationSupportKHR;
-#endif // VK_USE_PLATFORM_XLIB_KHR
-
-    // ---- VK_KHR_xcb_surface extension commands
-#ifdef VK_USE_PLATFORM_XCB_KHR
-    if (!strcmp(name, "CreateXcbSurfaceKHR")) return (void *)table->CreateXcbSurfaceKHR;
-#endif // VK_USE_PLATFORM_XCB_KHR
-#ifdef VK_USE_PLATFORM_XCB_KHR
-    if (!strcmp(name, "GetPhysicalDeviceXcbPresentationSupportKHR")) return (void *)table->GetPhysicalDeviceXcbPresentationSupportKHR;
-#endif // VK_USE_PLATFORM_XCB_KHR
-
-    // ---- VK_KHR_wayland_surface extension commands
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    if (!strcmp(name, "CreateWaylandSurfaceKHR")) return (void *)table->CreateWaylandSurfaceKHR;
-#endif // VK_USE_PLATFORM_WAYLAND_KHR
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    if (!strcmp(name, "GetPhysicalDeviceWaylandPresentationSupportKHR")) return (void *)table->GetPhysicalDeviceWaylandPresentationSupportKHR;
-#endif // VK_USE_PLATFORM_WAYLAND_KHR
-
-    // ---- VK_KHR_android_surface extension commands
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-    if (!strcmp(name, "CreateAndroidSurfaceKHR")) return (void *)table->CreateAndroidSurfaceKHR;
-#endif // VK_USE_PLATFORM_ANDROID_KHR
-
-    // ---- VK_KHR_win32_surface extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "CreateWin32SurfaceKHR")) return (void *)table->CreateWin32SurfaceKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetPhysicalDeviceWin32PresentationSupportKHR")) return (void *)table->GetPhysicalDeviceWin32PresentationSupportKHR;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_KHR_video_queue extension commands
-#ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "GetPhysicalDeviceVideoCapabilitiesKHR")) return (void *)table->GetPhysicalDeviceVideoCapabilitiesKHR;
-#endif // VK_ENABLE_BETA_EXTENSIONS
+    {12387, offsetof(VkLayerDispatchTable, SetDebugUtilsObjectNameEXT)},
+    {12414, offsetof(VkLayerDispatchTable, SetDebugUtilsObjectTagEXT)},
+    {12440, offsetof(VkLayerDispatchTable, SetDeviceMemoryPriorityEXT)},
+    {12467, offsetof(VkLayerDispatchTable, SetEvent)},
+    {12476, offsetof(VkLayerDispatchTable, SetHdrMetadataEXT)},
+    {12494, offsetof(VkLayerDispatchTable, SetLocalDimmingAMD)},
+    {12513, offsetof(VkLayerDispatchTable, SetPrivateData)},
+    {12528, offsetof(VkLayerDispatchTable, SetPrivateDataEXT)},
+    {12546, offsetof(VkLayerDispatchTable, SignalSemaphore)},
+    {12562, offsetof(VkLayerDispatchTable, SignalSemaphoreKHR)},
+    {12581, offsetof(VkLayerDispatchTable, TrimCommandPool)},
+    {12597, offsetof(VkLayerDispatchTable, TrimCommandPoolKHR)},
+    {12616, offsetof(VkLayerDispatchTable, UninitializePerformanceApiINTEL)},
+    {12648, offsetof(VkLayerDispatchTable, UnmapMemory)},
+    {12660, offsetof(VkLayerDispatchTable, UpdateDescriptorSetWithTemplate)},
+    {12692, offsetof(VkLayerDispatchTable, UpdateDescriptorSetWithTemplateKHR)},
+    {12727, offsetof(VkLayerDispatchTable, UpdateDescriptorSets)},
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    if (!strcmp(name, "GetPhysicalDeviceVideoFormatPropertiesKHR")) return (void *)table->GetPhysicalDeviceVideoFormatPropertiesKHR;
+    {12748, offsetof(VkLayerDispatchTable, UpdateVideoSessionParametersKHR)},
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    {12780, offsetof(VkLayerDispatchTable, WaitForFences)},
+    {12794, offsetof(VkLayerDispatchTable, WaitForPresentKHR)},
+    {12812, offsetof(VkLayerDispatchTable, WaitSemaphores)},
+    {12827, offsetof(VkLayerDispatchTable, WaitSemaphoresKHR)},
+    {12845, offsetof(VkLayerDispatchTable, WriteAccelerationStructuresPropertiesKHR)},
+    {12886, offsetof(VkLayerDispatchTable, WriteMicromapsPropertiesEXT)},
+};
 
-    // ---- VK_KHR_get_physical_device_properties2 extension commands
-    if (!strcmp(name, "GetPhysicalDeviceFeatures2KHR")) return (void *)table->GetPhysicalDeviceFeatures2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceProperties2KHR")) return (void *)table->GetPhysicalDeviceProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties2KHR")) return (void *)table->GetPhysicalDeviceFormatProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties2KHR")) return (void *)table->GetPhysicalDeviceImageFormatProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties2KHR")) return (void *)table->GetPhysicalDeviceQueueFamilyProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties2KHR")) return (void *)table->GetPhysicalDeviceMemoryProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties2KHR")) return (void *)table->GetPhysicalDeviceSparseImageFormatProperties2KHR;
-
-    // ---- VK_KHR_device_group_creation extension commands
-    if (!strcmp(name, "EnumeratePhysicalDeviceGroupsKHR")) return (void *)table->EnumeratePhysicalDeviceGroupsKHR;
-
-    // ---- VK_KHR_external_memory_capabilities extension commands
-    if (!strcmp(name, "GetPhysicalDeviceExternalBufferPropertiesKHR")) return (void *)table->GetPhysicalDeviceExternalBufferPropertiesKHR;
-
-    // ---- VK_KHR_external_semaphore_capabilities extension commands
-    if (!strcmp(name, "GetPhysicalDeviceExternalSemaphorePropertiesKHR")) return (void *)table->GetPhysicalDeviceExternalSemaphorePropertiesKHR;
-
-    // ---- VK_KHR_external_fence_capabilities extension commands
-    if (!strcmp(name, "GetPhysicalDeviceExternalFencePropertiesKHR")) return (void *)table->GetPhysicalDeviceExternalFencePropertiesKHR;
-
-    // ---- VK_KHR_performance_query extension commands
-    if (!strcmp(name, "EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR")) return (void *)table->EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR")) return (void *)table->GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
-
-    // ---- VK_KHR_get_surface_capabilities2 extension commands
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceCapabilities2KHR")) return (void *)table->GetPhysicalDeviceSurfaceCapabilities2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceFormats2KHR")) return (void *)table->GetPhysicalDeviceSurfaceFormats2KHR;
-
-    // ---- VK_KHR_get_display_properties2 extension commands
-    if (!strcmp(name, "GetPhysicalDeviceDisplayProperties2KHR")) return (void *)table->GetPhysicalDeviceDisplayProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceDisplayPlaneProperties2KHR")) return (void *)table->GetPhysicalDeviceDisplayPlaneProperties2KHR;
-    if (!strcmp(name, "GetDisplayModeProperties2KHR")) return (void *)table->GetDisplayModeProperties2KHR;
-    if (!strcmp(name, "GetDisplayPlaneCapabilities2KHR")) return (void *)table->GetDisplayPlaneCapabilities2KHR;
-
-    // ---- VK_KHR_fragment_shading_rate extension commands
-    if (!strcmp(name, "GetPhysicalDeviceFragmentShadingRatesKHR")) return (void *)table->GetPhysicalDeviceFragmentShadingRatesKHR;
-
-    // ---- VK_EXT_debug_report extension commands
-    if (!strcmp(name, "CreateDebugReportCallbackEXT")) return (void *)table->CreateDebugReportCallbackEXT;
-    if (!strcmp(name, "DestroyDebugReportCallbackEXT")) return (void *)table->DestroyDebugReportCallbackEXT;
-    if (!strcmp(name, "DebugReportMessageEXT")) return (void *)table->DebugReportMessageEXT;
-
-    // ---- VK_GGP_stream_descriptor_surface extension commands
-#ifdef VK_USE_PLATFORM_GGP
-    if (!strcmp(name, "CreateStreamDescriptorSurfaceGGP")) return (void *)table->CreateStreamDescriptorSurfaceGGP;
-#endif // VK_USE_PLATFORM_GGP
-
-    // ---- VK_NV_external_memory_capabilities extension commands
-    if (!strcmp(name, "GetPhysicalDeviceExternalImageFormatPropertiesNV")) return (void *)table->GetPhysicalDeviceExternalImageFormatPropertiesNV;
-
-    // ---- VK_NN_vi_surface extension commands
-#ifdef VK_USE_PLATFORM_VI_NN
-    if (!strcmp(name, "CreateViSurfaceNN")) return (void *)table->CreateViSurfaceNN;
-#endif // VK_USE_PLATFORM_VI_NN
-
-    // ---- VK_EXT_direct_mode_display extension commands
-    if (!strcmp(name, "ReleaseDisplayEXT")) return (void *)table->ReleaseDisplayEXT;
+// Device command lookup function
+VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {
+    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
 
-    // ---- VK_EXT_acquire_xlib_display extension commands
-#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    if (!strcmp(name, "AcquireXlibDisplayEXT")) return (void *)table->AcquireXlibDisplayEXT;
-#endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    void *function;
+    loader_lookup_dispatch_table(table, loader_device_dispatch_table_names, loader_device_dispatch_table_entries,
+                                 sizeof(loader_device_dispatch_table_entries) / sizeof(loader_device_dispatch_table_entries[0]),
+                                 name + 2, &function);
+    return function;
+}
+
+// Names of the instance commands in VkLayerInstanceDispatchTable, without their "vk" prefix
+static const char loader_instance_dispatch_table_names[] =
+    "AcquireDrmDisplayEXT\0"
+    "AcquireWinrtDisplayNV\0"
+    "AcquireXlibDisplayEXT\0"
+    "CreateAndroidSurfaceKHR\0"
+    "CreateDebugReportCallbackEXT\0"
+    "CreateDebugUtilsMessengerEXT\0"
+    "CreateDirectFBSurfaceEXT\0"
+    "CreateDisplayModeKHR\0"
+    "CreateDisplayPlaneSurfaceKHR\0"
+    "CreateHeadlessSurfaceEXT\0"
+    "CreateIOSSurfaceMVK\0"
+    "CreateImagePipeSurfaceFUCHSIA\0"
+    "CreateMacOSSurfaceMVK\0"
+    "CreateMetalSurfaceEXT\0"
+    "CreateScreenSurfaceQNX\0"
+    "CreateStreamDescriptorSurfaceGGP\0"
+    "CreateViSurfaceNN\0"
+    "CreateWaylandSurfaceKHR\0"
+    "CreateWin32SurfaceKHR\0"
+    "CreateXcbSurfaceKHR\0"
+    "CreateXlibSurfaceKHR\0"
+    "DebugReportMessageEXT\0"
+    "DestroyDebugReportCallbackEXT\0"
+    "DestroyDebugUtilsMessengerEXT\0"
+    "DestroyInstance\0"
+    "DestroySurfaceKHR\0"
+    "EnumerateDeviceExtensionProperties\0"
+    "EnumerateDeviceLayerProperties\0"
+    "EnumeratePhysicalDeviceGroups\0"
+    "EnumeratePhysicalDeviceGroupsKHR\0"
+    "EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR\0"
+    "EnumeratePhysicalDevices\0"
+    "GetDisplayModeProperties2KHR\0"
+    "GetDisplayModePropertiesKHR\0"
+    "GetDisplayPlaneCapabilities2KHR\0"
+    "GetDisplayPlaneCapabilitiesKHR\0"
+    "GetDisplayPlaneSupportedDisplaysKHR\0"
+    "GetDrmDisplayEXT\0"
+    "GetInstanceProcAddr\0"
+    "GetPhysicalDeviceCalibrateableTimeDomainsEXT\0"
+    "GetPhysicalDeviceCooperativeMatrixPropertiesNV\0"
+    "GetPhysicalDeviceDirectFBPresentationSupportEXT\0"
+    "GetPhysicalDeviceDisplayPlaneProperties2KHR\0"
+    "GetPhysicalDeviceDisplayPlanePropertiesKHR\0"
+    "GetPhysicalDeviceDisplayProperties2KHR\0"
+    "GetPhysicalDeviceDisplayPropertiesKHR\0"
+    "GetPhysicalDeviceExternalBufferProperties\0"
+    "GetPhysicalDeviceExternalBufferPropertiesKHR\0"
+    "GetPhysicalDeviceExternalFenceProperties\0"
+    "GetPhysicalDeviceExternalFencePropertiesKHR\0"
+    "GetPhysicalDeviceExternalImageFormatPropertiesNV\0"
+    "GetPhysicalDeviceExternalSemaphoreProperties\0"
+    "GetPhysicalDeviceExternalSemaphorePropertiesKHR\0"
+    "GetPhysicalDeviceFeatures\0"
+    "GetPhysicalDeviceFeatures2\0"
+    "GetPhysicalDeviceFeatures2KHR\0"
+    "GetPhysicalDeviceFormatProperties\0"
+    "GetPhysicalDeviceFormatProperties2\0"
+    "GetPhysicalDeviceFormatProperties2KHR\0"
+    "GetPhysicalDeviceFragmentShadingRatesKHR\0"
+    "GetPhysicalDeviceImageFormatProperties\0"
+    "GetPhysicalDeviceImageFormatProperties2\0"
+    "GetPhysicalDeviceImageFormatProperties2KHR\0"
+    "GetPhysicalDeviceMemoryProperties\0"
+    "GetPhysicalDeviceMemoryProperties2\0"
+    "GetPhysicalDeviceMemoryProperties2KHR\0"
+    "GetPhysicalDeviceMultisamplePropertiesEXT\0"
+    "GetPhysicalDeviceOpticalFlowImageFormatsNV\0"
+    "GetPhysicalDevicePresentRectanglesKHR\0"
+    "GetPhysicalDeviceProperties\0"
+    "GetPhysicalDeviceProperties2\0"
+    "GetPhysicalDeviceProperties2KHR\0"
+    "GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR\0"
+    "GetPhysicalDeviceQueueFamilyProperties\0"
+    "GetPhysicalDeviceQueueFamilyProperties2\0"
+    "GetPhysicalDeviceQueueFamilyProperties2KHR\0"
+    "GetPhysicalDeviceScreenPresentationSupportQNX\0"
+    "GetPhysicalDeviceSparseImageFormatProperties\0"
+    "GetPhysicalDeviceSparseImageFormatProperties2\0"
+    "GetPhysicalDeviceSparseImageFormatProperties2KHR\0"
+    "GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV\0"
+    "GetPhysicalDeviceSurfaceCapabilities2EXT\0"
+    "GetPhysicalDeviceSurfaceCapabilities2KHR\0"
+    "GetPhysicalDeviceSurfaceCapabilitiesKHR\0"
+    "GetPhysicalDeviceSurfaceFormats2KHR\0"
+    "GetPhysicalDeviceSurfaceFormatsKHR\0"
+    "GetPhysicalDeviceSurfacePresentModes2EXT\0"
+    "GetPhysicalDeviceSurfacePresentModesKHR\0"
+    "GetPhysicalDeviceSurfaceSupportKHR\0"
+    "GetPhysicalDeviceToolProperties\0"
+    "GetPhysicalDeviceToolPropertiesEXT\0"
+    "GetPhysicalDeviceVideoCapabilitiesKHR\0"
+    "GetPhysicalDeviceVideoFormatPropertiesKHR\0"
+    "GetPhysicalDeviceWaylandPresentationSupportKHR\0"
+    "GetPhysicalDeviceWin32PresentationSupportKHR\0"
+    "GetPhysicalDeviceXcbPresentationSupportKHR\0"
+    "GetPhysicalDeviceXlibPresentationSupportKHR\0"
+    "GetRandROutputDisplayEXT\0"
+    "GetWinrtDisplayNV\0"
+    "ReleaseDisplayEXT\0"
+    "SubmitDebugUtilsMessageEXT\0"
+    ;
+
+static const struct loader_dispatch_table_entry loader_instance_dispatch_table_entries[] = {
+    {0, offsetof(VkLayerInstanceDispatchTable, AcquireDrmDisplayEXT)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {21, offsetof(VkLayerInstanceDispatchTable, AcquireWinrtDisplayNV)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    if (!strcmp(name, "GetRandROutputDisplayEXT")) return (void *)table->GetRandROutputDisplayEXT;
+    {43, offsetof(VkLayerInstanceDispatchTable, AcquireXlibDisplayEXT)},
 #endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
-
-    // ---- VK_EXT_display_surface_counter extension commands
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceCapabilities2EXT")) return (void *)table->GetPhysicalDeviceSurfaceCapabilities2EXT;
-
-    // ---- VK_MVK_ios_surface extension commands
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    {65, offsetof(VkLayerInstanceDispatchTable, CreateAndroidSurfaceKHR)},
+#endif // VK_USE_PLATFORM_ANDROID_KHR
+    {89, offsetof(VkLayerInstanceDispatchTable, CreateDebugReportCallbackEXT)},
+    {118, offsetof(VkLayerInstanceDispatchTable, CreateDebugUtilsMessengerEXT)},
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    {147, offsetof(VkLayerInstanceDispatchTable, CreateDirectFBSurfaceEXT)},
+#endif // VK_USE_PLATFORM_DIRECTFB_EXT
+    {172, offsetof(VkLayerInstanceDispatchTable, CreateDisplayModeKHR)},
+    {193, offsetof(VkLayerInstanceDispatchTable, CreateDisplayPlaneSurfaceKHR)},
+    {222, offsetof(VkLayerInstanceDispatchTable, CreateHeadlessSurfaceEXT)},
 #ifdef VK_USE_PLATFORM_IOS_MVK
-    if (!strcmp(name, "CreateIOSSurfaceMVK")) return (void *)table->CreateIOSSurfaceMVK;
+    {247, offsetof(VkLayerInstanceDispatchTable, CreateIOSSurfaceMVK)},
 #endif // VK_USE_PLATFORM_IOS_MVK
-
-    // ---- VK_MVK_macos_surface extension commands
-#ifdef VK_USE_PLATFORM_MACOS_MVK
-    if (!strcmp(name, "CreateMacOSSurfaceMVK")) return (void *)table->CreateMacOSSurfaceMVK;
-#endif // VK_USE_PLATFORM_MACOS_MVK
-
-    // ---- VK_EXT_debug_utils extension commands
-    if (!strcmp(name, "CreateDebugUtilsMessengerEXT")) return (void *)table->CreateDebugUtilsMessengerEXT;
-    if (!strcmp(name, "DestroyDebugUtilsMessengerEXT")) return (void *)table->DestroyDebugUtilsMessengerEXT;
-    if (!strcmp(name, "SubmitDebugUtilsMessageEXT")) return (void *)table->SubmitDebugUtilsMessageEXT;
-
-    // ---- VK_EXT_sample_locations extension commands
-    if (!strcmp(name, "GetPhysicalDeviceMultisamplePropertiesEXT")) return (void *)table->GetPhysicalDeviceMultisamplePropertiesEXT;
-
-    // ---- VK_EXT_calibrated_timestamps extension commands
-    if (!strcmp(name, "GetPhysicalDeviceCalibrateableTimeDomainsEXT")) return (void *)table->GetPhysicalDeviceCalibrateableTimeDomainsEXT;
-
-    // ---- VK_FUCHSIA_imagepipe_surface extension commands
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    if (!strcmp(name, "CreateImagePipeSurfaceFUCHSIA")) return (void *)table->CreateImagePipeSurfaceFUCHSIA;
+    {267, offsetof(VkLayerInstanceDispatchTable, CreateImagePipeSurfaceFUCHSIA)},
 #endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_EXT_metal_surface extension commands
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    {297, offsetof(VkLayerInstanceDispatchTable, CreateMacOSSurfaceMVK)},
+#endif // VK_USE_PLATFORM_MACOS_MVK
 #ifdef VK_USE_PLATFORM_METAL_EXT
-    if (!strcmp(name, "CreateMetalSurfaceEXT")) return (void *)table->CreateMetalSurfaceEXT;
+    {319, offsetof(VkLayerInstanceDispatchTable, CreateMetalSurfaceEXT)},
 #endif // VK_USE_PLATFORM_METAL_EXT
-
-    // ---- VK_EXT_tooling_info extension commands
-    if (!strcmp(name, "GetPhysicalDeviceToolPropertiesEXT")) return (void *)table->GetPhysicalDeviceToolPropertiesEXT;
-
-    // ---- VK_NV_cooperative_matrix extension commands
-    if (!strcmp(name, "GetPhysicalDeviceCooperativeMatrixPropertiesNV")) return (void *)table->GetPhysicalDeviceCooperativeMatrixPropertiesNV;
-
-    // ---- VK_NV_coverage_reduction_mode extension commands
-    if (!strcmp(name, "GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV")) return (void *)table->GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
-
-    // ---- VK_EXT_full_screen_exclusive extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetPhysicalDeviceSurfacePresentModes2EXT")) return (void *)table->GetPhysicalDeviceSurfacePresentModes2EXT;
-#endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_EXT_headless_surface extension commands
-    if (!strcmp(name, "CreateHeadlessSurfaceEXT")) return (void *)table->CreateHeadlessSurfaceEXT;
-
-    // ---- VK_EXT_acquire_drm_display extension commands
-    if (!strcmp(name, "AcquireDrmDisplayEXT")) return (void *)table->AcquireDrmDisplayEXT;
-    if (!strcmp(name, "GetDrmDisplayEXT")) return (void *)table->GetDrmDisplayEXT;
-
-    // ---- VK_NV_acquire_winrt_display extension commands
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "AcquireWinrtDisplayNV")) return (void *)table->AcquireWinrtDisplayNV;
-#endif // VK_USE_PLATFORM_WIN32_KHR
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+    {341, offsetof(VkLayerInstanceDispatchTable, CreateScreenSurfaceQNX)},
+#endif // VK_USE_PLATFORM_SCREEN_QNX
+#ifdef VK_USE_PLATFORM_GGP
+    {364, offsetof(VkLayerInstanceDispatchTable, CreateStreamDescriptorSurfaceGGP)},
+#endif // VK_USE_PLATFORM_GGP
+#ifdef VK_USE_PLATFORM_VI_NN
+    {397, offsetof(VkLayerInstanceDispatchTable, CreateViSurfaceNN)},
+#endif // VK_USE_PLATFORM_VI_NN
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {415, offsetof(VkLayerInstanceDispatchTable, CreateWaylandSurfaceKHR)},
+#endif // VK_USE_PLATFORM_WAYLAND_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetWinrtDisplayNV")) return (void *)table->GetWinrtDisplayNV;
+    {439, offsetof(VkLayerInstanceDispatchTable, CreateWin32SurfaceKHR)},
 #endif // VK_USE_PLATFORM_WIN32_KHR
-
-    // ---- VK_EXT_directfb_surface extension commands
-#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-    if (!strcmp(name, "CreateDirectFBSurfaceEXT")) return (void *)table->CreateDirectFBSurfaceEXT;
-#endif // VK_USE_PLATFORM_DIRECTFB_EXT
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {461, offsetof(VkLayerInstanceDispatchTable, CreateXcbSurfaceKHR)},
+#endif // VK_USE_PLATFORM_XCB_KHR
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {481, offsetof(VkLayerInstanceDispatchTable, CreateXlibSurfaceKHR)},
+#endif // VK_USE_PLATFORM_XLIB_KHR
+    {502, offsetof(VkLayerInstanceDispatchTable, DebugReportMessageEXT)},
+    {524, offsetof(VkLayerInstanceDispatchTable, DestroyDebugReportCallbackEXT)},
+    {554, offsetof(VkLayerInstanceDispatchTable, DestroyDebugUtilsMessengerEXT)},
+    {584, offsetof(VkLayerInstanceDispatchTable, DestroyInstance)},
+    {600, offsetof(VkLayerInstanceDispatchTable, DestroySurfaceKHR)},
+    {618, offsetof(VkLayerInstanceDispatchTable, EnumerateDeviceExtensionProperties)},
+    {653, offsetof(VkLayerInstanceDispatchTable, EnumerateDeviceLayerProperties)},
+    {684, offsetof(VkLayerInstanceDispatchTable, EnumeratePhysicalDeviceGroups)},
+    {714, offsetof(VkLayerInstanceDispatchTable, EnumeratePhysicalDeviceGroupsKHR)},
+    {747, offsetof(VkLayerInstanceDispatchTable, EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR)},
+    {809, offsetof(VkLayerInstanceDispatchTable, EnumeratePhysicalDevices)},
+    {834, offsetof(VkLayerInstanceDispatchTable, GetDisplayModeProperties2KHR)},
+    {863, offsetof(VkLayerInstanceDispatchTable, GetDisplayModePropertiesKHR)},
+    {891, offsetof(VkLayerInstanceDispatchTable, GetDisplayPlaneCapabilities2KHR)},
+    {923, offsetof(VkLayerInstanceDispatchTable, GetDisplayPlaneCapabilitiesKHR)},
+    {954, offsetof(VkLayerInstanceDispatchTable, GetDisplayPlaneSupportedDisplaysKHR)},
+    {990, offsetof(VkLayerInstanceDispatchTable, GetDrmDisplayEXT)},
+    {1007, offsetof(VkLayerInstanceDispatchTable, GetInstanceProcAddr)},
+    {1027, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceCalibrateableTimeDomainsEXT)},
+    {1072, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceCooperativeMatrixPropertiesNV)},
 #ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-    if (!strcmp(name, "GetPhysicalDeviceDirectFBPresentationSupportEXT")) return (void *)table->GetPhysicalDeviceDirectFBPresentationSupportEXT;
+    {1119, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDirectFBPresentationSupportEXT)},
 #endif // VK_USE_PLATFORM_DIRECTFB_EXT
-
-    // ---- VK_QNX_screen_surface extension commands
-#ifdef VK_USE_PLATFORM_SCREEN_QNX
-    if (!strcmp(name, "CreateScreenSurfaceQNX")) return (void *)table->CreateScreenSurfaceQNX;
-#endif // VK_USE_PLATFORM_SCREEN_QNX
+    {1167, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDisplayPlaneProperties2KHR)},
+    {1211, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDisplayPlanePropertiesKHR)},
+    {1254, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDisplayProperties2KHR)},
+    {1293, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceDisplayPropertiesKHR)},
+    {1331, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalBufferProperties)},
+    {1373, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalBufferPropertiesKHR)},
+    {1418, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalFenceProperties)},
+    {1459, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalFencePropertiesKHR)},
+    {1503, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalImageFormatPropertiesNV)},
+    {1552, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalSemaphoreProperties)},
+    {1597, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceExternalSemaphorePropertiesKHR)},
+    {1645, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFeatures)},
+    {1671, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFeatures2)},
+    {1698, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFeatures2KHR)},
+    {1728, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFormatProperties)},
+    {1762, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFormatProperties2)},
+    {1797, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFormatProperties2KHR)},
+    {1835, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceFragmentShadingRatesKHR)},
+    {1876, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceImageFormatProperties)},
+    {1915, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceImageFormatProperties2)},
+    {1955, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceImageFormatProperties2KHR)},
+    {1998, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceMemoryProperties)},
+    {2032, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceMemoryProperties2)},
+    {2067, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceMemoryProperties2KHR)},
+    {2105, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceMultisamplePropertiesEXT)},
+    {2147, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceOpticalFlowImageFormatsNV)},
+    {2190, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDevicePresentRectanglesKHR)},
+    {2228, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceProperties)},
+    {2256, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceProperties2)},
+    {2285, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceProperties2KHR)},
+    {2317, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR)},
+    {2371, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceQueueFamilyProperties)},
+    {2410, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceQueueFamilyProperties2)},
+    {2450, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceQueueFamilyProperties2KHR)},
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-    if (!strcmp(name, "GetPhysicalDeviceScreenPresentationSupportQNX")) return (void *)table->GetPhysicalDeviceScreenPresentationSupportQNX;
+    {2493, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceScreenPresentationSupportQNX)},
 #endif // VK_USE_PLATFORM_SCREEN_QNX
+    {2539, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSparseImageFormatProperties)},
+    {2584, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSparseImageFormatProperties2)},
+    {2630, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSparseImageFormatProperties2KHR)},
+    {2679, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)},
+    {2743, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceCapabilities2EXT)},
+    {2784, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceCapabilities2KHR)},
+    {2825, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceCapabilitiesKHR)},
+    {2865, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceFormats2KHR)},
+    {2901, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceFormatsKHR)},
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {2936, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfacePresentModes2EXT)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {2977, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfacePresentModesKHR)},
+    {3017, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceSurfaceSupportKHR)},
+    {3052, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceToolProperties)},
+    {3084, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceToolPropertiesEXT)},
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {3119, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceVideoCapabilitiesKHR)},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    {3157, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceVideoFormatPropertiesKHR)},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    {3199, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceWaylandPresentationSupportKHR)},
+#endif // VK_USE_PLATFORM_WAYLAND_KHR
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {3246, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceWin32PresentationSupportKHR)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    {3291, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceXcbPresentationSupportKHR)},
+#endif // VK_USE_PLATFORM_XCB_KHR
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    {3334, offsetof(VkLayerInstanceDispatchTable, GetPhysicalDeviceXlibPresentationSupportKHR)},
+#endif // VK_USE_PLATFORM_XLIB_KHR
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    {3378, offsetof(VkLayerInstanceDispatchTable, GetRandROutputDisplayEXT)},
+#endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    {3403, offsetof(VkLayerInstanceDispatchTable, GetWinrtDisplayNV)},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {3421, offsetof(VkLayerInstanceDispatchTable, ReleaseDisplayEXT)},
+    {3439, offsetof(VkLayerInstanceDispatchTable, SubmitDebugUtilsMessageEXT)},
+};
 
-    // ---- VK_NV_optical_flow extension commands
-    if (!strcmp(name, "GetPhysicalDeviceOpticalFlowImageFormatsNV")) return (void *)table->GetPhysicalDeviceOpticalFlowImageFormatsNV;
+// Instance command lookup function
+VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,
+                                                                 bool *found_name) {
+    if (!name || name[0] != 'v' || name[1] != 'k') {
+        *found_name = false;
+        return NULL;
+    }
 
-    *found_name = false;
-    return NULL;
+    void *function;
+    *found_name = loader_lookup_dispatch_table(table, loader_instance_dispatch_table_names, loader_instance_dispatch_table_entries,
+                                               sizeof(loader_instance_dispatch_table_entries) / sizeof(loader_instance_dispatch_table_entries[0]),
+                                               name + 2, &function);
+    return function;
 }
 
-
 // ---- VK_KHR_video_queue extension trampoline/terminators
 
 #ifdef VK_ENABLE_BETA_EXTENSIONS
@@ -10011,320 +10382,376 @@ PFN_vkVoidFunction get_extension_device_proc_terminator(struct loader_device *de
     return NULL;
 }
 
-// This table contains the loader's instance dispatch table, which contains
+// Fills in the loader's instance dispatch table, which contains
 // default functions if no instance layers are activated.  This contains
-// pointers to "terminator functions".
-const VkLayerInstanceDispatchTable instance_disp = {
+// pointers to "terminator functions". The table is filled in at runtime instead of
+// being copied from a static initializer so that none of the pointers need a
+// dynamic relocation when the loader is loaded.
+void loader_init_instance_terminator_dispatch(VkLayerInstanceDispatchTable *table) {
+    memset(table, 0, sizeof(*table));
 
     // ---- Core 1_0 commands
-    .DestroyInstance = terminator_DestroyInstance,
-    .EnumeratePhysicalDevices = terminator_EnumeratePhysicalDevices,
-    .GetPhysicalDeviceFeatures = terminator_GetPhysicalDeviceFeatures,
-    .GetPhysicalDeviceFormatProperties = terminator_GetPhysicalDeviceFormatProperties,
-    .GetPhysicalDeviceImageFormatProperties = terminator_GetPhysicalDeviceImageFormatProperties,
-    .GetPhysicalDeviceProperties = terminator_GetPhysicalDeviceProperties,
-    .GetPhysicalDeviceQueueFamilyProperties = terminator_GetPhysicalDeviceQueueFamilyProperties,
-    .GetPhysicalDeviceMemoryProperties = terminator_GetPhysicalDeviceMemoryProperties,
-    .GetInstanceProcAddr = vkGetInstanceProcAddr,
-    .EnumerateDeviceExtensionProperties = terminator_EnumerateDeviceExtensionProperties,
-    .EnumerateDeviceLayerProperties = terminator_EnumerateDeviceLayerProperties,
-    .GetPhysicalDeviceSparseImageFormatProperties = terminator_GetPhysicalDeviceSparseImageFormatProperties,
+    table->DestroyInstance = terminator_DestroyInstance;
+    table->EnumeratePhysicalDevices = terminator_EnumeratePhysicalDevices;
+    table->GetPhysicalDeviceFeatures = terminator_GetPhysicalDeviceFeatures;
+    table->GetPhysicalDeviceFormatProperties = terminator_GetPhysicalDeviceFormatProperties;
+    table->GetPhysicalDeviceImageFormatProperties = terminator_GetPhysicalDeviceImageFormatProperties;
+    table->GetPhysicalDeviceProperties = terminator_GetPhysicalDeviceProperties;
+    table->GetPhysicalDeviceQueueFamilyProperties = terminator_GetPhysicalDeviceQueueFamilyProperties;
+    table->GetPhysicalDeviceMemoryProperties = terminator_GetPhysicalDeviceMemoryProperties;
+    table->GetInstanceProcAddr = vkGetInstanceProcAddr;
+    table->EnumerateDeviceExtensionProperties = terminator_EnumerateDeviceExtensionProperties;
+    table->EnumerateDeviceLayerProperties = terminator_EnumerateDeviceLayerProperties;
+    table->GetPhysicalDeviceSparseImageFormatProperties = terminator_GetPhysicalDeviceSparseImageFormatProperties;
 
     // ---- Core 1_1 commands
-    .EnumeratePhysicalDeviceGroups = terminator_EnumeratePhysicalDeviceGroups,
-    .GetPhysicalDeviceFeatures2 = terminator_GetPhysicalDeviceFeatures2,
-    .GetPhysicalDeviceProperties2 = terminator_GetPhysicalDeviceProperties2,
-    .GetPhysicalDeviceFormatProperties2 = terminator_GetPhysicalDeviceFormatProperties2,
-    .GetPhysicalDeviceImageFormatProperties2 = terminator_GetPhysicalDeviceImageFormatProperties2,
-    .GetPhysicalDeviceQueueFamilyProperties2 = terminator_GetPhysicalDeviceQueueFamilyProperties2,
-    .GetPhysicalDeviceMemoryProperties2 = terminator_GetPhysicalDeviceMemoryProperties2,
-    .GetPhysicalDeviceSparseImageFormatProperties2 = terminator_GetPhysicalDeviceSparseImageFormatProperties2,
-    .GetPhysicalDeviceExternalBufferProperties = terminator_GetPhysicalDeviceExternalBufferProperties,
-    .GetPhysicalDeviceExternalFenceProperties = terminator_GetPhysicalDeviceExternalFenceProperties,
-    .GetPhysicalDeviceExternalSemaphoreProperties = terminator_GetPhysicalDeviceExternalSemaphoreProperties,
+    table->EnumeratePhysicalDeviceGroups = terminator_EnumeratePhysicalDeviceGroups;
+    table->GetPhysicalDeviceFeatures2 = terminator_GetPhysicalDeviceFeatures2;
+    table->GetPhysicalDeviceProperties2 = terminator_GetPhysicalDeviceProperties2;
+    table->GetPhysicalDeviceFormatProperties2 = terminator_GetPhysicalDeviceFormatProperties2;
+    table->GetPhysicalDeviceImageFormatProperties2 = terminator_GetPhysicalDeviceImageFormatProperties2;
+    table->GetPhysicalDeviceQueueFamilyProperties2 = terminator_GetPhysicalDeviceQueueFamilyProperties2;
+    table->GetPhysicalDeviceMemoryProperties2 = terminator_GetPhysicalDeviceMemoryProperties2;
+    table->GetPhysicalDeviceSparseImageFormatProperties2 = terminator_GetPhysicalDeviceSparseImageFormatProperties2;
+    table->GetPhysicalDeviceExternalBufferProperties = terminator_GetPhysicalDeviceExternalBufferProperties;
+    table->GetPhysicalDeviceExternalFenceProperties = terminator_GetPhysicalDeviceExternalFenceProperties;
+    table->GetPhysicalDeviceExternalSemaphoreProperties = terminator_GetPhysicalDeviceExternalSemaphoreProperties;
 
     // ---- Core 1_3 commands
-    .GetPhysicalDeviceToolProperties = terminator_GetPhysicalDeviceToolProperties,
+    table->GetPhysicalDeviceToolProperties = terminator_GetPhysicalDeviceToolProperties;
 
     // ---- VK_KHR_surface extension commands
-    .DestroySurfaceKHR = terminator_DestroySurfaceKHR,
-    .GetPhysicalDeviceSurfaceSupportKHR = terminator_GetPhysicalDeviceSurfaceSupportKHR,
-    .GetPhysicalDeviceSurfaceCapabilitiesKHR = terminator_GetPhysicalDeviceSurfaceCapabilitiesKHR,
-    .GetPhysicalDeviceSurfaceFormatsKHR = terminator_GetPhysicalDeviceSurfaceFormatsKHR,
-    .GetPhysicalDeviceSurfacePresentModesKHR = terminator_GetPhysicalDeviceSurfacePresentModesKHR,
+    table->DestroySurfaceKHR = terminator_DestroySurfaceKHR;
+    table->GetPhysicalDeviceSurfaceSupportKHR = terminator_GetPhysicalDeviceSurfaceSupportKHR;
+    table->GetPhysicalDeviceSurfaceCapabilitiesKHR = terminator_GetPhysicalDeviceSurfaceCapabilitiesKHR;
+    table->GetPhysicalDeviceSurfaceFormatsKHR = terminator_GetPhysicalDeviceSurfaceFormatsKHR;
+    table->GetPhysicalDeviceSurfacePresentModesKHR = terminator_GetPhysicalDeviceSurfacePresentModesKHR;
 
     // ---- VK_KHR_swapchain extension commands
-    .GetPhysicalDevicePresentRectanglesKHR = terminator_GetPhysicalDevicePresentRectanglesKHR,
+    table->GetPhysicalDevicePresentRectanglesKHR = terminator_GetPhysicalDevicePresentRectanglesKHR;
 
     // ---- VK_KHR_display extension commands
-    .GetPhysicalDeviceDisplayPropertiesKHR = terminator_GetPhysicalDeviceDisplayPropertiesKHR,
-    .GetPhysicalDeviceDisplayPlanePropertiesKHR = terminator_GetPhysicalDeviceDisplayPlanePropertiesKHR,
-    .GetDisplayPlaneSupportedDisplaysKHR = terminator_GetDisplayPlaneSupportedDisplaysKHR,
-    .GetDisplayModePropertiesKHR = terminator_GetDisplayModePropertiesKHR,
-    .CreateDisplayModeKHR = terminator_CreateDisplayModeKHR,
-    .GetDisplayPlaneCapabilitiesKHR = terminator_GetDisplayPlaneCapabilitiesKHR,
-    .CreateDisplayPlaneSurfaceKHR = terminator_CreateDisplayPlaneSurfaceKHR,
+    table->GetPhysicalDeviceDisplayPropertiesKHR = terminator_GetPhysicalDeviceDisplayPropertiesKHR;
+    table->GetPhysicalDeviceDisplayPlanePropertiesKHR = terminator_GetPhysicalDeviceDisplayPlanePropertiesKHR;
+    table->GetDisplayPlaneSupportedDisplaysKHR = terminator_GetDisplayPlaneSupportedDisplaysKHR;
+    table->GetDisplayModePropertiesKHR = terminator_GetDisplayModePropertiesKHR;
+    table->CreateDisplayModeKHR = terminator_CreateDisplayModeKHR;
+    table->GetDisplayPlaneCapabilitiesKHR = terminator_GetDisplayPlaneCapabilitiesKHR;
+    table->CreateDisplayPlaneSurfaceKHR = terminator_CreateDisplayPlaneSurfaceKHR;
 
     // ---- VK_KHR_xlib_surface extension commands
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-    .CreateXlibSurfaceKHR = terminator_CreateXlibSurfaceKHR,
+    table->CreateXlibSurfaceKHR = terminator_CreateXlibSurfaceKHR;
 #endif // VK_USE_PLATFORM_XLIB_KHR
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-    .GetPhysicalDeviceXlibPresentationSupportKHR = terminator_GetPhysicalDeviceXlibPresentationSupportKHR,
+    table->GetPhysicalDeviceXlibPresentationSupportKHR = terminator_GetPhysicalDeviceXlibPresentationSupportKHR;
 #endif // VK_USE_PLATFORM_XLIB_KHR
 
     // ---- VK_KHR_xcb_surface extension commands
 #ifdef VK_USE_PLATFORM_XCB_KHR
-    .CreateXcbSurfaceKHR = terminator_CreateXcbSurfaceKHR,
+    table->CreateXcbSurfaceKHR = terminator_CreateXcbSurfaceKHR;
 #endif // VK_USE_PLATFORM_XCB_KHR
 #ifdef VK_USE_PLATFORM_XCB_KHR
-    .GetPhysicalDeviceXcbPresentationSupportKHR = terminator_GetPhysicalDeviceXcbPresentationSupportKHR,
+    table->GetPhysicalDeviceXcbPresentationSupportKHR = terminator_GetPhysicalDeviceXcbPresentationSupportKHR;
 #endif // VK_USE_PLATFORM_XCB_KHR
 
     // ---- VK_KHR_wayland_surface extension commands
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    .CreateWaylandSurfaceKHR = terminator_CreateWaylandSurfaceKHR,
+    table->CreateWaylandSurfaceKHR = terminator_CreateWaylandSurfaceKHR;
 #endif // VK_USE_PLATFORM_WAYLAND_KHR
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    .GetPhysicalDeviceWaylandPresentationSupportKHR = terminator_GetPhysicalDeviceWaylandPresentationSupportKHR,
+    table->GetPhysicalDeviceWaylandPresentationSupportKHR = terminator_GetPhysicalDeviceWaylandPresentationSupportKHR;
 #endif // VK_USE_PLATFORM_WAYLAND_KHR
 
     // ---- VK_KHR_android_surface extension commands
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-    .CreateAndroidSurfaceKHR = terminator_CreateAndroidSurfaceKHR,
+    table->CreateAndroidSurfaceKHR = terminator_CreateAndroidSurfaceKHR;
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 
     // ---- VK_KHR_win32_surface extension commands
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    .CreateWin32SurfaceKHR = terminator_CreateWin32SurfaceKHR,
+    table->CreateWin32SurfaceKHR = terminator_CreateWin32SurfaceKHR;
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    .GetPhysicalDeviceWin32PresentationSupportKHR = terminator_GetPhysicalDeviceWin32PresentationSupportKHR,
+    table->GetPhysicalDeviceWin32PresentationSupportKHR = terminator_GetPhysicalDeviceWin32PresentationSupportKHR;
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
     // ---- VK_KHR_video_queue extension commands
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    .GetPhysicalDeviceVideoCapabilitiesKHR = terminator_GetPhysicalDeviceVideoCapabilitiesKHR,
+    table->GetPhysicalDeviceVideoCapabilitiesKHR = terminator_GetPhysicalDeviceVideoCapabilitiesKHR;
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_ENABLE_BETA_EXTENSIONS
-    .GetPhysicalDeviceVideoFormatPropertiesKHR = terminator_GetPhysicalDeviceVideoFormatPropertiesKHR,
+    table->GetPhysicalDeviceVideoFormatPropertiesKHR = terminator_GetPhysicalDeviceVideoFormatPropertiesKHR;
 #endif // VK_ENABLE_BETA_EXTENSIONS
 
     // ---- VK_KHR_get_physical_device_properties2 extension commands
-    .GetPhysicalDeviceFeatures2KHR = terminator_GetPhysicalDeviceFeatures2,
-    .GetPhysicalDeviceProperties2KHR = terminator_GetPhysicalDeviceProperties2,
-    .GetPhysicalDeviceFormatProperties2KHR = terminator_GetPhysicalDeviceFormatProperties2,
-    .GetPhysicalDeviceImageFormatProperties2KHR = terminator_GetPhysicalDeviceImageFormatProperties2,
-    .GetPhysicalDeviceQueueFamilyProperties2KHR = terminator_GetPhysicalDeviceQueueFamilyProperties2,
-    .GetPhysicalDeviceMemoryProperties2KHR = terminator_GetPhysicalDeviceMemoryProperties2,
-    .GetPhysicalDeviceSparseImageFormatProperties2KHR = terminator_GetPhysicalDeviceSparseImageFormatProperties2,
+    table->GetPhysicalDeviceFeatures2KHR = terminator_GetPhysicalDeviceFeatures2;
+    table->GetPhysicalDeviceProperties2KHR = terminator_GetPhysicalDeviceProperties2;
+    table->GetPhysicalDeviceFormatProperties2KHR = terminator_GetPhysicalDeviceFormatProperties2;
+    table->GetPhysicalDeviceImageFormatProperties2KHR = terminator_GetPhysicalDeviceImageFormatProperties2;
+    table->GetPhysicalDeviceQueueFamilyProperties2KHR = terminator_GetPhysicalDeviceQueueFamilyProperties2;
+    table->GetPhysicalDeviceMemoryProperties2KHR = terminator_GetPhysicalDeviceMemoryProperties2;
+    table->GetPhysicalDeviceSparseImageFormatProperties2KHR = terminator_GetPhysicalDeviceSparseImageFormatProperties2;
 
     // ---- VK_KHR_device_group_creation extension commands
-    .EnumeratePhysicalDeviceGroupsKHR = terminator_EnumeratePhysicalDeviceGroups,
+    table->EnumeratePhysicalDeviceGroupsKHR = terminator_EnumeratePhysicalDeviceGroups;
 
     // ---- VK_KHR_external_memory_capabilities extension commands
-    .GetPhysicalDeviceExternalBufferPropertiesKHR = terminator_GetPhysicalDeviceExternalBufferProperties,
+    table->GetPhysicalDeviceExternalBufferPropertiesKHR = terminator_GetPhysicalDeviceExternalBufferProperties;
 
     // ---- VK_KHR_external_semaphore_capabilities extension commands
-    .GetPhysicalDeviceExternalSemaphorePropertiesKHR = terminator_GetPhysicalDeviceExternalSemaphoreProperties,
+    table->GetPhysicalDeviceExternalSemaphorePropertiesKHR = terminator_GetPhysicalDeviceExternalSemaphoreProperties;
 
     // ---- VK_KHR_external_fence_capabilities extension commands
-    .GetPhysicalDeviceExternalFencePropertiesKHR = terminator_GetPhysicalDeviceExternalFenceProperties,
+    table->GetPhysicalDeviceExternalFencePropertiesKHR = terminator_GetPhysicalDeviceExternalFenceProperties;
 
     // ---- VK_KHR_performance_query extension commands
-    .EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = terminator_EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR,
-    .GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = terminator_GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR,
+    table->EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = terminator_EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+    table->GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = terminator_GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
 
     // ---- VK_KHR_get_surface_capabilities2 extension commands
-    .GetPhysicalDeviceSurfaceCapabilities2KHR = terminator_GetPhysicalDeviceSurfaceCapabilities2KHR,
-    .GetPhysicalDeviceSurfaceFormats2KHR = terminator_GetPhysicalDeviceSurfaceFormats2KHR,
+    table->GetPhysicalDeviceSurfaceCapabilities2KHR = terminator_GetPhysicalDeviceSurfaceCapabilities2KHR;
+    table->GetPhysicalDeviceSurfaceFormats2KHR = terminator_GetPhysicalDeviceSurfaceFormats2KHR;
 
     // ---- VK_KHR_get_display_properties2 extension commands
-    .GetPhysicalDeviceDisplayProperties2KHR = terminator_GetPhysicalDeviceDisplayProperties2KHR,
-    .GetPhysicalDeviceDisplayPlaneProperties2KHR = terminator_GetPhysicalDeviceDisplayPlaneProperties2KHR,
-    .GetDisplayModeProperties2KHR = terminator_GetDisplayModeProperties2KHR,
-    .GetDisplayPlaneCapabilities2KHR = terminator_GetDisplayPlaneCapabilities2KHR,
+    table->GetPhysicalDeviceDisplayProperties2KHR = terminator_GetPhysicalDeviceDisplayProperties2KHR;
+    table->GetPhysicalDeviceDisplayPlaneProperties2KHR = terminator_GetPhysicalDeviceDisplayPlaneProperties2KHR;
+    table->GetDisplayModeProperties2KHR = terminator_GetDisplayModeProperties2KHR;
+    table->GetDisplayPlaneCapabilities2KHR = terminator_GetDisplayPlaneCapabilities2KHR;
 
     // ---- VK_KHR_fragment_shading_rate extension commands
-    .GetPhysicalDeviceFragmentShadingRatesKHR = terminator_GetPhysicalDeviceFragmentShadingRatesKHR,
+    table->GetPhysicalDeviceFragmentShadingRatesKHR = terminator_GetPhysicalDeviceFragmentShadingRatesKHR;
 
     // ---- VK_EXT_debug_report extension commands
-    .CreateDebugReportCallbackEXT = terminator_CreateDebugReportCallbackEXT,
-    .DestroyDebugReportCallbackEXT = terminator_DestroyDebugReportCallbackEXT,
-    .DebugReportMessageEXT = terminator_DebugReportMessageEXT,
+    table->CreateDebugReportCallbackEXT = terminator_CreateDebugReportCallbackEXT;
+    table->DestroyDebugReportCallbackEXT = terminator_DestroyDebugReportCallbackEXT;
+    table->DebugReportMessageEXT = terminator_DebugReportMessageEXT;
 
     // ---- VK_GGP_stream_descriptor_surface extension commands
 #ifdef VK_USE_PLATFORM_GGP
-    .CreateStreamDescriptorSurfaceGGP = terminator_CreateStreamDescriptorSurfaceGGP,
+    table->CreateStreamDescriptorSurfaceGGP = terminator_CreateStreamDescriptorSurfaceGGP;
 #endif // VK_USE_PLATFORM_GGP
 
     // ---- VK_NV_external_memory_capabilities extension commands
-    .GetPhysicalDeviceExternalImageFormatPropertiesNV = terminator_GetPhysicalDeviceExternalImageFormatPropertiesNV,
+    table->GetPhysicalDeviceExternalImageFormatPropertiesNV = terminator_GetPhysicalDeviceExternalImageFormatPropertiesNV;
 
     // ---- VK_NN_vi_surface extension commands
 #ifdef VK_USE_PLATFORM_VI_NN
-    .CreateViSurfaceNN = terminator_CreateViSurfaceNN,
+    table->CreateViSurfaceNN = terminator_CreateViSurfaceNN;
 #endif // VK_USE_PLATFORM_VI_NN
 
     // ---- VK_EXT_direct_mode_display extension commands
-    .ReleaseDisplayEXT = terminator_ReleaseDisplayEXT,
+    table->ReleaseDisplayEXT = terminator_ReleaseDisplayEXT;
 
     // ---- VK_EXT_acquire_xlib_display extension commands
 #ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    .AcquireXlibDisplayEXT = terminator_AcquireXlibDisplayEXT,
+    table->AcquireXlibDisplayEXT = terminator_AcquireXlibDisplayEXT;
 #endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
 #ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    .GetRandROutputDisplayEXT = terminator_GetRandROutputDisplayEXT,
+    table->GetRandROutputDisplayEXT = terminator_GetRandROutputDisplayEXT;
 #endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
 
     // ---- VK_EXT_display_surface_counter extension commands
-    .GetPhysicalDeviceSurfaceCapabilities2EXT = terminator_GetPhysicalDeviceSurfaceCapabilities2EXT,
+    table->GetPhysicalDeviceSurfaceCapabilities2EXT = terminator_GetPhysicalDeviceSurfaceCapabilities2EXT;
 
     // ---- VK_MVK_ios_surface extension commands
 #ifdef VK_USE_PLATFORM_IOS_MVK
-    .CreateIOSSurfaceMVK = terminator_CreateIOSSurfaceMVK,
+    table->CreateIOSSurfaceMVK = terminator_CreateIOSSurfaceMVK;
 #endif // VK_USE_PLATFORM_IOS_MVK
 
     // ---- VK_MVK_macos_surface extension commands
 #ifdef VK_USE_PLATFORM_MACOS_MVK
-    .CreateMacOSSurfaceMVK = terminator_CreateMacOSSurfaceMVK,
+    table->CreateMacOSSurfaceMVK = terminator_CreateMacOSSurfaceMVK;
 #endif // VK_USE_PLATFORM_MACOS_MVK
 
     // ---- VK_EXT_debug_utils extension commands
-    .CreateDebugUtilsMessengerEXT = terminator_CreateDebugUtilsMessengerEXT,
-    .DestroyDebugUtilsMessengerEXT = terminator_DestroyDebugUtilsMessengerEXT,
-    .SubmitDebugUtilsMessageEXT = terminator_SubmitDebugUtilsMessageEXT,
+    table->CreateDebugUtilsMessengerEXT = terminator_CreateDebugUtilsMessengerEXT;
+    table->DestroyDebugUtilsMessengerEXT = terminator_DestroyDebugUtilsMessengerEXT;
+    table->SubmitDebugUtilsMessageEXT = terminator_SubmitDebugUtilsMessageEXT;
 
     // ---- VK_EXT_sample_locations extension commands
-    .GetPhysicalDeviceMultisamplePropertiesEXT = terminator_GetPhysicalDeviceMultisamplePropertiesEXT,
+    table->GetPhysicalDeviceMultisamplePropertiesEXT = terminator_GetPhysicalDeviceMultisamplePropertiesEXT;
 
     // ---- VK_EXT_calibrated_timestamps extension commands
-    .GetPhysicalDeviceCalibrateableTimeDomainsEXT = terminator_GetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    table->GetPhysicalDeviceCalibrateableTimeDomainsEXT = terminator_GetPhysicalDeviceCalibrateableTimeDomainsEXT;
 
     // ---- VK_FUCHSIA_imagepipe_surface extension commands
 #ifdef VK_USE_PLATFORM_FUCHSIA
-    .CreateImagePipeSurfaceFUCHSIA = terminator_CreateImagePipeSurfaceFUCHSIA,
+    table->CreateImagePipeSurfaceFUCHSIA = terminator_CreateImagePipeSurfaceFUCHSIA;
 #endif // VK_USE_PLATFORM_FUCHSIA
 
     // ---- VK_EXT_metal_surface extension commands
 #ifdef VK_USE_PLATFORM_METAL_EXT
-    .CreateMetalSurfaceEXT = terminator_CreateMetalSurfaceEXT,
+    table->CreateMetalSurfaceEXT = terminator_CreateMetalSurfaceEXT;
 #endif // VK_USE_PLATFORM_METAL_EXT
 
     // ---- VK_EXT_tooling_info extension commands
-    .GetPhysicalDeviceToolPropertiesEXT = terminator_GetPhysicalDeviceToolPropertiesEXT,
+    table->GetPhysicalDeviceToolPropertiesEXT = terminator_GetPhysicalDeviceToolPropertiesEXT;
 
     // ---- VK_NV_cooperative_matrix extension commands
-    .GetPhysicalDeviceCooperativeMatrixPropertiesNV = terminator_GetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    table->GetPhysicalDeviceCooperativeMatrixPropertiesNV = terminator_GetPhysicalDeviceCooperativeMatrixPropertiesNV;
 
     // ---- VK_NV_coverage_reduction_mode extension commands
-    .GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = terminator_GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+    table->GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = terminator_GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
 
     // ---- VK_EXT_full_screen_exclusive extension commands
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    .GetPhysicalDeviceSurfacePresentModes2EXT = terminator_GetPhysicalDeviceSurfacePresentModes2EXT,
+    table->GetPhysicalDeviceSurfacePresentModes2EXT = terminator_GetPhysicalDeviceSurfacePresentModes2EXT;
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
     // ---- VK_EXT_headless_surface extension commands
-    .CreateHeadlessSurfaceEXT = terminator_CreateHeadlessSurfaceEXT,
+    table->CreateHeadlessSurfaceEXT = terminator_CreateHeadlessSurfaceEXT;
 
     // ---- VK_EXT_acquire_drm_display extension commands
-    .AcquireDrmDisplayEXT = terminator_AcquireDrmDisplayEXT,
-    .GetDrmDisplayEXT = terminator_GetDrmDisplayEXT,
+    table->AcquireDrmDisplayEXT = terminator_AcquireDrmDisplayEXT;
+    table->GetDrmDisplayEXT = terminator_GetDrmDisplayEXT;
 
     // ---- VK_NV_acquire_winrt_display extension commands
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    .AcquireWinrtDisplayNV = terminator_AcquireWinrtDisplayNV,
+    table->AcquireWinrtDisplayNV = terminator_AcquireWinrtDisplayNV;
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    .GetWinrtDisplayNV = terminator_GetWinrtDisplayNV,
+    table->GetWinrtDisplayNV = terminator_GetWinrtDisplayNV;
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
     // ---- VK_EXT_directfb_surface extension commands
 #ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-    .CreateDirectFBSurfaceEXT = terminator_CreateDirectFBSurfaceEXT,
+    table->CreateDirectFBSurfaceEXT = terminator_CreateDirectFBSurfaceEXT;
 #endif // VK_USE_PLATFORM_DIRECTFB_EXT
 #ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-    .GetPhysicalDeviceDirectFBPresentationSupportEXT = terminator_GetPhysicalDeviceDirectFBPresentationSupportEXT,
+    table->GetPhysicalDeviceDirectFBPresentationSupportEXT = terminator_GetPhysicalDeviceDirectFBPresentationSupportEXT;
 #endif // VK_USE_PLATFORM_DIRECTFB_EXT
 
     // ---- VK_QNX_screen_surface extension commands
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-    .CreateScreenSurfaceQNX = terminator_CreateScreenSurfaceQNX,
+    table->CreateScreenSurfaceQNX = terminator_CreateScreenSurfaceQNX;
 #endif // VK_USE_PLATFORM_SCREEN_QNX
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-    .GetPhysicalDeviceScreenPresentationSupportQNX = terminator_GetPhysicalDeviceScreenPresentationSupportQNX,
+    table->GetPhysicalDeviceScreenPresentationSupportQNX = terminator_GetPhysicalDeviceScreenPresentationSupportQNX;
 #endif // VK_USE_PLATFORM_SCREEN_QNX
 
     // ---- VK_NV_optical_flow extension commands
-    .GetPhysicalDeviceOpticalFlowImageFormatsNV = terminator_GetPhysicalDeviceOpticalFlowImageFormatsNV,
-};
+    table->GetPhysicalDeviceOpticalFlowImageFormatsNV = terminator_GetPhysicalDeviceOpticalFlowImageFormatsNV;
+}
 
-// A null-terminated list of all of the instance extensions supported by the loader.
+// All of the instance extensions supported by the loader, as one string of null-terminated names.
 // If an instance extension name is not in this list, but it is exported by one or more of the
 // ICDs detected by the loader, then the extension name not in the list will be filtered out
 // before passing the list of extensions to the application.
-const char *const LOADER_INSTANCE_EXTENSIONS[] = {
-                                                  VK_KHR_SURFACE_EXTENSION_NAME,
-                                                  VK_KHR_DISPLAY_EXTENSION_NAME,
+static const char loader_instance_extension_names[] =
+    "VK_KHR_surface\0"
+    "VK_KHR_display\0"
+    "VK_KHR_xlib_surface\0"
+    "VK_KHR_xcb_surface\0"
+    "VK_KHR_wayland_surface\0"
+    "VK_KHR_win32_surface\0"
+    "VK_KHR_get_physical_device_properties2\0"
+    "VK_KHR_device_group_creation\0"
+    "VK_KHR_external_memory_capabilities\0"
+    "VK_KHR_external_semaphore_capabilities\0"
+    "VK_KHR_external_fence_capabilities\0"
+    "VK_KHR_get_surface_capabilities2\0"
+    "VK_KHR_get_display_properties2\0"
+    "VK_KHR_surface_protected_capabilities\0"
+    "VK_KHR_portability_enumeration\0"
+    "VK_EXT_debug_report\0"
+    "VK_GGP_stream_descriptor_surface\0"
+    "VK_NV_external_memory_capabilities\0"
+    "VK_EXT_validation_flags\0"
+    "VK_NN_vi_surface\0"
+    "VK_EXT_direct_mode_display\0"
+    "VK_EXT_acquire_xlib_display\0"
+    "VK_EXT_display_surface_counter\0"
+    "VK_EXT_swapchain_colorspace\0"
+    "VK_MVK_ios_surface\0"
+    "VK_MVK_macos_surface\0"
+    "VK_EXT_debug_utils\0"
+    "VK_FUCHSIA_imagepipe_surface\0"
+    "VK_EXT_metal_surface\0"
+    "VK_EXT_validation_features\0"
+    "VK_EXT_headless_surface\0"
+    "VK_EXT_acquire_drm_display\0"
+    "VK_EXT_directfb_surface\0"
+    "VK_QNX_screen_surface\0"
+    "VK_GOOGLE_surfaceless_query\0"
+    ;
+
+// Perfect hash set of the supported instance extensions, indexed by the seeded FNV-1a hash of the extension name.
+// Each slot holds one plus the offset of the name in loader_instance_extension_names, or zero if the slot is empty.
+#define LOADER_INSTANCE_EXTENSION_HASH_SEED 180u
+#define LOADER_INSTANCE_EXTENSION_HASH_MASK 127u
+static const uint16_t loader_instance_extension_hash_set[128] = {
+    [1] = 292, // VK_KHR_get_surface_capabilities2
+    [7] = 478, // VK_NV_external_memory_capabilities
+    [12] = 804, // VK_EXT_headless_surface
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-                                                  VK_KHR_XLIB_SURFACE_EXTENSION_NAME,
+    [15] = 31, // VK_KHR_xlib_surface
 #endif // VK_USE_PLATFORM_XLIB_KHR
-#ifdef VK_USE_PLATFORM_XCB_KHR
-                                                  VK_KHR_XCB_SURFACE_EXTENSION_NAME,
-#endif // VK_USE_PLATFORM_XCB_KHR
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-                                                  VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME,
-#endif // VK_USE_PLATFORM_WAYLAND_KHR
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-                                                  VK_KHR_WIN32_SURFACE_EXTENSION_NAME,
-#endif // VK_USE_PLATFORM_WIN32_KHR
-                                                  VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
-                                                  VK_KHR_DEVICE_GROUP_CREATION_EXTENSION_NAME,
-                                                  VK_KHR_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME,
-                                                  VK_KHR_EXTERNAL_SEMAPHORE_CAPABILITIES_EXTENSION_NAME,
-                                                  VK_KHR_EXTERNAL_FENCE_CAPABILITIES_EXTENSION_NAME,
-                                                  VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME,
-                                                  VK_KHR_GET_DISPLAY_PROPERTIES_2_EXTENSION_NAME,
-                                                  VK_KHR_SURFACE_PROTECTED_CAPABILITIES_EXTENSION_NAME,
-                                                  VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME,
-                                                  VK_EXT_DEBUG_REPORT_EXTENSION_NAME,
-#ifdef VK_USE_PLATFORM_GGP
-                                                  VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME,
-#endif // VK_USE_PLATFORM_GGP
-                                                  VK_NV_EXTERNAL_MEMORY_CAPABILITIES_EXTENSION_NAME,
-                                                  VK_EXT_VALIDATION_FLAGS_EXTENSION_NAME,
-#ifdef VK_USE_PLATFORM_VI_NN
-                                                  VK_NN_VI_SURFACE_EXTENSION_NAME,
-#endif // VK_USE_PLATFORM_VI_NN
-                                                  VK_EXT_DIRECT_MODE_DISPLAY_EXTENSION_NAME,
-#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-                                                  VK_EXT_ACQUIRE_XLIB_DISPLAY_EXTENSION_NAME,
-#endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
-                                                  VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME,
-                                                  VK_EXT_SWAPCHAIN_COLOR_SPACE_EXTENSION_NAME,
-#ifdef VK_USE_PLATFORM_IOS_MVK
-                                                  VK_MVK_IOS_SURFACE_EXTENSION_NAME,
-#endif // VK_USE_PLATFORM_IOS_MVK
+    [17] = 325, // VK_KHR_get_display_properties2
+    [21] = 609, // VK_EXT_display_surface_counter
 #ifdef VK_USE_PLATFORM_MACOS_MVK
-                                                  VK_MVK_MACOS_SURFACE_EXTENSION_NAME,
+    [23] = 687, // VK_MVK_macos_surface
 #endif // VK_USE_PLATFORM_MACOS_MVK
-                                                  VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
+    [24] = 828, // VK_EXT_acquire_drm_display
+#ifdef VK_USE_PLATFORM_GGP
+    [25] = 445, // VK_GGP_stream_descriptor_surface
+#endif // VK_USE_PLATFORM_GGP
+    [35] = 554, // VK_EXT_direct_mode_display
+    [38] = 708, // VK_EXT_debug_utils
+    [51] = 1, // VK_KHR_surface
 #ifdef VK_USE_PLATFORM_FUCHSIA
-                                                  VK_FUCHSIA_IMAGEPIPE_SURFACE_EXTENSION_NAME,
+    [56] = 727, // VK_FUCHSIA_imagepipe_surface
 #endif // VK_USE_PLATFORM_FUCHSIA
+    [57] = 640, // VK_EXT_swapchain_colorspace
+    [63] = 182, // VK_KHR_external_memory_capabilities
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    [69] = 93, // VK_KHR_win32_surface
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    [70] = 153, // VK_KHR_device_group_creation
 #ifdef VK_USE_PLATFORM_METAL_EXT
-                                                  VK_EXT_METAL_SURFACE_EXTENSION_NAME,
+    [73] = 756, // VK_EXT_metal_surface
 #endif // VK_USE_PLATFORM_METAL_EXT
-                                                  VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME,
-                                                  VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME,
-                                                  VK_EXT_ACQUIRE_DRM_DISPLAY_EXTENSION_NAME,
-#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
-                                                  VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME,
-#endif // VK_USE_PLATFORM_DIRECTFB_EXT
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
-                                                  VK_QNX_SCREEN_SURFACE_EXTENSION_NAME,
+    [78] = 879, // VK_QNX_screen_surface
 #endif // VK_USE_PLATFORM_SCREEN_QNX
-                                                  VK_GOOGLE_SURFACELESS_QUERY_EXTENSION_NAME,
-                                                  NULL };
+    [85] = 777, // VK_EXT_validation_features
+    [90] = 257, // VK_KHR_external_fence_capabilities
+    [91] = 356, // VK_KHR_surface_protected_capabilities
+    [92] = 394, // VK_KHR_portability_enumeration
+    [99] = 513, // VK_EXT_validation_flags
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    [103] = 855, // VK_EXT_directfb_surface
+#endif // VK_USE_PLATFORM_DIRECTFB_EXT
+    [105] = 114, // VK_KHR_get_physical_device_properties2
+#ifdef VK_USE_PLATFORM_VI_NN
+    [110] = 537, // VK_NN_vi_surface
+#endif // VK_USE_PLATFORM_VI_NN
+    [111] = 425, // VK_EXT_debug_report
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    [112] = 51, // VK_KHR_xcb_surface
+#endif // VK_USE_PLATFORM_XCB_KHR
+    [115] = 218, // VK_KHR_external_semaphore_capabilities
+    [119] = 16, // VK_KHR_display
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    [120] = 70, // VK_KHR_wayland_surface
+#endif // VK_USE_PLATFORM_WAYLAND_KHR
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    [122] = 581, // VK_EXT_acquire_xlib_display
+#endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    [123] = 901, // VK_GOOGLE_surfaceless_query
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    [125] = 668, // VK_MVK_ios_surface
+#endif // VK_USE_PLATFORM_IOS_MVK
+};
+
+bool loader_is_known_instance_extension(const char *name) {
+    uint32_t hash = 2166136261u ^ LOADER_INSTANCE_EXTENSION_HASH_SEED;
+    for (const char *c = name; *c != '\0'; ++c) {
+        hash ^= (uint8_t)*c;
+        hash *= 16777619u;
+    }
+    hash ^= hash >> 16;
+    uint16_t slot = loader_instance_extension_hash_set[hash & LOADER_INSTANCE_EXTENSION_HASH_MASK];
+    return 0 != slot && 0 == strcmp(name, &loader_instance_extension_names[slot - 1]);
+}
 
@@ -47,12 +47,12 @@ void extensions_create_instance(struct loader_instance *ptr_instance, const VkIn
 // a terminator.
 PFN_vkVoidFunction get_extension_device_proc_terminator(struct loader_device *dev, const char *name, bool* found_name);
 
-// Dispatch table properly filled in with appropriate terminators for the
+// Fill in a dispatch table with the appropriate terminators for the
 // supported extensions.
-extern const VkLayerInstanceDispatchTable instance_disp;
+void loader_init_instance_terminator_dispatch(VkLayerInstanceDispatchTable *table);
 
-// Array of extension strings for instance extensions we support.
-extern const char *const LOADER_INSTANCE_EXTENSIONS[];
+// Returns true if name is one of the instance extensions supported by the loader.
+bool loader_is_known_instance_extension(const char *name);
 
 VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_icd_term *icd_term, VkInstance inst,
                                                    const PFN_vkGetInstanceProcAddr fp_gipa);
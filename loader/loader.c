@@ -47,11 +47,13 @@
 #include "dirent_on_windows.h"
 #else  // _WIN32
 #include <dirent.h>
+#include <sys/stat.h>
 #endif  // _WIN32
 
 #include "allocation.h"
 #include "cJSON.h"
 #include "debug_utils.h"
+#include "driver_timeout.h"
 #include "loader_environment.h"
 #include "gpa_helper.h"
 #include "log.h"
@@ -87,6 +89,22 @@ loader_platform_thread_mutex loader_lock;
 loader_platform_thread_mutex loader_json_lock;
 loader_platform_thread_mutex loader_preload_icd_lock;
 loader_platform_thread_mutex loader_global_instance_list_lock;
+loader_platform_thread_mutex loader_surface_query_cache_lock;
+// Guards the unknown function name arrays of every loader_instance, the dispatch table entries which are filled in for them, and
+// the logical device lists of every loader_icd_term those entries are filled into
+loader_platform_thread_mutex loader_unknown_function_lock;
+// Serializes changes to the debug callbacks of every loader_instance, which are read without it. No other lock is taken while it is
+// held.
+loader_platform_thread_mutex loader_debug_callback_lock;
+// Guards the drivers which exceeded VK_LOADER_DRIVER_TIMEOUT_MS in this process
+loader_platform_thread_mutex loader_timed_out_driver_lock;
+
+// Guards the driver identity cache
+static loader_platform_thread_mutex loader_lazy_icd_lock;
+// Serializes the creation of the deferred driver instances of every loader_instance. It is held while the drivers create their
+// instances, so that a thread which needs them waits until another thread creating them is done, instead of using a driver
+// whose instance isn't created yet. Only loader_lazy_icd_lock is taken while it is held.
+static loader_platform_thread_mutex loader_deferred_icd_lock;
 
 // A list of ICDs that gets initialized when the loader does its global initialization. This list should never be used by anything
 // other than EnumerateInstanceExtensionProperties(), vkDestroyInstance, and loader_release(). This list does not change
@@ -95,6 +113,9 @@ loader_platform_thread_mutex loader_global_instance_list_lock;
 // vkCreateInstance.
 static struct loader_icd_tramp_list scanned_icds;
 
+// Set by VK_LOADER_FORK_SAFE when the loader is initialized
+static bool loader_fork_safe = false;
+
 LOADER_PLATFORM_THREAD_ONCE_DECLARATION(once_init);
 
 // Creates loader_api_version struct that contains the major and minor fields, setting patch to 0
@@ -157,10 +178,9 @@ static bool is_json(const char *path, size_t len) {
     return !strncmp(path, ".json", 5);
 }
 
-// Handle error from to library loading
-void loader_handle_load_library_error(const struct loader_instance *inst, const char *filename,
-                                      enum loader_layer_library_status *lib_status) {
-    const char *error_message = loader_platform_open_library_error(filename);
+// Report error_message, the error from a library failing to load
+static void loader_report_load_library_error(const struct loader_instance *inst, const char *error_message,
+                                             enum loader_layer_library_status *lib_status) {
     // If the error is due to incompatible architecture (eg 32 bit vs 64 bit), report it with INFO level
     // Discussed in Github issue 262 & 644
     // "wrong ELF class" is a linux error, " with error 193" is a windows error
@@ -176,6 +196,12 @@ void loader_handle_load_library_error(const struct loader_instance *inst, const
     loader_log(inst, err_flag, 0, error_message);
 }
 
+// Handle error from to library loading
+void loader_handle_load_library_error(const struct loader_instance *inst, const char *filename,
+                                      enum loader_layer_library_status *lib_status) {
+    loader_report_load_library_error(inst, loader_platform_open_library_error(filename), lib_status);
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL vkSetInstanceDispatch(VkInstance instance, void *object) {
     struct loader_instance *inst = loader_get_instance(instance);
     if (!inst) {
@@ -1087,8 +1113,8 @@ static VkExtensionProperties *get_dev_extension_property(const char *name, const
 // requests
 // loader_coalesce_extensions(void) - add extension records to the list of global
 //                                    extension available to the app.
-// instance_disp                    - add function pointer for terminator function
-//                                    to this array.
+// loader_init_instance_terminator_dispatch - add function pointer for terminator
+//                                            function to this table.
 // The extension itself should be in a separate file that will be linked directly
 // with the loader.
 VkResult loader_get_icd_loader_instance_extensions(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
@@ -1115,26 +1141,17 @@ VkResult loader_get_icd_loader_instance_extensions(const struct loader_instance
                                              icd_tramp_list->scanned_list[i].lib_name, &icd_exts);
         if (VK_SUCCESS == res) {
             if (filter_extensions) {
-                // Remove any extensions not recognized by the loader
-                for (int32_t j = 0; j < (int32_t)icd_exts.count; j++) {
-                    // See if the extension is in the list of supported extensions
-                    bool found = false;
-                    for (uint32_t k = 0; LOADER_INSTANCE_EXTENSIONS[k] != NULL; k++) {
-                        if (strcmp(icd_exts.list[j].extensionName, LOADER_INSTANCE_EXTENSIONS[k]) == 0) {
-                            found = true;
-                            break;
-                        }
-                    }
-
-                    // If it isn't in the list, remove it
-                    if (!found) {
-                        for (uint32_t k = j + 1; k < icd_exts.count; k++) {
-                            icd_exts.list[k - 1] = icd_exts.list[k];
+                // Remove any extensions not recognized by the loader, keeping the rest in their original order
+                uint32_t kept = 0;
+                for (uint32_t j = 0; j < icd_exts.count; j++) {
+                    if (loader_is_known_instance_extension(icd_exts.list[j].extensionName)) {
+                        if (kept != j) {
+                            icd_exts.list[kept] = icd_exts.list[j];
                         }
-                        --icd_exts.count;
-                        --j;
+                        kept++;
                     }
                 }
+                icd_exts.count = kept;
             }
 
             res = loader_add_to_ext_list(inst, inst_exts, icd_exts.count, icd_exts.list);
@@ -1211,8 +1228,12 @@ struct loader_device *loader_create_logical_device(const struct loader_instance
 }
 
 void loader_add_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term, struct loader_device *dev) {
+    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
+    loader_platform_thread_lock_mutex(&loader_global_instance_list_lock);
     dev->next = icd_term->logical_device_list;
     icd_term->logical_device_list = dev;
+    loader_platform_thread_unlock_mutex(&loader_global_instance_list_lock);
+    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
 }
 
 void loader_remove_logical_device(const struct loader_instance *inst, struct loader_icd_term *icd_term,
@@ -1221,6 +1242,8 @@ void loader_remove_logical_device(const struct loader_instance *inst, struct loa
 
     if (!icd_term || !found_dev) return;
 
+    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
+    loader_platform_thread_lock_mutex(&loader_global_instance_list_lock);
     prev_dev = NULL;
     dev = icd_term->logical_device_list;
     while (dev && dev != found_dev) {
@@ -1232,12 +1255,34 @@ void loader_remove_logical_device(const struct loader_instance *inst, struct loa
         prev_dev->next = found_dev->next;
     else
         icd_term->logical_device_list = found_dev->next;
+    loader_platform_thread_unlock_mutex(&loader_global_instance_list_lock);
+    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
     loader_destroy_logical_device(inst, found_dev, pAllocator);
 }
 
+static void loader_free_deferred_icd_create_info(const struct loader_instance *ptr_inst,
+                                                struct loader_deferred_icd_create_info *deferred_info) {
+    if (NULL == deferred_info) {
+        return;
+    }
+    if (NULL != deferred_info->enabled_extension_names) {
+        for (uint32_t i = 0; i < deferred_info->create_info.enabledExtensionCount; i++) {
+            loader_instance_heap_free(ptr_inst, deferred_info->enabled_extension_names[i]);
+        }
+        loader_instance_heap_free(ptr_inst, deferred_info->enabled_extension_names);
+    }
+    loader_instance_heap_free(ptr_inst, (void *)deferred_info->app_info.pApplicationName);
+    loader_instance_heap_free(ptr_inst, (void *)deferred_info->app_info.pEngineName);
+    loader_instance_heap_free(ptr_inst, (void *)deferred_info->validation_flags.pDisabledValidationChecks);
+    loader_instance_heap_free(ptr_inst, (void *)deferred_info->validation_features.pEnabledValidationFeatures);
+    loader_instance_heap_free(ptr_inst, (void *)deferred_info->validation_features.pDisabledValidationFeatures);
+    loader_instance_heap_free(ptr_inst, deferred_info);
+}
+
 void loader_icd_destroy(struct loader_instance *ptr_inst, struct loader_icd_term *icd_term,
                         const VkAllocationCallbacks *pAllocator) {
     ptr_inst->total_icd_count--;
+    loader_free_deferred_icd_create_info(ptr_inst, icd_term->deferred_create_info);
     for (struct loader_device *dev = icd_term->logical_device_list; dev;) {
         struct loader_device *next_dev = dev->next;
         loader_destroy_logical_device(ptr_inst, dev, pAllocator);
@@ -1326,14 +1371,48 @@ static VkResult loader_scanned_icd_init(const struct loader_instance *inst, stru
     return err;
 }
 
-static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
-                                       const char *filename, uint32_t api_version, enum loader_layer_library_status *lib_status) {
+// The part of adding a driver which runs its code: opening its library, which runs its constructors, and negotiating its
+// interface version. Owned by the thread running it if the call is abandoned for taking too long, so it holds its own copy of
+// the file name.
+struct loader_icd_load_call {
+    char *filename;
+    loader_platform_dl_handle handle;
+    uint64_t load_time_us;
+    bool negotiated;
+    uint32_t interface_version;
+    // Only retrievable on the thread which failed to open the library
+    char error_message[MAX_STRING_SIZE];
+};
+
+static void loader_icd_load_call_run(void *data) {
+    struct loader_icd_load_call *call = (struct loader_icd_load_call *)data;
+    uint64_t start_time = loader_platform_get_time_us();
+#if defined(__Fuchsia__)
+    call->handle = loader_platform_open_driver(call->filename);
+#else
+    call->handle = loader_platform_open_library(call->filename);
+#endif
+    call->load_time_us = loader_platform_get_time_us() - start_time;
+    if (NULL == call->handle) {
+        const char *error_message = loader_platform_open_library_error(call->filename);
+        (void)snprintf(call->error_message, sizeof(call->error_message), "%s", NULL != error_message ? error_message : "");
+        return;
+    }
+    call->negotiated = loader_get_icd_interface_version(
+        loader_platform_get_proc_address(call->handle, "vk_icdNegotiateLoaderICDInterfaceVersion"), &call->interface_version);
+}
+
+// A library which finishes opening after its call was abandoned is never closed, as the driver may still be running in it
+static void loader_icd_load_call_free(void *data) { loader_free(NULL, data); }
+
+static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struct loader_driver_budget *budget,
+                                       struct loader_icd_tramp_list *icd_tramp_list, const char *filename, uint32_t api_version,
+                                       enum loader_layer_library_status *lib_status) {
     loader_platform_dl_handle handle = NULL;
     PFN_vkCreateInstance fp_create_inst;
     PFN_vkEnumerateInstanceExtensionProperties fp_get_inst_ext_props;
     PFN_vkGetInstanceProcAddr fp_get_proc_addr;
     PFN_GetPhysicalDeviceProcAddr fp_get_phys_dev_proc_addr = NULL;
-    PFN_vkNegotiateLoaderICDInterfaceVersion fp_negotiate_icd_version;
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
     PFN_vk_icdEnumerateAdapterPhysicalDevices fp_enum_dxgi_adapter_phys_devs = NULL;
 #endif
@@ -1352,21 +1431,48 @@ static VkResult loader_scanned_icd_add(const struct loader_instance *inst, struc
 
     // TODO implement smarter opening/closing of libraries. For now this
     // function leaves libraries open and the scanned_icd_clear closes them
-#if defined(__Fuchsia__)
-    handle = loader_platform_open_driver(filename);
-#else
-    handle = loader_platform_open_library(filename);
-#endif
+    struct loader_icd_load_call *load_call =
+        loader_calloc(NULL, sizeof(struct loader_icd_load_call) + strlen(filename) + 1, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == load_call) {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_scanned_icd_add: Out of memory can't add ICD %s", filename);
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    load_call->filename = (char *)(load_call + 1);
+    strcpy(load_call->filename, filename);
+
+    // Load the library and settle on an ICD interface version. A driver hanging in its library constructors is abandoned like
+    // one hanging in negotiation, but the C library holds its loader lock while running constructors, so the next library any
+    // thread opens still waits for them to return. The rest of the scan doesn't load any other driver, which would only time
+    // out and be quarantined in its place. Remembering the driver keeps later scans in this process from opening it again, and
+    // only VK_LOADER_DRIVER_QUARANTINE_FILE protects later processes.
+    if (!loader_call_driver_with_budget(inst, budget, loader_icd_load_call_run, loader_icd_load_call_free, load_call)) {
+        loader_log(inst, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_scanned_icd_add: ICD %s took longer than the %" PRIu64
+                   " ms allowed by VK_LOADER_DRIVER_TIMEOUT_MS to load, skip this ICD.",
+                   filename, budget->timeout_us / 1000);
+        loader_quarantine_driver(inst, budget, filename);
+        budget->library_load_abandoned = true;
+        if (NULL != lib_status) {
+            *lib_status = LOADER_LAYER_LIB_ERROR_FAILED_TO_LOAD;
+        }
+        res = VK_ERROR_INCOMPATIBLE_DRIVER;
+        goto out;
+    }
+    handle = load_call->handle;
+    bool negotiated = load_call->negotiated;
+    interface_vers = load_call->interface_version;
     if (NULL == handle) {
-        loader_handle_load_library_error(inst, filename, lib_status);
+        loader_report_load_library_error(inst, load_call->error_message, lib_status);
+        loader_free(NULL, load_call);
         res = VK_ERROR_INCOMPATIBLE_DRIVER;
         goto out;
     }
+    loader_log(inst, VULKAN_LOADER_PERF_BIT, 0, LOADER_PERF_MESSAGE_PREFIX "library_load kind=driver us=%" PRIu64 " path=%s",
+               load_call->load_time_us, filename);
+    loader_free(NULL, load_call);
 
-    // Get and settle on an ICD interface version
-    fp_negotiate_icd_version = loader_platform_get_proc_address(handle, "vk_icdNegotiateLoaderICDInterfaceVersion");
-
-    if (!loader_get_icd_interface_version(fp_negotiate_icd_version, &interface_vers)) {
+    if (!negotiated) {
         loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "loader_scanned_icd_add: ICD %s doesn't support interface version compatible with loader, skip this ICD.",
                    filename);
@@ -1491,15 +1597,370 @@ out:
     return res;
 }
 
+// Most PCI vendors a driver manifest can declare with "pci_vendor_ids"
+#define MAX_DRIVER_PCI_VENDOR_IDS 16
+
+struct ICDManifestInfo {
+    char full_library_path[MAX_STRING_SIZE];
+    uint32_t version;
+    bool is_portability_driver;
+    // Zero when the manifest doesn't declare which PCI vendors the driver serves
+    uint32_t pci_vendor_id_count;
+    uint32_t pci_vendor_ids[MAX_DRIVER_PCI_VENDOR_IDS];
+};
+
+// With VK_LOADER_FORK_SAFE, only the first driver scan of the process searches for and parses the driver manifests. Every later
+// scan, including those of child processes forked afterwards, reuses the parsed manifests kept here, unless one of the
+// environment variables naming driver manifests has changed since, in which case the manifests are searched for again.
+// Guarded by loader_json_lock.
+struct loader_driver_manifest {
+    char *filename;
+    struct ICDManifestInfo info;
+};
+
+#define LOADER_DRIVER_MANIFEST_ENV_VAR_COUNT 3
+static const char *loader_driver_manifest_env_vars[LOADER_DRIVER_MANIFEST_ENV_VAR_COUNT] = {
+    VK_DRIVER_FILES_ENV_VAR, VK_ICD_FILENAMES_ENV_VAR, VK_ADDITIONAL_DRIVER_FILES_ENV_VAR};
+
+static struct loader_driver_manifest *loader_driver_manifest_snapshot = NULL;
+static uint32_t loader_driver_manifest_snapshot_count = 0;
+static bool loader_driver_manifest_snapshot_valid = false;
+// The values of loader_driver_manifest_env_vars when the snapshot was made, NULL for those which weren't set
+static char *loader_driver_manifest_snapshot_env[LOADER_DRIVER_MANIFEST_ENV_VAR_COUNT] = {NULL};
+
+// Must be called with loader_json_lock held. Returns false when out of memory.
+static bool loader_save_driver_manifest_snapshot_env(const struct loader_instance *inst) {
+    for (uint32_t i = 0; i < LOADER_DRIVER_MANIFEST_ENV_VAR_COUNT; i++) {
+        char *env_value = loader_secure_getenv(loader_driver_manifest_env_vars[i], inst);
+        if (NULL != env_value) {
+            loader_driver_manifest_snapshot_env[i] = loader_alloc(NULL, strlen(env_value) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL != loader_driver_manifest_snapshot_env[i]) {
+                strcpy(loader_driver_manifest_snapshot_env[i], env_value);
+            }
+            loader_free_getenv(env_value, inst);
+            if (NULL == loader_driver_manifest_snapshot_env[i]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Must be called with loader_json_lock held.
+static bool loader_driver_manifest_snapshot_env_changed(const struct loader_instance *inst) {
+    bool changed = false;
+    for (uint32_t i = 0; i < LOADER_DRIVER_MANIFEST_ENV_VAR_COUNT && !changed; i++) {
+        char *env_value = loader_secure_getenv(loader_driver_manifest_env_vars[i], inst);
+        if (NULL == env_value || NULL == loader_driver_manifest_snapshot_env[i]) {
+            changed = env_value != loader_driver_manifest_snapshot_env[i];
+        } else {
+            changed = strcmp(env_value, loader_driver_manifest_snapshot_env[i]) != 0;
+        }
+        loader_free_getenv(env_value, inst);
+    }
+    return changed;
+}
+
+// Must be called with loader_json_lock held. Returns false when out of memory.
+static bool loader_add_to_driver_manifest_snapshot(const char *filename, const struct ICDManifestInfo *info) {
+    struct loader_driver_manifest *manifest = &loader_driver_manifest_snapshot[loader_driver_manifest_snapshot_count];
+    manifest->filename = loader_alloc(NULL, strlen(filename) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == manifest->filename) {
+        return false;
+    }
+    strcpy(manifest->filename, filename);
+    manifest->info = *info;
+    loader_driver_manifest_snapshot_count++;
+    return true;
+}
+
+static void loader_clear_driver_manifest_snapshot(void) {
+    for (uint32_t i = 0; i < loader_driver_manifest_snapshot_count; i++) {
+        loader_free(NULL, loader_driver_manifest_snapshot[i].filename);
+    }
+    loader_free(NULL, loader_driver_manifest_snapshot);
+    loader_driver_manifest_snapshot = NULL;
+    loader_driver_manifest_snapshot_count = 0;
+    loader_driver_manifest_snapshot_valid = false;
+    for (uint32_t i = 0; i < LOADER_DRIVER_MANIFEST_ENV_VAR_COUNT; i++) {
+        loader_free(NULL, loader_driver_manifest_snapshot_env[i]);
+        loader_driver_manifest_snapshot_env[i] = NULL;
+    }
+}
+
+struct loader_device_id {
+    uint32_t vendor_id;
+    uint32_t device_id;
+};
+
+// Number of physical devices each driver library exposed the last time its physical devices were enumerated. Used by
+// VK_LOADER_LAZY_DRIVER_INSTANCES to not create instances in drivers which are known not to expose any physical devices.
+// A driver can gain physical devices when its library is replaced or the environment it reads changes, so unless
+// VK_LOADER_LAZY_DRIVER_INSTANCES is strict, a count of zero is only trusted while both are unchanged.
+// When VK_LOADER_DEVICE_SELECT_PRUNE is set the vendor and device IDs of those physical devices are recorded too, which lets
+// VK_LOADER_DEVICE_SELECT_PRUNE skip loading drivers which can't expose the selected device.
+// The cache lives as long as the loader library and is guarded by loader_lazy_icd_lock. It is never written to disk, so
+// every process starts without it and its first instance loads every driver.
+struct loader_icd_identity {
+    char *lib_name;
+    uint32_t physical_device_count;
+    // The environment and library a physical_device_count of zero was reported with
+    uint64_t environment_hash;
+    uint64_t library_size;
+    int64_t library_modification_time;
+    // Whether device_ids were recorded during the last enumeration, in which case it has physical_device_count elements
+    bool device_ids_known;
+    struct loader_device_id *device_ids;
+};
+
+static struct loader_icd_identity *loader_icd_identity_cache = NULL;
+static uint32_t loader_icd_identity_cache_count = 0;
+static uint32_t loader_icd_identity_cache_capacity = 0;
+
+// Must be called with loader_lazy_icd_lock held
+static struct loader_icd_identity *loader_find_icd_identity(const char *lib_name) {
+    for (uint32_t i = 0; i < loader_icd_identity_cache_count; i++) {
+        if (0 == strcmp(loader_icd_identity_cache[i].lib_name, lib_name)) {
+            return &loader_icd_identity_cache[i];
+        }
+    }
+    return NULL;
+}
+
+// properties is ignored unless device_ids_known is set, as the physical device properties are only queried when they are needed
+static void loader_update_icd_identity(const char *lib_name, uint32_t physical_device_count, bool device_ids_known,
+                                       const VkPhysicalDeviceProperties *properties) {
+    // Only a count of zero is ever checked against them
+    uint64_t environment_hash = 0;
+    uint64_t library_size = 0;
+    int64_t library_modification_time = 0;
+    if (0 == physical_device_count) {
+        environment_hash = loader_get_environment_hash();
+        loader_get_library_identity(lib_name, &library_size, &library_modification_time);
+    }
+
+    loader_platform_thread_lock_mutex(&loader_lazy_icd_lock);
+    struct loader_icd_identity *identity = loader_find_icd_identity(lib_name);
+    if (NULL == identity) {
+        if (loader_icd_identity_cache_count == loader_icd_identity_cache_capacity) {
+            uint32_t new_capacity = (0 == loader_icd_identity_cache_capacity) ? 8 : loader_icd_identity_cache_capacity * 2;
+            struct loader_icd_identity *new_cache = loader_realloc(
+                NULL, loader_icd_identity_cache, loader_icd_identity_cache_capacity * sizeof(struct loader_icd_identity),
+                new_capacity * sizeof(struct loader_icd_identity), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            // The cache is only an optimization, so failing to grow it isn't an error
+            if (NULL == new_cache) {
+                goto out;
+            }
+            loader_icd_identity_cache = new_cache;
+            loader_icd_identity_cache_capacity = new_capacity;
+        }
+        char *name = loader_alloc(NULL, strlen(lib_name) + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == name) {
+            goto out;
+        }
+        strcpy(name, lib_name);
+        identity = &loader_icd_identity_cache[loader_icd_identity_cache_count++];
+        identity->lib_name = name;
+        identity->device_ids_known = false;
+        identity->device_ids = NULL;
+    }
+    // Keep the old device_ids buffer when the count hasn't changed so repeated enumerations don't allocate
+    if (NULL != identity->device_ids && (!device_ids_known || identity->physical_device_count != physical_device_count)) {
+        loader_free(NULL, identity->device_ids);
+        identity->device_ids = NULL;
+    }
+    identity->physical_device_count = physical_device_count;
+    identity->environment_hash = environment_hash;
+    identity->library_size = library_size;
+    identity->library_modification_time = library_modification_time;
+    identity->device_ids_known = false;
+    if (device_ids_known && physical_device_count > 0) {
+        if (NULL == identity->device_ids) {
+            identity->device_ids = loader_alloc(NULL, physical_device_count * sizeof(struct loader_device_id),
+                                                VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        }
+        if (NULL != identity->device_ids) {
+            for (uint32_t i = 0; i < physical_device_count; i++) {
+                identity->device_ids[i].vendor_id = properties[i].vendorID;
+                identity->device_ids[i].device_id = properties[i].deviceID;
+            }
+            identity->device_ids_known = true;
+        }
+    } else {
+        identity->device_ids_known = device_ids_known;
+    }
+out:
+    loader_platform_thread_unlock_mutex(&loader_lazy_icd_lock);
+}
+
+static void loader_clear_icd_identity_cache(void) {
+    for (uint32_t i = 0; i < loader_icd_identity_cache_count; i++) {
+        loader_free(NULL, loader_icd_identity_cache[i].lib_name);
+        loader_free(NULL, loader_icd_identity_cache[i].device_ids);
+    }
+    loader_free(NULL, loader_icd_identity_cache);
+    loader_icd_identity_cache = NULL;
+    loader_icd_identity_cache_count = 0;
+    loader_icd_identity_cache_capacity = 0;
+}
+
+#ifdef LOADER_ENABLE_LINUX_SORT
+// Must be called with loader_lazy_icd_lock held
+static bool loader_icd_identity_has_device(const struct loader_icd_identity *identity, const struct loader_device_id *device) {
+    for (uint32_t i = 0; i < identity->physical_device_count; i++) {
+        if (identity->device_ids[i].vendor_id == device->vendor_id && identity->device_ids[i].device_id == device->device_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns true and the selected device if VK_LOADER_DEVICE_SELECT_PRUNE is set and VK_LOADER_DEVICE_SELECT names a device.
+static bool loader_get_device_select_prune(const struct loader_instance *inst, struct loader_device_id *selected) {
+    bool prune = false;
+    char *env_value = loader_getenv("VK_LOADER_DEVICE_SELECT_PRUNE", inst);
+    if (NULL != env_value && atoi(env_value) != 0) {
+        prune = true;
+    }
+    loader_free_getenv(env_value, inst);
+    env_value = loader_getenv("VK_LOADER_DISABLE_SELECT", inst);
+    if (NULL != env_value && atoi(env_value) != 0) {
+        prune = false;
+    }
+    loader_free_getenv(env_value, inst);
+    return prune && linux_get_device_select(inst, &selected->vendor_id, &selected->device_id);
+}
+
+// Drivers are only pruned if a previous enumeration found the selected device in one of the known drivers. Otherwise every
+// driver has to be loaded to find out which one exposes it. Scans without an instance, such as the one done for
+// vkEnumerateInstanceExtensionProperties or to preload the drivers, are never pruned as they report on every driver.
+static bool loader_should_prune_icds(const struct loader_instance *inst, struct loader_device_id *selected) {
+    if (NULL == inst || !loader_get_device_select_prune(inst, selected)) {
+        return false;
+    }
+
+    bool cache_hit = false;
+    loader_platform_thread_lock_mutex(&loader_lazy_icd_lock);
+    for (uint32_t i = 0; i < loader_icd_identity_cache_count; i++) {
+        if (loader_icd_identity_cache[i].device_ids_known &&
+            loader_icd_identity_has_device(&loader_icd_identity_cache[i], selected)) {
+            cache_hit = true;
+            break;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_lazy_icd_lock);
+    if (!cache_hit) {
+        loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "VK_LOADER_DEVICE_SELECT_PRUNE is set but no known driver exposes device 0x%x:0x%x, loading every driver",
+                   selected->vendor_id, selected->device_id);
+    }
+    return cache_hit;
+}
+
+// Only drivers which are known to not expose the selected device can be skipped, drivers that haven't been enumerated with
+// VK_LOADER_DEVICE_SELECT set are always loaded.
+static bool loader_icd_may_expose_device(const char *lib_name, const struct loader_device_id *selected) {
+    loader_platform_thread_lock_mutex(&loader_lazy_icd_lock);
+    struct loader_icd_identity *identity = loader_find_icd_identity(lib_name);
+    bool may_expose = NULL == identity || !identity->device_ids_known || loader_icd_identity_has_device(identity, selected);
+    loader_platform_thread_unlock_mutex(&loader_lazy_icd_lock);
+    return may_expose;
+}
+
+static bool loader_pci_vendor_filter_disabled(const struct loader_instance *inst) {
+    char *env_value = loader_getenv("VK_LOADER_DISABLE_PCI_FILTER", inst);
+    bool disabled = NULL != env_value && atoi(env_value) != 0;
+    loader_free_getenv(env_value, inst);
+    return disabled;
+}
+
+static bool loader_icd_serves_present_pci_vendor(const struct ICDManifestInfo *icd, const struct linux_pci_vendors *present) {
+    for (uint32_t i = 0; i < icd->pci_vendor_id_count; i++) {
+        for (uint32_t j = 0; j < present->count; j++) {
+            if (icd->pci_vendor_ids[i] == present->vendor_ids[j]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+#endif  // LOADER_ENABLE_LINUX_SORT
+
+#if !defined(_WIN32) && !defined(__Fuchsia__)
+// With VK_LOADER_FORK_SAFE, every loader lock is held across fork() so that the child never inherits a lock owned by a thread
+// which doesn't exist in it, nor any of the state they guard in the middle of being modified. The locks are taken in the order
+// they nest in. This deadlocks if fork() is called by a thread that is inside the loader, such as by a driver during
+// vkCreateInstance, which is why it is opt-in.
+static void loader_fork_prepare(void) {
+    if (!loader_fork_safe) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_platform_thread_lock_mutex(&loader_preload_icd_lock);
+    loader_platform_thread_lock_mutex(&loader_json_lock);
+    loader_platform_thread_lock_mutex(&loader_deferred_icd_lock);
+    loader_platform_thread_lock_mutex(&loader_lazy_icd_lock);
+    loader_platform_thread_lock_mutex(&loader_surface_query_cache_lock);
+    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
+    loader_platform_thread_lock_mutex(&loader_global_instance_list_lock);
+    loader_platform_thread_lock_mutex(&loader_debug_callback_lock);
+    loader_platform_thread_lock_mutex(&loader_timed_out_driver_lock);
+    loader_debug_fork_prepare();
+}
+
+// Called in both the parent and the child, the thread which called fork() is the owner of every lock in both of them
+static void loader_fork_release(void) {
+    if (!loader_fork_safe) {
+        return;
+    }
+    loader_debug_fork_release();
+    loader_platform_thread_unlock_mutex(&loader_timed_out_driver_lock);
+    loader_platform_thread_unlock_mutex(&loader_debug_callback_lock);
+    loader_platform_thread_unlock_mutex(&loader_global_instance_list_lock);
+    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
+    loader_platform_thread_unlock_mutex(&loader_surface_query_cache_lock);
+    loader_platform_thread_unlock_mutex(&loader_lazy_icd_lock);
+    loader_platform_thread_unlock_mutex(&loader_deferred_icd_lock);
+    loader_platform_thread_unlock_mutex(&loader_json_lock);
+    loader_platform_thread_unlock_mutex(&loader_preload_icd_lock);
+    loader_platform_thread_unlock_mutex(&loader_lock);
+}
+
+static void loader_fork_safe_init(void) {
+    char *env_value = loader_getenv("VK_LOADER_FORK_SAFE", NULL);
+    loader_fork_safe = NULL != env_value && atoi(env_value) != 0;
+    loader_free_getenv(env_value, NULL);
+
+    // Fork handlers can't be unregistered, so they are only registered once even if the loader is initialized again
+    static bool fork_handlers_registered = false;
+    if (loader_fork_safe && !fork_handlers_registered) {
+        if (0 == pthread_atfork(loader_fork_prepare, loader_fork_release, loader_fork_release)) {
+            fork_handlers_registered = true;
+        } else {
+            loader_fork_safe = false;
+        }
+    }
+}
+#endif
+
 void loader_initialize(void) {
     // initialize mutexes
     loader_platform_thread_create_mutex(&loader_lock);
     loader_platform_thread_create_mutex(&loader_json_lock);
     loader_platform_thread_create_mutex(&loader_preload_icd_lock);
     loader_platform_thread_create_mutex(&loader_global_instance_list_lock);
+    loader_platform_thread_create_mutex(&loader_lazy_icd_lock);
+    loader_platform_thread_create_mutex(&loader_deferred_icd_lock);
+    loader_platform_thread_create_mutex(&loader_surface_query_cache_lock);
+    loader_platform_thread_create_mutex(&loader_unknown_function_lock);
+    loader_platform_thread_create_mutex(&loader_debug_callback_lock);
+    loader_platform_thread_create_mutex(&loader_timed_out_driver_lock);
 
     // initialize logging
     loader_debug_init();
+#if !defined(_WIN32) && !defined(__Fuchsia__)
+    loader_fork_safe_init();
+#endif
 #if defined(_WIN32)
     windows_initialization();
 #endif
@@ -1516,11 +1977,25 @@ void loader_release() {
     // Guarantee release of the preloaded ICD libraries. This may have already been called in vkDestroyInstance.
     loader_unload_preloaded_icds();
 
+    // The fork handlers stay registered, so they must stop using the mutexes before those are destroyed
+    loader_fork_safe = false;
+
     // release mutexes
     loader_platform_thread_delete_mutex(&loader_lock);
     loader_platform_thread_delete_mutex(&loader_json_lock);
     loader_platform_thread_delete_mutex(&loader_preload_icd_lock);
     loader_platform_thread_delete_mutex(&loader_global_instance_list_lock);
+    loader_platform_thread_delete_mutex(&loader_lazy_icd_lock);
+    loader_platform_thread_delete_mutex(&loader_deferred_icd_lock);
+    loader_platform_thread_delete_mutex(&loader_surface_query_cache_lock);
+    loader_platform_thread_delete_mutex(&loader_unknown_function_lock);
+    loader_platform_thread_delete_mutex(&loader_debug_callback_lock);
+    loader_platform_thread_delete_mutex(&loader_timed_out_driver_lock);
+
+    loader_clear_icd_identity_cache();
+    loader_clear_timed_out_drivers();
+    loader_clear_driver_manifest_snapshot();
+    loader_debug_release();
 }
 
 // Preload the ICD libraries that are likely to be needed so we don't repeatedly load/unload them later
@@ -1549,7 +2024,12 @@ void loader_unload_preloaded_icds(void) {
 }
 
 #if !defined(_WIN32)
+#if defined(BUILD_STATIC_LOADER)
+// Shares the once with the entry points, which may be called by the constructors of the application before this one runs
+__attribute__((constructor)) void loader_init_library() { LOADER_PLATFORM_THREAD_ONCE(&once_init, loader_initialize); }
+#else
 __attribute__((constructor)) void loader_init_library() { loader_initialize(); }
+#endif
 
 __attribute__((destructor)) void loader_free_library() { loader_release(); }
 #endif
@@ -1621,13 +2101,16 @@ static void loader_get_fullpath(const char *file, const char *in_dirs, size_t ou
 
 // Read a JSON file into a buffer.
 //
+// kind is "driver" or "layer", which is only used to report how long the manifest took to read.
+//
 // @return -  A pointer to a cJSON object representing the JSON parse tree.
 //            This returned buffer should be freed by caller.
-static VkResult loader_get_json(const struct loader_instance *inst, const char *filename, cJSON **json) {
+static VkResult loader_get_json(const struct loader_instance *inst, const char *kind, const char *filename, cJSON **json) {
     FILE *file = NULL;
     char *json_buf = NULL;
     size_t len;
     VkResult res = VK_SUCCESS;
+    uint64_t start_time = loader_platform_get_time_us();
 
     assert(json != NULL);
 
@@ -1691,6 +2174,10 @@ out:
     if (NULL != file) {
         fclose(file);
     }
+    if (VK_SUCCESS == res) {
+        loader_log(inst, VULKAN_LOADER_PERF_BIT, 0, LOADER_PERF_MESSAGE_PREFIX "manifest_read kind=%s us=%" PRIu64 " path=%s", kind,
+                   loader_platform_get_time_us() - start_time, filename);
+    }
 
     return res;
 }
@@ -2044,19 +2531,18 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
         }
 
         // Copy the component layers into the array
-        for (i = 0; i < count; i++) {
-            cJSON *comp_layer = cJSON_GetArrayItem(component_layers, i);
-            if (NULL != comp_layer) {
-                temp = cJSON_Print(comp_layer);
-                if (NULL == temp) {
-                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                    goto out;
-                }
-                temp[strlen(temp) - 1] = '\0';
-                strncpy(props->component_layer_names[i], temp + 1, MAX_STRING_SIZE - 1);
-                props->component_layer_names[i][MAX_STRING_SIZE - 1] = '\0';
-                loader_instance_heap_free(inst, temp);
+        // Walk the children directly, as looking up each index with cJSON_GetArrayItem is quadratic in the array size
+        cJSON *comp_layer = component_layers->child;
+        for (i = 0; i < count && NULL != comp_layer; i++, comp_layer = comp_layer->next) {
+            temp = cJSON_Print(comp_layer);
+            if (NULL == temp) {
+                result = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
             }
+            temp[strlen(temp) - 1] = '\0';
+            strncpy(props->component_layer_names[i], temp + 1, MAX_STRING_SIZE - 1);
+            props->component_layer_names[i][MAX_STRING_SIZE - 1] = '\0';
+            loader_instance_heap_free(inst, temp);
         }
 
         // This is now, officially, a meta-layer
@@ -2093,11 +2579,8 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
                 }
 
                 // Copy the blacklisted layers into the array
-                for (i = 0; i < (int)props->num_blacklist_layers; ++i) {
-                    cJSON *black_layer = cJSON_GetArrayItem(blacklisted_layers, i);
-                    if (black_layer == NULL) {
-                        continue;
-                    }
+                cJSON *black_layer = blacklisted_layers->child;
+                for (i = 0; i < (int)props->num_blacklist_layers && black_layer != NULL; ++i, black_layer = black_layer->next) {
                     temp = cJSON_Print(black_layer);
                     if (temp == NULL) {
                         result = VK_ERROR_OUT_OF_HOST_MEMORY;
@@ -2130,19 +2613,17 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
             }
 
             // Copy the override paths into the array
-            for (i = 0; i < count; i++) {
-                cJSON *override_path = cJSON_GetArrayItem(override_paths, i);
-                if (NULL != override_path) {
-                    temp = cJSON_Print(override_path);
-                    if (NULL == temp) {
-                        result = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        goto out;
-                    }
-                    temp[strlen(temp) - 1] = '\0';
-                    strncpy(props->override_paths[i], temp + 1, MAX_STRING_SIZE - 1);
-                    props->override_paths[i][MAX_STRING_SIZE - 1] = '\0';
-                    loader_instance_heap_free(inst, temp);
+            cJSON *override_path = override_paths->child;
+            for (i = 0; i < count && NULL != override_path; i++, override_path = override_path->next) {
+                temp = cJSON_Print(override_path);
+                if (NULL == temp) {
+                    result = VK_ERROR_OUT_OF_HOST_MEMORY;
+                    goto out;
                 }
+                temp[strlen(temp) - 1] = '\0';
+                strncpy(props->override_paths[i], temp + 1, MAX_STRING_SIZE - 1);
+                props->override_paths[i][MAX_STRING_SIZE - 1] = '\0';
+                loader_instance_heap_free(inst, temp);
             }
         }
     }
@@ -2268,9 +2749,7 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
     //   }
     GET_JSON_OBJECT(layer_node, instance_extensions)
     if (instance_extensions != NULL) {
-        int count = cJSON_GetArraySize(instance_extensions);
-        for (i = 0; i < count; i++) {
-            ext_item = cJSON_GetArrayItem(instance_extensions, i);
+        for (ext_item = instance_extensions->child; ext_item != NULL; ext_item = ext_item->next) {
             GET_JSON_ITEM(inst, ext_item, name)
             if (name != NULL) {
                 strncpy(ext_prop.extensionName, name, sizeof(ext_prop.extensionName));
@@ -2297,9 +2776,8 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
     //   }
     GET_JSON_OBJECT(layer_node, device_extensions)
     if (device_extensions != NULL) {
-        int count = cJSON_GetArraySize(device_extensions);
-        for (i = 0; i < count; i++) {
-            ext_item = cJSON_GetArrayItem(device_extensions, i);
+        for (cJSON *dev_ext_item = device_extensions->child; dev_ext_item != NULL; dev_ext_item = dev_ext_item->next) {
+            ext_item = dev_ext_item;
             GET_JSON_ITEM(inst, ext_item, name)
             GET_JSON_ITEM(inst, ext_item, spec_version)
             if (name != NULL) {
@@ -2322,8 +2800,8 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
             if (entry_count) {
                 entry_array = (char **)loader_stack_alloc(sizeof(char *) * entry_count);
             }
-            for (j = 0; j < entry_count; j++) {
-                ext_item = cJSON_GetArrayItem(entrypoints, j);
+            ext_item = entrypoints->child;
+            for (j = 0; j < entry_count && ext_item != NULL; j++, ext_item = ext_item->next) {
                 if (ext_item != NULL) {
                     temp = cJSON_Print(ext_item);
                     if (NULL == temp) {
@@ -2429,11 +2907,8 @@ static VkResult loader_read_layer_json(const struct loader_instance *inst, struc
             }
 
             // Copy the app_key_paths into the array
-            for (i = 0; i < (int)props->num_app_key_paths; ++i) {
-                cJSON *app_key_path = cJSON_GetArrayItem(app_keys, i);
-                if (app_key_path == NULL) {
-                    continue;
-                }
+            cJSON *app_key_path = app_keys->child;
+            for (i = 0; i < (int)props->num_app_key_paths && app_key_path != NULL; ++i, app_key_path = app_key_path->next) {
                 temp = cJSON_Print(app_key_path);
                 if (temp == NULL) {
                     result = VK_ERROR_OUT_OF_HOST_MEMORY;
@@ -2533,8 +3008,8 @@ static VkResult loader_add_layer_properties(const struct loader_instance *inst,
                        "version %s",
                        filename, file_vers);
         }
-        for (int curLayer = 0; curLayer < numItems; curLayer++) {
-            layer_node = cJSON_GetArrayItem(layers_node, curLayer);
+        layer_node = layers_node->child;
+        for (int curLayer = 0; curLayer < numItems; curLayer++, layer_node = layer_node->next) {
             if (layer_node == NULL) {
                 loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
                            "loader_add_layer_properties: Can not find 'layers' array element %d object in manifest JSON file %s.  "
@@ -2654,8 +3129,26 @@ static inline VkResult check_and_adjust_data_file_list(const struct loader_insta
                        "check_and_adjust_data_file_list: Failed to allocate space for manifest file name list");
             return VK_ERROR_OUT_OF_HOST_MEMORY;
         }
+        out_files->identity_list =
+            loader_instance_heap_alloc(inst, 64 * sizeof(struct loader_file_identity), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == out_files->identity_list) {
+            loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
+                       "check_and_adjust_data_file_list: Failed to allocate space for manifest file identity list");
+            loader_instance_heap_free(inst, out_files->filename_list);
+            out_files->filename_list = NULL;
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
         out_files->alloc_count = 64;
     } else if (out_files->count == out_files->alloc_count) {
+        void *new_identities = loader_instance_heap_realloc(
+            inst, out_files->identity_list, out_files->alloc_count * sizeof(struct loader_file_identity),
+            out_files->alloc_count * sizeof(struct loader_file_identity) * 2, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == new_identities) {
+            loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
+                       "check_and_adjust_data_file_list: Failed to reallocate space for manifest file identity list");
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        out_files->identity_list = new_identities;
         size_t new_size = out_files->alloc_count * sizeof(char *) * 2;
         void *new_ptr = loader_instance_heap_realloc(inst, out_files->filename_list, out_files->alloc_count * sizeof(char *),
                                                      new_size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
@@ -2671,10 +3164,42 @@ static inline VkResult check_and_adjust_data_file_list(const struct loader_insta
     return VK_SUCCESS;
 }
 
+// Find out which file file_name refers to, so that a manifest reached through a symlink or through overlapping search paths can be
+// recognized as one that was already found. Returns false if that can't be determined.
+static bool loader_get_file_identity(const char *file_name, struct loader_file_identity *identity) {
+#if defined(_WIN32)
+    (void)file_name;
+    (void)identity;
+    return false;
+#else
+    // stat follows symlinks, so a manifest reached through one is identified by the file it points to
+    struct stat file_stat;
+    if (0 != stat(file_name, &file_stat)) {
+        return false;
+    }
+    identity->device = (uint64_t)file_stat.st_dev;
+    identity->inode = (uint64_t)file_stat.st_ino;
+    return true;
+#endif
+}
+
 // add file_name to the out_files manifest list. Assumes its a valid manifest file name
 static VkResult add_manifest_file(const struct loader_instance *inst, const char *file_name, struct loader_data_files *out_files) {
     VkResult vk_result = VK_SUCCESS;
 
+    struct loader_file_identity identity = {0};
+    identity.known = loader_get_file_identity(file_name, &identity);
+    if (identity.known) {
+        for (uint32_t i = 0; i < out_files->count; i++) {
+            if (out_files->identity_list[i].known && out_files->identity_list[i].device == identity.device &&
+                out_files->identity_list[i].inode == identity.inode) {
+                loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Skipping manifest file %s, it is the same file as %s", file_name,
+                           out_files->filename_list[i]);
+                goto out;
+            }
+        }
+    }
+
     // Check and allocate space in the manifest list if necessary
     vk_result = check_and_adjust_data_file_list(inst, out_files);
     if (VK_SUCCESS != vk_result) {
@@ -2690,7 +3215,8 @@ static VkResult add_manifest_file(const struct loader_instance *inst, const char
         goto out;
     }
 
-    strcpy(out_files->filename_list[out_files->count++], file_name);
+    strcpy(out_files->filename_list[out_files->count], file_name);
+    out_files->identity_list[out_files->count++] = identity;
 
 out:
     return vk_result;
@@ -3196,6 +3722,7 @@ VkResult loader_get_data_files(const struct loader_instance *inst, enum loader_d
     out_files->count = 0;
     out_files->alloc_count = 0;
     out_files->filename_list = NULL;
+    out_files->identity_list = NULL;
 
     res = read_data_files_in_search_paths(inst, manifest_type, path_override, &override_active, out_files);
     if (VK_SUCCESS != res) {
@@ -3235,6 +3762,10 @@ VkResult loader_get_data_files(const struct loader_instance *inst, enum loader_d
 
 out:
 
+    // The identities are only needed while looking for duplicates
+    loader_instance_heap_free(inst, out_files->identity_list);
+    out_files->identity_list = NULL;
+
     if (VK_SUCCESS != res && NULL != out_files->filename_list) {
         for (uint32_t remove = 0; remove < out_files->count; remove++) {
             loader_instance_heap_free(inst, out_files->filename_list[remove]);
@@ -3248,15 +3779,35 @@ out:
     return res;
 }
 
-struct ICDManifestInfo {
-    char full_library_path[MAX_STRING_SIZE];
-    uint32_t version;
-};
+// Parses the optional "pci_vendor_ids" array of hex strings. A list which can't be used is ignored rather than rejecting the
+// manifest, as the only effect of the list is that the driver may be skipped.
+static void loader_parse_icd_pci_vendor_ids(const struct loader_instance *inst, const char *file_str, cJSON *item,
+                                            struct ICDManifestInfo *icd) {
+    int count = item->type == cJSON_Array ? cJSON_GetArraySize(item) : 0;
+    bool valid = count > 0 && count <= MAX_DRIVER_PCI_VENDOR_IDS;
+    for (int i = 0; valid && i < count; i++) {
+        cJSON *vendor = cJSON_GetArrayItem(item, i);
+        valid = NULL != vendor && vendor->type == cJSON_String && NULL != vendor->valuestring;
+        if (valid) {
+            char *end = NULL;
+            unsigned long vendor_id = strtoul(vendor->valuestring, &end, 16);
+            valid = end != vendor->valuestring && '\0' == *end && vendor_id <= 0xFFFF;
+            icd->pci_vendor_ids[i] = (uint32_t)vendor_id;
+        }
+    }
+    if (valid) {
+        icd->pci_vendor_id_count = (uint32_t)count;
+    } else {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_parse_icd_manifest: Ignoring the \'pci_vendor_ids\' field of ICD JSON %s, which must be an array of "
+                   "1 to %d hex strings",
+                   file_str, MAX_DRIVER_PCI_VENDOR_IDS);
+    }
+}
 
 // Takes a json file, opens, reads, and parses an ICD Manifest out of it.
 // Should only return VK_SUCCESS, VK_ERROR_INCOMPATIBLE_DRIVER, or VK_ERROR_OUT_OF_HOST_MEMORY
-VkResult loader_parse_icd_manifest(const struct loader_instance *inst, char *file_str, struct ICDManifestInfo *icd,
-                                   bool *skipped_portability_drivers) {
+VkResult loader_parse_icd_manifest(const struct loader_instance *inst, char *file_str, struct ICDManifestInfo *icd) {
     VkResult res = VK_SUCCESS;
     cJSON *json = NULL;
     cJSON *item = NULL, *itemICD = NULL;
@@ -3270,7 +3821,7 @@ VkResult loader_parse_icd_manifest(const struct loader_instance *inst, char *fil
         goto out;
     }
 
-    res = loader_get_json(inst, file_str, &json);
+    res = loader_get_json(inst, "driver", file_str, &json);
     if (res == VK_ERROR_OUT_OF_HOST_MEMORY) {
         goto out;
     }
@@ -3391,15 +3942,14 @@ VkResult loader_parse_icd_manifest(const struct loader_instance *inst, char *fil
         goto out;
     }
 
-    // Skip over ICD's which contain a true "is_portability_driver" value whenever the application doesn't enable
-    // portability enumeration.
+    // Whether the driver is skipped because of this depends on the instance, which is left to loader_icd_scan
     item = cJSON_GetObjectItem(itemICD, "is_portability_driver");
-    if (item != NULL && item->type == cJSON_True && inst && !inst->portability_enumeration_enabled) {
-        if (skipped_portability_drivers) {
-            *skipped_portability_drivers = true;
-        }
-        res = VK_ERROR_INCOMPATIBLE_DRIVER;
-        goto out;
+    icd->is_portability_driver = item != NULL && item->type == cJSON_True;
+
+    // Whether the driver is skipped because of this depends on the devices present, which is left to loader_icd_scan
+    item = cJSON_GetObjectItem(itemICD, "pci_vendor_ids");
+    if (item != NULL) {
+        loader_parse_icd_pci_vendor_ids(inst, file_str, item, icd);
     }
 
     item = cJSON_GetObjectItem(itemICD, "library_arch");
@@ -3445,12 +3995,15 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
     struct loader_data_files manifest_files;
     VkResult res = VK_SUCCESS;
     bool lockedMutex = false;
+    bool build_snapshot = false;
     struct loader_envvar_filter select_filter;
     struct loader_envvar_filter disable_filter;
+    struct loader_driver_budget budget;
 
     // Before we begin anything, init manifest_files to avoid a delete of garbage memory if
     // a failure occurs before allocating the manifest filename_list.
     memset(&manifest_files, 0, sizeof(struct loader_data_files));
+    loader_get_driver_budget(inst, &budget);
 
     // Parse the filter environment variables to determine if we have any special behavior
     res = parse_generic_filter_environment_var(inst, VK_DRIVERS_SELECT_ENV_VAR, &select_filter);
@@ -3467,35 +4020,90 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
         goto out;
     }
 
-    // Get a list of manifest files for ICDs
-    res = loader_get_data_files(inst, LOADER_DATA_FILE_MANIFEST_DRIVER, NULL, &manifest_files);
-    if (VK_SUCCESS != res || manifest_files.count == 0) {
-        goto out;
-    }
+#ifdef LOADER_ENABLE_LINUX_SORT
+    struct loader_device_id selected_device;
+    bool prune_icds = loader_should_prune_icds(inst, &selected_device);
+
+    // The PCI devices are only read once a driver declares which vendors it serves, and then only once per scan
+    bool filter_pci_vendors = !loader_pci_vendor_filter_disabled(inst);
+    bool pci_vendors_read = false;
+    struct linux_pci_vendors pci_vendors = {0};
+#endif
 
     loader_platform_thread_lock_mutex(&loader_json_lock);
     lockedMutex = true;
-    for (uint32_t i = 0; i < manifest_files.count; i++) {
-        VkResult icd_res = VK_SUCCESS;
-        struct ICDManifestInfo icd;
-        memset(&icd, 0, sizeof(struct ICDManifestInfo));
-        icd_res = loader_parse_icd_manifest(inst, manifest_files.filename_list[i], &icd, skipped_portability_drivers);
-        if (VK_ERROR_OUT_OF_HOST_MEMORY == icd_res) {
-            res = icd_res;
+
+    uint32_t manifest_count = 0;
+    bool use_snapshot = loader_fork_safe && loader_driver_manifest_snapshot_valid;
+    if (use_snapshot && loader_driver_manifest_snapshot_env_changed(inst)) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "Searching for driver manifests again as the driver manifest environment variables changed");
+        loader_clear_driver_manifest_snapshot();
+        use_snapshot = false;
+    }
+    if (use_snapshot) {
+        manifest_count = loader_driver_manifest_snapshot_count;
+    } else {
+        // Get a list of manifest files for ICDs
+        res = loader_get_data_files(inst, LOADER_DATA_FILE_MANIFEST_DRIVER, NULL, &manifest_files);
+        if (VK_SUCCESS != res || manifest_files.count == 0) {
             goto out;
-        } else if (VK_ERROR_INCOMPATIBLE_DRIVER == icd_res) {
-            continue;
         }
+        manifest_count = manifest_files.count;
 
-        if (select_filter.count > 0 || disable_filter.count > 0) {
-            // Get only the filename for comparing to the filters
-            char *just_filename_str = strrchr(manifest_files.filename_list[i], DIRECTORY_SYMBOL);
-
-            // No directory symbol, just the filename
-            if (NULL == just_filename_str) {
-                just_filename_str = manifest_files.filename_list[i];
-            } else {
-                just_filename_str++;
+        if (loader_fork_safe) {
+            loader_clear_driver_manifest_snapshot();
+            loader_driver_manifest_snapshot = loader_calloc(NULL, manifest_files.count * sizeof(struct loader_driver_manifest),
+                                                            VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            // The snapshot is only an optimization, so failing to allocate it isn't an error
+            build_snapshot = NULL != loader_driver_manifest_snapshot && loader_save_driver_manifest_snapshot_env(inst);
+            if (!build_snapshot) {
+                loader_clear_driver_manifest_snapshot();
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < manifest_count; i++) {
+        VkResult icd_res = VK_SUCCESS;
+        struct ICDManifestInfo icd;
+        char *manifest_filename;
+        if (use_snapshot) {
+            manifest_filename = loader_driver_manifest_snapshot[i].filename;
+            icd = loader_driver_manifest_snapshot[i].info;
+        } else {
+            manifest_filename = manifest_files.filename_list[i];
+            memset(&icd, 0, sizeof(struct ICDManifestInfo));
+            icd_res = loader_parse_icd_manifest(inst, manifest_filename, &icd);
+            if (VK_ERROR_OUT_OF_HOST_MEMORY == icd_res) {
+                res = icd_res;
+                goto out;
+            } else if (VK_ERROR_INCOMPATIBLE_DRIVER == icd_res) {
+                continue;
+            }
+            if (build_snapshot && !loader_add_to_driver_manifest_snapshot(manifest_filename, &icd)) {
+                loader_clear_driver_manifest_snapshot();
+                build_snapshot = false;
+            }
+        }
+
+        // Skip over ICD's which contain a true "is_portability_driver" value whenever the application doesn't enable
+        // portability enumeration.
+        if (icd.is_portability_driver && inst && !inst->portability_enumeration_enabled) {
+            if (skipped_portability_drivers) {
+                *skipped_portability_drivers = true;
+            }
+            continue;
+        }
+
+        if (select_filter.count > 0 || disable_filter.count > 0) {
+            // Get only the filename for comparing to the filters
+            char *just_filename_str = strrchr(manifest_filename, DIRECTORY_SYMBOL);
+
+            // No directory symbol, just the filename
+            if (NULL == just_filename_str) {
+                just_filename_str = manifest_filename;
+            } else {
+                just_filename_str++;
             }
 
             bool name_matches_select =
@@ -3517,8 +4125,41 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
             }
         }
 
+#ifdef LOADER_ENABLE_LINUX_SORT
+        if (prune_icds && !loader_icd_may_expose_device(icd.full_library_path, &selected_device)) {
+            loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                       "Driver \"%s\" not loaded because it doesn't expose the device selected by VK_LOADER_DEVICE_SELECT",
+                       icd.full_library_path);
+            continue;
+        }
+        if (filter_pci_vendors && icd.pci_vendor_id_count > 0) {
+            if (!pci_vendors_read) {
+                // Without a complete list of the PCI devices, no driver can be ruled out
+                filter_pci_vendors = linux_read_pci_vendors(inst, &pci_vendors);
+                pci_vendors_read = true;
+            }
+            if (filter_pci_vendors && !loader_icd_serves_present_pci_vendor(&icd, &pci_vendors)) {
+                loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                           "Driver \"%s\" not loaded because no PCI device from the vendors its manifest lists is present",
+                           icd.full_library_path);
+                continue;
+            }
+        }
+#endif
+
+        if (loader_driver_is_quarantined(inst, &budget, icd.full_library_path)) {
+            continue;
+        }
+        if (budget.library_load_abandoned) {
+            loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                       "Driver \"%s\" not loaded as the library of a driver which exceeded VK_LOADER_DRIVER_TIMEOUT_MS may "
+                       "still be opening",
+                       icd.full_library_path);
+            continue;
+        }
+
         enum loader_layer_library_status lib_status;
-        icd_res = loader_scanned_icd_add(inst, icd_tramp_list, icd.full_library_path, icd.version, &lib_status);
+        icd_res = loader_scanned_icd_add(inst, &budget, icd_tramp_list, icd.full_library_path, icd.version, &lib_status);
         if (VK_ERROR_OUT_OF_HOST_MEMORY == icd_res) {
             res = icd_res;
             goto out;
@@ -3547,6 +4188,13 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
     }
 
 out:
+    if (build_snapshot) {
+        if (VK_SUCCESS == res) {
+            loader_driver_manifest_snapshot_valid = true;
+        } else {
+            loader_clear_driver_manifest_snapshot();
+        }
+    }
     if (NULL != manifest_files.filename_list) {
         for (uint32_t i = 0; i < manifest_files.count; i++) {
             loader_instance_heap_free(inst, manifest_files.filename_list[i]);
@@ -3556,6 +4204,7 @@ out:
     if (lockedMutex) {
         loader_platform_thread_unlock_mutex(&loader_json_lock);
     }
+    loader_free_driver_budget(inst, &budget);
 
     return res;
 }
@@ -3605,7 +4254,7 @@ VkResult loader_scan_for_layers(struct loader_instance *inst, struct loader_laye
             }
 
             // Parse file into JSON struct
-            VkResult local_res = loader_get_json(inst, file_str, &json);
+            VkResult local_res = loader_get_json(inst, "layer", file_str, &json);
             if (VK_ERROR_OUT_OF_HOST_MEMORY == local_res) {
                 res = VK_ERROR_OUT_OF_HOST_MEMORY;
                 goto out;
@@ -3672,7 +4321,7 @@ VkResult loader_scan_for_layers(struct loader_instance *inst, struct loader_laye
             }
 
             // Parse file into JSON struct
-            VkResult local_res = loader_get_json(inst, file_str, &json);
+            VkResult local_res = loader_get_json(inst, "layer", file_str, &json);
             if (VK_ERROR_OUT_OF_HOST_MEMORY == local_res) {
                 res = VK_ERROR_OUT_OF_HOST_MEMORY;
                 goto out;
@@ -3768,7 +4417,7 @@ VkResult loader_scan_for_implicit_layers(struct loader_instance *inst, struct lo
         }
 
         // parse file into JSON struct
-        VkResult temp_res = loader_get_json(inst, file_str, &json);
+        VkResult temp_res = loader_get_json(inst, "layer", file_str, &json);
         if (VK_ERROR_OUT_OF_HOST_MEMORY == temp_res) {
             res = temp_res;
             goto out;
@@ -3838,7 +4487,7 @@ VkResult loader_scan_for_implicit_layers(struct loader_instance *inst, struct lo
             }
 
             // parse file into JSON struct
-            res = loader_get_json(inst, file_str, &json);
+            res = loader_get_json(inst, "layer", file_str, &json);
             if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
                 goto out;
             } else if (VK_SUCCESS != res || NULL == json) {
@@ -4031,6 +4680,24 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL loader_gpa_device_terminator(VkDevice d
     return icd_term->dispatch.GetDeviceProcAddr(device, pName);
 }
 
+// The core device commands which have to go through a loader terminator. Devices without layers fill their dispatch table
+// straight from the driver, and then replace these entries. The extension commands which need terminators are set by
+// init_extension_device_proc_terminator_dispatch instead.
+static const struct {
+    size_t table_offset;
+    PFN_vkVoidFunction terminator;
+} loader_core_device_terminators[] = {
+    {offsetof(VkLayerDispatchTable, GetDeviceProcAddr), (PFN_vkVoidFunction)loader_gpa_device_terminator},
+};
+
+#if defined(LOADER_ENABLE_TEST_HOOKS)
+static bool loader_test_device_dispatch_through_terminator = false;
+
+LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL loader_test_set_device_dispatch_through_terminator(VkBool32 enable) {
+    loader_test_device_dispatch_through_terminator = VK_TRUE == enable;
+}
+#endif
+
 struct loader_instance *loader_get_instance(const VkInstance instance) {
     // look up the loader_instance in our list by comparing dispatch tables, as
     // there is no guarantee the instance is still a loader_instance* after any
@@ -4054,11 +4721,14 @@ struct loader_instance *loader_get_instance(const VkInstance instance) {
 }
 
 static loader_platform_dl_handle loader_open_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop) {
+    uint64_t start_time = loader_platform_get_time_us();
     if ((prop->lib_handle = loader_platform_open_library(prop->lib_name)) == NULL) {
         loader_handle_load_library_error(inst, prop->lib_name, &prop->lib_status);
     } else {
         prop->lib_status = LOADER_LAYER_LIB_SUCCESS_LOADED;
         loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Loading layer library %s", prop->lib_name);
+        loader_log(inst, VULKAN_LOADER_PERF_BIT, 0, LOADER_PERF_MESSAGE_PREFIX "library_load kind=layer us=%" PRIu64 " path=%s",
+                   loader_platform_get_time_us() - start_time, prop->lib_name);
     }
 
     return prop->lib_handle;
@@ -4313,6 +4983,8 @@ out:
             // Need to iterate the linked lists and remove the device from it. Don't delete
             // the device here since it may not have been added to the icd_term and there
             // are other allocations attached to it.
+            loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
+            loader_platform_thread_lock_mutex(&loader_global_instance_list_lock);
             struct loader_icd_term *icd_term = inst->icd_terms;
             bool found = false;
             while (!found && NULL != icd_term) {
@@ -4334,6 +5006,8 @@ out:
                 }
                 icd_term = icd_term->next;
             }
+            loader_platform_thread_unlock_mutex(&loader_global_instance_list_lock);
+            loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
             // Now destroy the device and the allocations associated with it.
             loader_destroy_logical_device(inst, dev, pAllocator);
         }
@@ -4891,7 +5565,24 @@ VkResult loader_create_device_chain(const VkPhysicalDevice pd, const VkDeviceCre
     }
 
     // Initialize device dispatch table
-    loader_init_device_dispatch_table(&dev->loader_dispatch, nextGDPA, dev->chain_device);
+    bool fill_from_driver = nextGDPA == loader_gpa_device_terminator;
+#if defined(LOADER_ENABLE_TEST_HOOKS)
+    if (loader_test_device_dispatch_through_terminator) {
+        fill_from_driver = false;
+    }
+#endif
+    if (fill_from_driver) {
+        // Without any device layers, get the core commands straight from the driver instead of looking up every one of them
+        // through loader_gpa_device_terminator, then put back the ones which need a terminator.
+        loader_init_device_dispatch_table(&dev->loader_dispatch, dev->phys_dev_term->this_icd_term->dispatch.GetDeviceProcAddr,
+                                          dev->icd_device);
+        for (size_t i = 0; i < sizeof(loader_core_device_terminators) / sizeof(loader_core_device_terminators[0]); ++i) {
+            memcpy((char *)&dev->loader_dispatch.core_dispatch + loader_core_device_terminators[i].table_offset,
+                   &loader_core_device_terminators[i].terminator, sizeof(PFN_vkVoidFunction));
+        }
+    } else {
+        loader_init_device_dispatch_table(&dev->loader_dispatch, nextGDPA, dev->chain_device);
+    }
     // Initialize the dispatch table to functions which need terminators
     // These functions point directly to the driver, not the terminator functions
     init_extension_device_proc_terminator_dispatch(dev);
@@ -4928,19 +5619,12 @@ VkResult loader_validate_layers(const struct loader_instance *inst, const uint32
 }
 
 VkResult loader_validate_instance_extensions(struct loader_instance *inst, const struct loader_extension_list *icd_exts,
-                                             const struct loader_layer_list *instance_layers,
+                                             const struct loader_layer_list *expanded_layers,
                                              const VkInstanceCreateInfo *pCreateInfo) {
     VkExtensionProperties *extension_prop;
     char *env_value;
     bool check_if_known = true;
     VkResult res = VK_SUCCESS;
-    struct loader_envvar_filter layers_enable_filter;
-    struct loader_envvar_disable_layers_filter layers_disable_filter;
-
-    struct loader_layer_list active_layers;
-    struct loader_layer_list expanded_layers;
-    memset(&active_layers, 0, sizeof(active_layers));
-    memset(&expanded_layers, 0, sizeof(expanded_layers));
 
     if (pCreateInfo->enabledExtensionCount > 0 && pCreateInfo->ppEnabledExtensionNames == NULL) {
         loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
@@ -4948,39 +5632,13 @@ VkResult loader_validate_instance_extensions(struct loader_instance *inst, const
                    "greater than zero");
         return VK_ERROR_EXTENSION_NOT_PRESENT;
     }
-    if (!loader_init_layer_list(inst, &active_layers)) {
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
-    }
-    if (!loader_init_layer_list(inst, &expanded_layers)) {
-        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-        goto out;
-    }
-
-    // Parse the filter environment variables to determine if we have any special behavior
-    res = parse_generic_filter_environment_var(inst, VK_LAYERS_ENABLE_ENV_VAR, &layers_enable_filter);
-    if (VK_SUCCESS != res) {
-        goto out;
-    }
-    res = parse_layers_disable_filter_environment_var(inst, &layers_disable_filter);
-    if (VK_SUCCESS != res) {
-        goto out;
-    }
 
-    // Build the lists of active layers (including metalayers) and expanded layers (with metalayers resolved to their
-    // components)
-    loader_add_implicit_layers(inst, &layers_enable_filter, &layers_disable_filter, &active_layers, &expanded_layers,
-                               instance_layers);
-    res = loader_add_environment_layers(inst, VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER, ENABLED_LAYERS_ENV, &layers_enable_filter,
-                                        &layers_disable_filter, &active_layers, &expanded_layers, instance_layers);
-    if (res != VK_SUCCESS) {
-        goto out;
-    }
-    res = loader_add_layer_names_to_list(inst, &layers_enable_filter, &layers_disable_filter, &active_layers, &expanded_layers,
-                                         pCreateInfo->enabledLayerCount, pCreateInfo->ppEnabledLayerNames, instance_layers);
-    if (VK_SUCCESS != res) {
-        goto out;
+    // Check if a user wants to disable the instance extension filtering behavior
+    env_value = loader_getenv("VK_LOADER_DISABLE_INST_EXT_FILTER", inst);
+    if (NULL != env_value && atoi(env_value) != 0) {
+        check_if_known = false;
     }
+    loader_free_getenv(env_value, inst);
 
     for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
         VkStringErrorFlags result = vk_string_validate(MaxLoaderStringLength, pCreateInfo->ppEnabledExtensionNames[i]);
@@ -4992,25 +5650,9 @@ VkResult loader_validate_instance_extensions(struct loader_instance *inst, const
             goto out;
         }
 
-        // Check if a user wants to disable the instance extension filtering behavior
-        env_value = loader_getenv("VK_LOADER_DISABLE_INST_EXT_FILTER", inst);
-        if (NULL != env_value && atoi(env_value) != 0) {
-            check_if_known = false;
-        }
-        loader_free_getenv(env_value, inst);
-
         if (check_if_known) {
-            // See if the extension is in the list of supported extensions
-            bool found = false;
-            for (uint32_t j = 0; LOADER_INSTANCE_EXTENSIONS[j] != NULL; j++) {
-                if (strcmp(pCreateInfo->ppEnabledExtensionNames[i], LOADER_INSTANCE_EXTENSIONS[j]) == 0) {
-                    found = true;
-                    break;
-                }
-            }
-
-            // If it isn't in the list, return an error
-            if (!found) {
+            // If it isn't in the list of supported extensions, return an error
+            if (!loader_is_known_instance_extension(pCreateInfo->ppEnabledExtensionNames[i])) {
                 loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                            "loader_validate_instance_extensions: Extension %s not found in list of known instance extensions.",
                            pCreateInfo->ppEnabledExtensionNames[i]);
@@ -5028,20 +5670,9 @@ VkResult loader_validate_instance_extensions(struct loader_instance *inst, const
         extension_prop = NULL;
 
         // Not in global list, search layer extension lists
-        struct loader_layer_properties *layer_prop = NULL;
-        for (uint32_t j = 0; NULL == extension_prop && j < expanded_layers.count; ++j) {
+        for (uint32_t j = 0; NULL == extension_prop && j < expanded_layers->count; ++j) {
             extension_prop =
-                get_extension_property(pCreateInfo->ppEnabledExtensionNames[i], &expanded_layers.list[j].instance_extension_list);
-            if (extension_prop) {
-                // Found the extension in one of the layers enabled by the app.
-                break;
-            }
-
-            layer_prop = loader_find_layer_property(expanded_layers.list[j].info.layerName, instance_layers);
-            if (NULL == layer_prop) {
-                // Should NOT get here, loader_validate_layers should have already filtered this case out.
-                continue;
-            }
+                get_extension_property(pCreateInfo->ppEnabledExtensionNames[i], &expanded_layers->list[j].instance_extension_list);
         }
 
         if (!extension_prop) {
@@ -5056,8 +5687,6 @@ VkResult loader_validate_instance_extensions(struct loader_instance *inst, const
     }
 
 out:
-    loader_destroy_layer_list(inst, NULL, &active_layers);
-    loader_destroy_layer_list(inst, NULL, &expanded_layers);
     return res;
 }
 
@@ -5106,6 +5735,403 @@ VkResult loader_validate_device_extensions(struct loader_instance *this_instance
     return VK_SUCCESS;
 }
 
+// Most structures in the pNext chain of a create info are opaque to the loader and can't be copied. Copies are made with only
+// the validation structures, which hold nothing but arrays of enums, and without the loader's own layer linkage structures.
+// When allow_debug_callbacks is set debug callbacks are left out too, which then miss the messages of the driver creating its
+// instance, as a driver which is given up on may still call them after the application destroyed what they use. Returns the
+// first structure which can't be copied or left out.
+static const VkBaseInStructure *loader_find_uncopyable_create_info_struct(const VkInstanceCreateInfo *pCreateInfo,
+                                                                          bool allow_debug_callbacks) {
+    const VkBaseInStructure *next = (const VkBaseInStructure *)pCreateInfo->pNext;
+    while (NULL != next) {
+        bool copyable = VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO == next->sType ||
+                        VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT == next->sType ||
+                        VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT == next->sType ||
+                        (allow_debug_callbacks && (VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT == next->sType ||
+                                                   VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT == next->sType));
+        if (!copyable) {
+            return next;
+        }
+        next = next->pNext;
+    }
+    return NULL;
+}
+
+// Returns true if VK_LOADER_LAZY_DRIVER_INSTANCES is set and the create info can be saved for later use. Setting it to 2 makes it
+// strict, which trusts that a driver without physical devices stays without them for the lifetime of the process.
+static bool loader_should_defer_icd_instances(struct loader_instance *inst, const VkInstanceCreateInfo *pCreateInfo) {
+    bool lazy = false;
+    char *env_value = loader_getenv("VK_LOADER_LAZY_DRIVER_INSTANCES", inst);
+    if (NULL != env_value && atoi(env_value) != 0) {
+        lazy = true;
+        inst->lazy_icd_strict = atoi(env_value) == 2;
+    }
+    loader_free_getenv(env_value, inst);
+    if (!lazy) {
+        return false;
+    }
+
+    const VkBaseInStructure *uncopyable = loader_find_uncopyable_create_info_struct(pCreateInfo, false);
+    if (NULL != uncopyable) {
+        loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "VK_LOADER_LAZY_DRIVER_INSTANCES is set but VkInstanceCreateInfo::pNext contains a structure of type %d, "
+                   "driver instances are created immediately.",
+                   uncopyable->sType);
+        return false;
+    }
+    return true;
+}
+
+// Copies count elements of element_size bytes into *dst, which is left NULL if there are none
+static VkResult loader_copy_create_info_array(const struct loader_instance *inst, const void *src, uint32_t count,
+                                              size_t element_size, void **dst) {
+    *dst = NULL;
+    if (0 == count || NULL == src) {
+        return VK_SUCCESS;
+    }
+    *dst = loader_instance_heap_alloc(inst, count * element_size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == *dst) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    memcpy(*dst, src, count * element_size);
+    return VK_SUCCESS;
+}
+
+// Makes a deep copy of the create info a driver would have been given, keeping only the structures of its pNext chain
+// loader_find_uncopyable_create_info_struct says can be copied. inst may be NULL, to copy it with the system allocator.
+static VkResult loader_copy_icd_create_info(const struct loader_instance *inst, const VkInstanceCreateInfo *icd_create_info,
+                                            struct loader_deferred_icd_create_info **out_info) {
+    VkResult res = VK_SUCCESS;
+    struct loader_deferred_icd_create_info *deferred_info =
+        loader_instance_heap_calloc(inst, sizeof(struct loader_deferred_icd_create_info), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == deferred_info) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    deferred_info->create_info = *icd_create_info;
+    deferred_info->create_info.pNext = NULL;
+    deferred_info->create_info.enabledExtensionCount = 0;
+    deferred_info->create_info.ppEnabledExtensionNames = NULL;
+
+    if (NULL != icd_create_info->pApplicationInfo) {
+        deferred_info->app_info = *icd_create_info->pApplicationInfo;
+        deferred_info->app_info.pNext = NULL;
+        deferred_info->app_info.pApplicationName = NULL;
+        deferred_info->app_info.pEngineName = NULL;
+        if (NULL != icd_create_info->pApplicationInfo->pApplicationName) {
+            char *name = loader_instance_heap_alloc(inst, strlen(icd_create_info->pApplicationInfo->pApplicationName) + 1,
+                                                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL == name) {
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
+            }
+            strcpy(name, icd_create_info->pApplicationInfo->pApplicationName);
+            deferred_info->app_info.pApplicationName = name;
+        }
+        if (NULL != icd_create_info->pApplicationInfo->pEngineName) {
+            char *name = loader_instance_heap_alloc(inst, strlen(icd_create_info->pApplicationInfo->pEngineName) + 1,
+                                                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL == name) {
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
+            }
+            strcpy(name, icd_create_info->pApplicationInfo->pEngineName);
+            deferred_info->app_info.pEngineName = name;
+        }
+        deferred_info->create_info.pApplicationInfo = &deferred_info->app_info;
+    }
+
+    if (icd_create_info->enabledExtensionCount > 0) {
+        deferred_info->enabled_extension_names = loader_instance_heap_calloc(
+            inst, icd_create_info->enabledExtensionCount * sizeof(char *), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == deferred_info->enabled_extension_names) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            goto out;
+        }
+        for (uint32_t i = 0; i < icd_create_info->enabledExtensionCount; i++) {
+            char *name = loader_instance_heap_alloc(inst, strlen(icd_create_info->ppEnabledExtensionNames[i]) + 1,
+                                                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL == name) {
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
+            }
+            strcpy(name, icd_create_info->ppEnabledExtensionNames[i]);
+            deferred_info->enabled_extension_names[i] = name;
+            // Only count names which were copied so a partially filled array is freed correctly
+            deferred_info->create_info.enabledExtensionCount++;
+        }
+        deferred_info->create_info.ppEnabledExtensionNames = (const char *const *)deferred_info->enabled_extension_names;
+    }
+
+    // Only one of each structure is allowed in the chain, later ones are ignored rather than linking a copy into the chain twice
+    const void **chain_end = &deferred_info->create_info.pNext;
+    for (const VkBaseInStructure *next = (const VkBaseInStructure *)icd_create_info->pNext; NULL != next; next = next->pNext) {
+        if (VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT == next->sType &&
+            VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT != deferred_info->validation_flags.sType) {
+            const VkValidationFlagsEXT *flags = (const VkValidationFlagsEXT *)next;
+            void *checks = NULL;
+            res = loader_copy_create_info_array(inst, flags->pDisabledValidationChecks, flags->disabledValidationCheckCount,
+                                                sizeof(VkValidationCheckEXT), &checks);
+            deferred_info->validation_flags = *flags;
+            deferred_info->validation_flags.pNext = NULL;
+            deferred_info->validation_flags.pDisabledValidationChecks = checks;
+            if (VK_SUCCESS != res) {
+                goto out;
+            }
+            *chain_end = &deferred_info->validation_flags;
+            chain_end = &deferred_info->validation_flags.pNext;
+        } else if (VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT == next->sType &&
+                   VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT != deferred_info->validation_features.sType) {
+            const VkValidationFeaturesEXT *features = (const VkValidationFeaturesEXT *)next;
+            void *enabled = NULL;
+            void *disabled = NULL;
+            res = loader_copy_create_info_array(inst, features->pEnabledValidationFeatures, features->enabledValidationFeatureCount,
+                                                sizeof(VkValidationFeatureEnableEXT), &enabled);
+            if (VK_SUCCESS == res) {
+                res = loader_copy_create_info_array(inst, features->pDisabledValidationFeatures,
+                                                    features->disabledValidationFeatureCount, sizeof(VkValidationFeatureDisableEXT),
+                                                    &disabled);
+            }
+            deferred_info->validation_features = *features;
+            deferred_info->validation_features.pNext = NULL;
+            deferred_info->validation_features.pEnabledValidationFeatures = enabled;
+            deferred_info->validation_features.pDisabledValidationFeatures = disabled;
+            if (VK_SUCCESS != res) {
+                goto out;
+            }
+            *chain_end = &deferred_info->validation_features;
+            chain_end = &deferred_info->validation_features.pNext;
+        }
+    }
+
+out:
+    if (VK_SUCCESS != res) {
+        loader_free_deferred_icd_create_info(inst, deferred_info);
+    } else {
+        *out_info = deferred_info;
+    }
+    return res;
+}
+
+// Saves a deep copy of the create info a driver would have been given, so its instance can be created later.
+static VkResult loader_defer_icd_instance(struct loader_instance *inst, struct loader_icd_term *icd_term,
+                                          const VkInstanceCreateInfo *icd_create_info) {
+    return loader_copy_icd_create_info(inst, icd_create_info, &icd_term->deferred_create_info);
+}
+
+// A driver's vkCreateInstance, run with loader_call_driver_with_budget. An abandoned call can still be running after the
+// application freed what it passed in, so it is given copies allocated from the system.
+struct loader_icd_create_instance_call {
+    PFN_vkCreateInstance create_instance;
+    struct loader_deferred_icd_create_info *create_info;
+    bool has_allocator;
+    VkAllocationCallbacks allocator;
+    VkResult result;
+    VkInstance instance;
+};
+
+static void loader_icd_create_instance_call_run(void *data) {
+    struct loader_icd_create_instance_call *call = (struct loader_icd_create_instance_call *)data;
+    call->result =
+        call->create_instance(&call->create_info->create_info, call->has_allocator ? &call->allocator : NULL, &call->instance);
+}
+
+// An instance which is created after its call was abandoned is leaked, rather than calling into the driver again
+static void loader_icd_create_instance_call_free(void *data) {
+    struct loader_icd_create_instance_call *call = (struct loader_icd_create_instance_call *)data;
+    loader_free_deferred_icd_create_info(NULL, call->create_info);
+    loader_free(NULL, call);
+}
+
+// Calls the vkCreateInstance of a driver, giving up on it if it takes longer than VK_LOADER_DRIVER_TIMEOUT_MS allows, in which
+// case VK_ERROR_INITIALIZATION_FAILED is returned.
+static VkResult loader_icd_create_instance(struct loader_instance *inst, const struct loader_driver_budget *budget,
+                                           const struct loader_scanned_icd *scanned_icd,
+                                           const VkInstanceCreateInfo *icd_create_info, const VkAllocationCallbacks *pAllocator,
+                                           VkInstance *pInstance) {
+    VkResult res = VK_SUCCESS;
+    uint64_t start_time = loader_platform_get_time_us();
+    const VkBaseInStructure *uncopyable = NULL;
+    if (0 != budget->timeout_us) {
+        uncopyable = loader_find_uncopyable_create_info_struct(icd_create_info, true);
+        if (NULL != uncopyable) {
+            loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                       "VK_LOADER_DRIVER_TIMEOUT_MS is set but VkInstanceCreateInfo::pNext contains a structure of type %d, "
+                       "vkCreateInstance in driver \"%s\" is called without a time limit.",
+                       uncopyable->sType, scanned_icd->lib_name);
+        }
+    }
+
+    if (0 == budget->timeout_us || NULL != uncopyable) {
+        res = scanned_icd->CreateInstance(icd_create_info, pAllocator, pInstance);
+    } else {
+        struct loader_icd_create_instance_call *call =
+            loader_calloc(NULL, sizeof(struct loader_icd_create_instance_call), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == call) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        res = loader_copy_icd_create_info(NULL, icd_create_info, &call->create_info);
+        if (VK_SUCCESS != res) {
+            loader_free(NULL, call);
+            return res;
+        }
+        call->create_instance = scanned_icd->CreateInstance;
+        if (NULL != pAllocator) {
+            call->has_allocator = true;
+            call->allocator = *pAllocator;
+        }
+
+        if (!loader_call_driver_with_budget(inst, budget, loader_icd_create_instance_call_run,
+                                            loader_icd_create_instance_call_free, call)) {
+            loader_log(inst, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                       "loader_icd_create_instance: vkCreateInstance in driver \"%s\" took longer than the %" PRIu64
+                       " ms allowed by VK_LOADER_DRIVER_TIMEOUT_MS.  Skipping driver.",
+                       scanned_icd->lib_name, budget->timeout_us / 1000);
+            // Closing the library while the driver is still running in it would crash, so it is kept open for good
+            (void)loader_platform_open_library(scanned_icd->lib_name);
+            loader_quarantine_driver(inst, budget, scanned_icd->lib_name);
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+        res = call->result;
+        *pInstance = call->instance;
+        loader_icd_create_instance_call_free(call);
+    }
+
+    loader_log(inst, VULKAN_LOADER_PERF_BIT, 0, LOADER_PERF_MESSAGE_PREFIX "driver_create_instance us=%" PRIu64 " path=%s",
+               loader_platform_get_time_us() - start_time, scanned_icd->lib_name);
+    return res;
+}
+
+// Below interface version 3 the loader creates surfaces itself, so drivers mustn't expose their own surface functions
+static void loader_check_icd_surface_entrypoints(const struct loader_instance *inst, const struct loader_icd_term *icd_term) {
+    if (icd_term->scanned_icd->interface_version < 3 &&
+        (
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+            NULL != icd_term->dispatch.CreateXlibSurfaceKHR ||
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+#ifdef VK_USE_PLATFORM_XCB_KHR
+            NULL != icd_term->dispatch.CreateXcbSurfaceKHR ||
+#endif  // VK_USE_PLATFORM_XCB_KHR
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+            NULL != icd_term->dispatch.CreateWaylandSurfaceKHR ||
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+            NULL != icd_term->dispatch.CreateAndroidSurfaceKHR ||
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+            NULL != icd_term->dispatch.CreateWin32SurfaceKHR ||
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+            NULL != icd_term->dispatch.DestroySurfaceKHR)) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
+                   "terminator_CreateInstance: Driver %s supports interface version %u but still exposes VkSurfaceKHR"
+                   " create/destroy entrypoints (Policy #LDP_DRIVER_8)",
+                   icd_term->scanned_icd->lib_name, icd_term->scanned_icd->interface_version);
+    }
+}
+
+// Whether lib_name is known to expose no physical devices. Outside of strict mode that is only trusted while the driver library
+// and the environment are the same as when it was last enumerated.
+static bool loader_icd_known_without_physical_devices(const struct loader_instance *inst, const char *lib_name) {
+    uint64_t environment_hash = 0;
+    uint64_t library_size = 0;
+    int64_t library_modification_time = 0;
+    if (!inst->lazy_icd_strict) {
+        environment_hash = loader_get_environment_hash();
+        loader_get_library_identity(lib_name, &library_size, &library_modification_time);
+    }
+
+    loader_platform_thread_lock_mutex(&loader_lazy_icd_lock);
+    struct loader_icd_identity *identity = loader_find_icd_identity(lib_name);
+    bool no_physical_devices =
+        NULL != identity && 0 == identity->physical_device_count &&
+        (inst->lazy_icd_strict ||
+         (identity->environment_hash == environment_hash && identity->library_size == library_size &&
+          identity->library_modification_time == library_modification_time));
+    loader_platform_thread_unlock_mutex(&loader_lazy_icd_lock);
+    return no_physical_devices;
+}
+
+// Creates the instance of a driver whose creation was deferred by VK_LOADER_LAZY_DRIVER_INSTANCES, if it hasn't been yet. Must
+// be called before anything queries physical devices from, or creates per driver objects in, icd_term. A driver which is known
+// to expose no physical devices isn't created, and stays without an instance for the lifetime of inst. Only fails when out of
+// memory.
+VkResult loader_create_deferred_icd_instance(struct loader_instance *inst, struct loader_icd_term *icd_term) {
+    if (!inst->lazy_icd_creation) {
+        return VK_SUCCESS;
+    }
+
+    loader_platform_thread_lock_mutex(&loader_deferred_icd_lock);
+    struct loader_deferred_icd_create_info *deferred_info = icd_term->deferred_create_info;
+    if (NULL == deferred_info) {
+        loader_platform_thread_unlock_mutex(&loader_deferred_icd_lock);
+        return VK_SUCCESS;
+    }
+    icd_term->deferred_create_info = NULL;
+
+    VkResult res = VK_SUCCESS;
+    const VkAllocationCallbacks *pAllocator = NULL != inst->alloc_callbacks.pfnAllocation ? &inst->alloc_callbacks : NULL;
+    struct loader_driver_budget budget;
+    loader_get_driver_budget(inst, &budget);
+
+    if (loader_icd_known_without_physical_devices(inst, icd_term->scanned_icd->lib_name)) {
+        loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "loader_create_deferred_icd_instance: Not creating an instance in driver \"%s\" as it previously reported no "
+                   "physical devices",
+                   icd_term->scanned_icd->lib_name);
+        goto out;
+    }
+
+    VkResult icd_result = loader_icd_create_instance(inst, &budget, icd_term->scanned_icd, &deferred_info->create_info,
+                                                     pAllocator, &icd_term->instance);
+    if (VK_ERROR_OUT_OF_HOST_MEMORY == icd_result) {
+        icd_term->instance = VK_NULL_HANDLE;
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    } else if (VK_SUCCESS != icd_result) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
+                   "loader_create_deferred_icd_instance: Failed to CreateInstance in driver \"%s\".  Skipping driver.",
+                   icd_term->scanned_icd->lib_name);
+        icd_term->instance = VK_NULL_HANDLE;
+        goto out;
+    }
+
+    if (!loader_icd_init_entries(icd_term, icd_term->instance, icd_term->scanned_icd->GetInstanceProcAddr)) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT, 0,
+                   "loader_create_deferred_icd_instance: Failed to find entrypoints with driver \"%s\".  Skipping driver.",
+                   icd_term->scanned_icd->lib_name);
+        if (NULL != icd_term->dispatch.DestroyInstance) {
+            icd_term->dispatch.DestroyInstance(icd_term->instance, pAllocator);
+        }
+        memset(&icd_term->dispatch, 0, sizeof(icd_term->dispatch));
+        icd_term->instance = VK_NULL_HANDLE;
+        goto out;
+    }
+
+    // Checked when the instance is created, as the dispatch table is only filled in then
+    loader_check_icd_surface_entrypoints(inst, icd_term);
+
+out:
+    loader_free_deferred_icd_create_info(inst, deferred_info);
+    loader_platform_thread_unlock_mutex(&loader_deferred_icd_lock);
+    loader_free_driver_budget(inst, &budget);
+    return res;
+}
+
+// Creates the deferred instances of every driver of inst, for objects such as surfaces and debug messengers which are created
+// in every driver at once
+VkResult loader_create_deferred_icd_instances(struct loader_instance *inst) {
+    VkResult res = VK_SUCCESS;
+    if (!inst->lazy_icd_creation) {
+        return VK_SUCCESS;
+    }
+    for (struct loader_icd_term *icd_term = inst->icd_terms; NULL != icd_term; icd_term = icd_term->next) {
+        if (VK_SUCCESS != loader_create_deferred_icd_instance(inst, icd_term)) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+    }
+    return res;
+}
+
 // Terminator functions for the Instance chain
 // All named terminator_<Vulkan API name>
 VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateInfo *pCreateInfo,
@@ -5116,6 +6142,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
     VkInstanceCreateInfo icd_create_info;
     VkResult res = VK_SUCCESS;
     bool one_icd_successful = false;
+    struct loader_driver_budget budget;
 
     struct loader_instance *ptr_instance = (struct loader_instance *)*pInstance;
     if (NULL == ptr_instance) {
@@ -5139,6 +6166,9 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
         }
     }
 
+    ptr_instance->lazy_icd_creation = loader_should_defer_icd_instances(ptr_instance, pCreateInfo);
+    loader_get_driver_budget(ptr_instance, &budget);
+
     memcpy(&icd_create_info, pCreateInfo, sizeof(icd_create_info));
 
     icd_create_info.enabledLayerCount = 0;
@@ -5309,8 +6339,19 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
             icd_app_info.apiVersion = icd_version;
             icd_create_info.pApplicationInfo = &icd_app_info;
         }
-        icd_result =
-            ptr_instance->icd_tramp_list.scanned_list[i].CreateInstance(&icd_create_info, pAllocator, &(icd_term->instance));
+
+        // The instance is created by loader_create_deferred_icd_instances once it is needed
+        if (ptr_instance->lazy_icd_creation) {
+            res = loader_defer_icd_instance(ptr_instance, icd_term, &icd_create_info);
+            if (VK_SUCCESS != res) {
+                goto out;
+            }
+            one_icd_successful = true;
+            continue;
+        }
+
+        icd_result = loader_icd_create_instance(ptr_instance, &budget, &ptr_instance->icd_tramp_list.scanned_list[i],
+                                                &icd_create_info, pAllocator, &(icd_term->instance));
         if (VK_ERROR_OUT_OF_HOST_MEMORY == icd_result) {
             // If out of memory, bail immediately.
             res = VK_ERROR_OUT_OF_HOST_MEMORY;
@@ -5334,30 +6375,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
             continue;
         }
 
-        if (ptr_instance->icd_tramp_list.scanned_list[i].interface_version < 3 &&
-            (
-#ifdef VK_USE_PLATFORM_XLIB_KHR
-                NULL != icd_term->dispatch.CreateXlibSurfaceKHR ||
-#endif  // VK_USE_PLATFORM_XLIB_KHR
-#ifdef VK_USE_PLATFORM_XCB_KHR
-                NULL != icd_term->dispatch.CreateXcbSurfaceKHR ||
-#endif  // VK_USE_PLATFORM_XCB_KHR
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-                NULL != icd_term->dispatch.CreateWaylandSurfaceKHR ||
-#endif  // VK_USE_PLATFORM_WAYLAND_KHR
-#ifdef VK_USE_PLATFORM_ANDROID_KHR
-                NULL != icd_term->dispatch.CreateAndroidSurfaceKHR ||
-#endif  // VK_USE_PLATFORM_ANDROID_KHR
-#ifdef VK_USE_PLATFORM_WIN32_KHR
-                NULL != icd_term->dispatch.CreateWin32SurfaceKHR ||
-#endif  // VK_USE_PLATFORM_WIN32_KHR
-                NULL != icd_term->dispatch.DestroySurfaceKHR)) {
-            loader_log(ptr_instance, VULKAN_LOADER_WARN_BIT, 0,
-                       "terminator_CreateInstance: Driver %s supports interface version %u but still exposes VkSurfaceKHR"
-                       " create/destroy entrypoints (Policy #LDP_DRIVER_8)",
-                       ptr_instance->icd_tramp_list.scanned_list[i].lib_name,
-                       ptr_instance->icd_tramp_list.scanned_list[i].interface_version);
-        }
+        loader_check_icd_surface_entrypoints(ptr_instance, icd_term);
 
         // If we made it this far, at least one ICD was successful
         one_icd_successful = true;
@@ -5390,6 +6408,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
 
 out:
 
+    loader_free_driver_budget(ptr_instance, &budget);
     ptr_instance->create_terminator_invalid_extension = false;
 
     if (VK_SUCCESS != res) {
@@ -5470,6 +6489,10 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyInstance(VkInstance instance, const
             }
         }
         for (uint32_t i = 0; i < ptr_instance->phys_dev_count_term; i++) {
+            if (NULL != ptr_instance->phys_devs_term[i]) {
+                loader_destroy_generic_list(ptr_instance,
+                                            (struct loader_generic_list *)&ptr_instance->phys_devs_term[i]->device_extension_cache);
+            }
             loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_term[i]);
         }
         loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_term);
@@ -5960,7 +6983,7 @@ VkResult check_and_add_to_new_phys_devs(struct loader_instance *inst, VkPhysical
     }
     // If this physical device is new, we need to allocate space for it.
     new_phys_devs[idx] =
-        loader_instance_heap_alloc(inst, sizeof(struct loader_physical_device_term), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        loader_instance_heap_calloc(inst, sizeof(struct loader_physical_device_term), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
     if (NULL == new_phys_devs[idx]) {
         loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "check_and_add_to_new_phys_devs:  Failed to allocate physical device terminator object %d", idx);
@@ -5977,6 +7000,29 @@ VkResult check_and_add_to_new_phys_devs(struct loader_instance *inst, VkPhysical
     return VK_SUCCESS;
 }
 
+// Returns true if the drivers reported exactly the physical devices which are already in inst->phys_devs_term, in which case the
+// existing list (and its order) can be kept as is
+static bool loader_term_phys_devs_unchanged(struct loader_instance *inst, uint32_t icd_count,
+                                            struct loader_phys_dev_per_icd *icd_phys_dev_array) {
+    uint32_t total_count = 0;
+    for (uint32_t i = 0; i < icd_count; ++i) {
+        total_count += icd_phys_dev_array[i].device_count;
+    }
+    if (0 == total_count || total_count != inst->phys_dev_count_term) {
+        return false;
+    }
+    for (uint32_t i = 0; i < icd_count; ++i) {
+        for (uint32_t j = 0; j < icd_phys_dev_array[i].device_count; ++j) {
+            uint32_t idx = 0;
+            if (!find_phys_dev(icd_phys_dev_array[i].physical_devices[j], inst->phys_dev_count_term, inst->phys_devs_term, &idx) ||
+                inst->phys_devs_term[idx]->this_icd_term != icd_phys_dev_array[i].icd_term) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 /* Enumerate all physical devices from ICDs and add them to inst->phys_devs_term
  *
  * There are two methods to find VkPhysicalDevices - vkEnumeratePhysicalDevices and vkEnumerateAdapterPhysicalDevices
@@ -5999,8 +7045,24 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
     uint32_t new_phys_devs_capacity = 0;
     uint32_t new_phys_devs_count = 0;
     struct loader_physical_device_term **new_phys_devs = NULL;
+    bool record_device_ids = false;
+    VkPhysicalDeviceProperties *device_properties = NULL;
+    bool devices_unchanged = false;
+
+#ifdef LOADER_ENABLE_LINUX_SORT
+    // Remember which devices each driver exposes so later instances can skip loading the drivers which don't expose the
+    // selected device
+    struct loader_device_id selected_device;
+    record_device_ids = loader_get_device_select_prune(inst, &selected_device);
+#endif
 
 #if defined(_WIN32)
+    // Sorting asks every driver for the physical devices on each adapter
+    res = loader_create_deferred_icd_instances(inst);
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
+
     // Get the physical devices supported by platform sorting mechanism into a separate list
     res = windows_read_sorted_physical_devices(inst, &windows_sorted_devices_count, &windows_sorted_devices_array);
     if (VK_SUCCESS != res) {
@@ -6025,6 +7087,19 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
     // internal value for those physical devices.
     icd_term = inst->icd_terms;
     while (NULL != icd_term) {
+        res = loader_create_deferred_icd_instance(inst, icd_term);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        // Drivers left without an instance by VK_LOADER_LAZY_DRIVER_INSTANCES don't expose any physical devices
+        if (VK_NULL_HANDLE == icd_term->instance) {
+            icd_phys_dev_array[icd_idx].icd_term = icd_term;
+            icd_phys_dev_array[icd_idx].icd_index = icd_idx;
+            icd_term = icd_term->next;
+            ++icd_idx;
+            continue;
+        }
+
         res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &icd_phys_dev_array[icd_idx].device_count, NULL);
         if (VK_SUCCESS != res) {
             loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
@@ -6050,10 +7125,56 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
         }
         icd_phys_dev_array[icd_idx].icd_term = icd_term;
         icd_phys_dev_array[icd_idx].icd_index = icd_idx;
+        if (!record_device_ids && inst->lazy_icd_creation) {
+            loader_update_icd_identity(icd_term->scanned_icd->lib_name, icd_phys_dev_array[icd_idx].device_count, false, NULL);
+        }
         icd_term = icd_term->next;
         ++icd_idx;
     }
 
+    if (record_device_ids) {
+        // Query the properties of every physical device once, linux_read_sorted_physical_devices reuses them
+        uint32_t total_device_count = 0;
+        for (uint32_t i = 0; i < icd_count; ++i) {
+            total_device_count += icd_phys_dev_array[i].device_count;
+        }
+        if (total_device_count > 0) {
+            device_properties = loader_instance_heap_alloc(inst, total_device_count * sizeof(VkPhysicalDeviceProperties),
+                                                           VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+            if (NULL == device_properties) {
+                loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
+                           "setup_loader_term_phys_devs:  Failed to allocate physical device properties array of size %d",
+                           total_device_count);
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
+            }
+        }
+        uint32_t properties_idx = 0;
+        for (uint32_t i = 0; i < icd_count; ++i) {
+            icd_term = icd_phys_dev_array[i].icd_term;
+            if (VK_NULL_HANDLE == icd_term->instance) {
+                continue;
+            }
+            uint32_t device_count = icd_phys_dev_array[i].device_count;
+            if (device_count > 0) {
+                icd_phys_dev_array[i].properties = &device_properties[properties_idx];
+                for (uint32_t j = 0; j < device_count; ++j) {
+                    icd_term->dispatch.GetPhysicalDeviceProperties(icd_phys_dev_array[i].physical_devices[j],
+                                                                   &icd_phys_dev_array[i].properties[j]);
+                }
+                properties_idx += device_count;
+            }
+            loader_update_icd_identity(icd_term->scanned_icd->lib_name, device_count, true, icd_phys_dev_array[i].properties);
+        }
+    }
+
+    // Repeated enumerations usually find the same devices, keep the current list instead of rebuilding it
+    if (0 == windows_sorted_devices_count && loader_term_phys_devs_unchanged(inst, icd_count, icd_phys_dev_array)) {
+        devices_unchanged = true;
+        inst->total_gpu_count = inst->phys_dev_count_term;
+        goto out;
+    }
+
     // Add up both the windows sorted and non windows found physical device counts
     for (uint32_t i = 0; i < windows_sorted_devices_count; ++i) {
         new_phys_devs_capacity += windows_sorted_devices_array[i].device_count;
@@ -6098,7 +7219,7 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
     if (is_linux_sort_enabled(inst)) {
         for (uint32_t dev = new_phys_devs_count; dev < new_phys_devs_capacity; ++dev) {
             new_phys_devs[dev] =
-                loader_instance_heap_alloc(inst, sizeof(struct loader_physical_device_term), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+                loader_instance_heap_calloc(inst, sizeof(struct loader_physical_device_term), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
             if (NULL == new_phys_devs[dev]) {
                 loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                            "setup_loader_term_phys_devs:  Failed to allocate physical device terminator object %d", dev);
@@ -6173,7 +7294,7 @@ out:
             loader_instance_heap_free(inst, new_phys_devs);
         }
         inst->total_gpu_count = 0;
-    } else {
+    } else if (!devices_unchanged) {
         if (NULL != inst->phys_devs_term) {
             // Free everything in the old array that was not copied into the new array
             // here.  We can't attempt to do that before here since the previous loop
@@ -6188,6 +7309,8 @@ out:
                     }
                 }
                 if (!found) {
+                    loader_destroy_generic_list(inst,
+                                                (struct loader_generic_list *)&inst->phys_devs_term[i]->device_extension_cache);
                     loader_instance_heap_free(inst, inst->phys_devs_term[i]);
                 }
             }
@@ -6208,6 +7331,7 @@ out:
         }
         loader_instance_heap_free(inst, windows_sorted_devices_array);
     }
+    loader_instance_heap_free(inst, device_properties);
 
     return res;
 }
@@ -6290,6 +7414,69 @@ out:
     return res;
 }
 
+// Queries the driver's device extensions and adds the device extensions of the active implicit layers, without duplicates.
+// Called with loader_lock held, the list is kept until the physical device is freed.
+static VkResult loader_fill_device_extension_cache(struct loader_physical_device_term *phys_dev_term) {
+    struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
+    const struct loader_instance *inst = icd_term->this_instance;
+    uint32_t icd_ext_count = 0;
+    VkExtensionProperties *icd_props_list = NULL;
+    struct loader_extension_list all_exts = {0};
+    VkResult res;
+
+    res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &icd_ext_count, NULL);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+    if (icd_ext_count > 0) {
+        icd_props_list =
+            loader_instance_heap_alloc(inst, sizeof(VkExtensionProperties) * icd_ext_count, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == icd_props_list) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            goto out;
+        }
+    }
+    res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &icd_ext_count, icd_props_list);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+
+    // Init a list with enough capacity for the device extensions and the implicit layer device extensions
+    res = loader_init_generic_list(inst, (struct loader_generic_list *)&all_exts,
+                                   sizeof(VkExtensionProperties) * (icd_ext_count + 20));
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
+
+    // Copy over the device extensions into all_exts & deduplicate
+    res = loader_add_to_ext_list(inst, &all_exts, icd_ext_count, icd_props_list);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+
+    // Iterate over active layers, if they are an implicit layer, add their device extensions
+    for (uint32_t i = 0; i < inst->expanded_activated_layer_list.count; i++) {
+        struct loader_layer_properties *layer_props = &inst->expanded_activated_layer_list.list[i];
+        if (0 == (layer_props->type_flags & VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER)) {
+            for (uint32_t j = 0; j < layer_props->device_extension_list.count; j++) {
+                res = loader_add_to_ext_list(inst, &all_exts, 1, &layer_props->device_extension_list.list[j].props);
+                if (res != VK_SUCCESS) {
+                    goto out;
+                }
+            }
+        }
+    }
+
+out:
+    if (VK_SUCCESS == res) {
+        phys_dev_term->device_extension_cache = all_exts;
+    } else {
+        loader_destroy_generic_list(inst, (struct loader_generic_list *)&all_exts);
+    }
+    loader_instance_heap_free(inst, icd_props_list);
+    return res;
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice,
                                                                              const char *pLayerName, uint32_t *pPropertyCount,
                                                                              VkExtensionProperties *pProperties) {
@@ -6343,88 +7530,31 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumerateDeviceExtensionProperties(VkP
     }
 
     // This case is during the call down the instance chain with pLayerName == NULL
-    struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    uint32_t icd_ext_count = *pPropertyCount;
-    VkExtensionProperties *icd_props_list = pProperties;
-    const struct loader_instance *inst = icd_term->this_instance;
-    struct loader_extension_list all_exts = {0};
-    VkResult res;
-
-    if (NULL == icd_props_list) {
-        // We need to find the count without duplicates. This requires querying the driver for the names of the extensions.
-        // A small amount of storage is then needed to facilitate the de-duplication.
-        res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &icd_ext_count, NULL);
-        if (res != VK_SUCCESS) {
-            goto out;
-        }
-        if (icd_ext_count > 0) {
-            icd_props_list = loader_instance_heap_alloc(icd_term->this_instance, sizeof(VkExtensionProperties) * icd_ext_count,
-                                                        VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-            if (NULL == icd_props_list) {
-                res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                goto out;
-            }
+    // The driver and implicit layer extensions don't change, so they are only gathered once per physical device
+    if (NULL == phys_dev_term->device_extension_cache.list) {
+        VkResult res = loader_fill_device_extension_cache(phys_dev_term);
+        if (VK_SUCCESS != res) {
+            return res;
         }
     }
 
-    // Get the available device extension count, and if pProperties is not NULL, the extensions as well
-    res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &icd_ext_count, icd_props_list);
-    if (res != VK_SUCCESS) {
-        goto out;
-    }
-
-    // Init a list with enough capacity for the device extensions and the implicit layer device extensions
-    res = loader_init_generic_list(inst, (struct loader_generic_list *)&all_exts,
-                                   sizeof(VkExtensionProperties) * (icd_ext_count + 20));
-    if (VK_SUCCESS != res) {
-        goto out;
-    }
-
-    // Copy over the device extensions into all_exts & deduplicate
-    res = loader_add_to_ext_list(inst, &all_exts, icd_ext_count, icd_props_list);
-    if (res != VK_SUCCESS) {
-        goto out;
+    const struct loader_extension_list *all_exts = &phys_dev_term->device_extension_cache;
+    if (NULL == pProperties) {
+        *pPropertyCount = all_exts->count;
+        return VK_SUCCESS;
     }
 
-    // Iterate over active layers, if they are an implicit layer, add their device extensions
-    for (uint32_t i = 0; i < icd_term->this_instance->expanded_activated_layer_list.count; i++) {
-        struct loader_layer_properties *layer_props = &icd_term->this_instance->expanded_activated_layer_list.list[i];
-        if (0 == (layer_props->type_flags & VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER)) {
-            for (uint32_t j = 0; j < layer_props->device_extension_list.count; j++) {
-                res = loader_add_to_ext_list(icd_term->this_instance, &all_exts, 1,
-                                             &layer_props->device_extension_list.list[j].props);
-                if (res != VK_SUCCESS) {
-                    goto out;
-                }
-            }
-        }
-    }
     uint32_t capacity = *pPropertyCount;
-    VkExtensionProperties *props = pProperties;
-
-    res = VK_SUCCESS;
-    if (NULL != pProperties) {
-        for (uint32_t i = 0; i < all_exts.count && i < capacity; i++) {
-            props[i] = all_exts.list[i];
-        }
-
-        // Wasn't enough space for the extensions, we did partial copy now return VK_INCOMPLETE
-        if (capacity < all_exts.count) {
-            res = VK_INCOMPLETE;
-        } else {
-            *pPropertyCount = all_exts.count;
-        }
-    } else {
-        *pPropertyCount = all_exts.count;
+    for (uint32_t i = 0; i < all_exts->count && i < capacity; i++) {
+        pProperties[i] = all_exts->list[i];
     }
 
-out:
-
-    loader_destroy_generic_list(icd_term->this_instance, (struct loader_generic_list *)&all_exts);
-    if (NULL == pProperties && NULL != icd_props_list) {
-        loader_instance_heap_free(icd_term->this_instance, icd_props_list);
+    // Wasn't enough space for the extensions, we did partial copy now return VK_INCOMPLETE
+    if (capacity < all_exts->count) {
+        return VK_INCOMPLETE;
     }
-    return res;
+    *pPropertyCount = all_exts->count;
+    return VK_SUCCESS;
 }
 
 VkStringErrorFlags vk_string_validate(const int max_length, const char *utf8) {
@@ -6627,6 +7757,13 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDeviceGroups(
     // internal value for those physical devices.
     icd_term = inst->icd_terms;
     for (uint32_t icd_idx = 0; NULL != icd_term; icd_term = icd_term->next, icd_idx++) {
+        res = loader_create_deferred_icd_instance(inst, icd_term);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        if (VK_NULL_HANDLE == icd_term->instance) {
+            continue;
+        }
         // Get the function pointer to use to call into the ICD. This could be the core or KHR version
         if (inst->enabled_known_extensions.khr_device_group_creation) {
             fpEnumeratePhysicalDeviceGroups = icd_term->dispatch.EnumeratePhysicalDeviceGroupsKHR;
@@ -6697,6 +7834,9 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDeviceGroups(
         cur_icd_group_count = 0;
         icd_term = inst->icd_terms;
         for (uint8_t icd_idx = 0; NULL != icd_term; icd_term = icd_term->next, icd_idx++) {
+            if (VK_NULL_HANDLE == icd_term->instance) {
+                continue;
+            }
             uint32_t count_this_time = total_count - cur_icd_group_count;
 
             // Get the function pointer to use to call into the ICD. This could be the core or KHR version
@@ -83,14 +83,20 @@ extern loader_platform_thread_mutex loader_lock;
 extern loader_platform_thread_mutex loader_json_lock;
 extern loader_platform_thread_mutex loader_preload_icd_lock;
 extern loader_platform_thread_mutex loader_global_instance_list_lock;
+extern loader_platform_thread_mutex loader_surface_query_cache_lock;
+extern loader_platform_thread_mutex loader_unknown_function_lock;
+extern loader_platform_thread_mutex loader_debug_callback_lock;
+extern loader_platform_thread_mutex loader_timed_out_driver_lock;
 
 bool compare_vk_extension_properties(const VkExtensionProperties *op1, const VkExtensionProperties *op2);
 
 VkResult loader_validate_layers(const struct loader_instance *inst, const uint32_t layer_count,
                                 const char *const *ppEnabledLayerNames, const struct loader_layer_list *list);
 
+// expanded_layers is the set of layers (with meta-layers resolved to their components) produced by
+// loader_enable_instance_layers, which must be called first.
 VkResult loader_validate_instance_extensions(struct loader_instance *inst, const struct loader_extension_list *icd_exts,
-                                             const struct loader_layer_list *instance_layer,
+                                             const struct loader_layer_list *expanded_layers,
                                              const VkInstanceCreateInfo *pCreateInfo);
 
 void loader_initialize(void);
@@ -126,6 +132,8 @@ VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_t
                          bool *skipped_portability_drivers);
 void loader_icd_destroy(struct loader_instance *ptr_inst, struct loader_icd_term *icd_term,
                         const VkAllocationCallbacks *pAllocator);
+VkResult loader_create_deferred_icd_instance(struct loader_instance *inst, struct loader_icd_term *icd_term);
+VkResult loader_create_deferred_icd_instances(struct loader_instance *inst);
 VkResult loader_scan_for_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers);
 VkResult loader_scan_for_implicit_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers,
                                          loader_platform_dl_handle **libs);
@@ -163,6 +171,11 @@ VkResult loader_create_device_chain(const VkPhysicalDevice pd, const VkDeviceCre
                                     const VkAllocationCallbacks *pAllocator, const struct loader_instance *inst,
                                     struct loader_device *dev, PFN_vkGetInstanceProcAddr callingLayer,
                                     PFN_vkGetDeviceProcAddr *layerNextGDPA);
+#if defined(LOADER_ENABLE_TEST_HOOKS)
+// Makes devices created without layers fill their dispatch table through loader_gpa_device_terminator, as they did before the
+// table was filled straight from the driver, so the benchmarks can compare both.
+LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL loader_test_set_device_dispatch_through_terminator(VkBool32 enable);
+#endif
 
 VkResult loader_validate_device_extensions(struct loader_instance *this_instance,
                                            const struct loader_layer_list *activated_device_layers,
@@ -198,6 +198,17 @@ struct loader_device {
 // Per ICD information
 
 // Per ICD structure
+// Copy of the create info a driver's VkInstance is created with, kept until the instance is created when
+// VK_LOADER_LAZY_DRIVER_INSTANCES defers creation of the driver instance.
+struct loader_deferred_icd_create_info {
+    VkInstanceCreateInfo create_info;
+    VkApplicationInfo app_info;
+    char **enabled_extension_names;
+    // Copies of the structures from the pNext chain the loader knows how to copy, linked into create_info.pNext when present
+    VkValidationFlagsEXT validation_flags;
+    VkValidationFeaturesEXT validation_features;
+};
+
 struct loader_icd_term {
     // pointers to find other structs
     const struct loader_scanned_icd *scanned_icd;
@@ -206,6 +217,9 @@ struct loader_icd_term {
     VkInstance instance;  // instance object from the icd
     struct loader_icd_term_dispatch dispatch;
 
+    // Non-NULL while creation of the driver instance is deferred
+    struct loader_deferred_icd_create_info *deferred_create_info;
+
     struct loader_icd_term *next;
 
     PFN_PhysDevExt phys_dev_ext[MAX_NUM_UNKNOWN_EXTS];
@@ -257,6 +271,10 @@ struct loader_instance {
     uint32_t total_icd_count;
     struct loader_icd_term *icd_terms;
     struct loader_icd_tramp_list icd_tramp_list;
+    // Set when VK_LOADER_LAZY_DRIVER_INSTANCES deferred creation of the driver instances, never changes afterwards
+    bool lazy_icd_creation;
+    // Set when VK_LOADER_LAZY_DRIVER_INSTANCES is strict, so drivers which ever reported no physical devices are never created
+    bool lazy_icd_strict;
 
     uint32_t dev_ext_disp_function_count;
     char *dev_ext_disp_functions[MAX_NUM_UNKNOWN_EXTS];
@@ -282,12 +300,19 @@ struct loader_instance {
     struct loader_instance_extension_enables enabled_known_extensions;
 
     // Stores debug callbacks - used in the log
-    VkLayerDbgFunctionNode *DbgFunctionHead;
+    // It is read without a lock, so it must only be accessed through the functions in debug_utils.c
+    struct loader_debug_callbacks *debug_callbacks;
+    // The snapshots which debug_callbacks no longer points to, each of which is freed once no thread is walking it
+    struct loader_debug_callbacks *retired_debug_callbacks;
+    // How many threads are loading debug_callbacks but haven't yet counted themselves in its readers, split by the parity of
+    // debug_callback_epoch so that a writer only waits for the threads which started before it swapped a snapshot out
+    uint32_t debug_callback_epoch;
+    uint32_t debug_callback_acquiring[2];
 
     // Stores the debug callbacks set during instance creation
     // These are kept separate because they aren't to be used outside of instance creation and destruction
     // So they are swapped out at the end of instance creation and swapped in at instance destruction
-    VkLayerDbgFunctionNode *InstanceCreationDeletionDebugFunctionHead;
+    struct loader_debug_callbacks *instance_creation_debug_callbacks;
 
     VkAllocationCallbacks alloc_callbacks;
 
@@ -336,6 +361,8 @@ struct loader_instance {
 #endif
     bool wsi_display_enabled;
     bool wsi_display_props2_enabled;
+    // Set by VK_LOADER_CACHE_SURFACE_QUERIES, never changes afterwards
+    bool wsi_surface_query_cache_enabled;
     bool create_terminator_invalid_extension;
     bool supports_get_dev_prop_2;
 };
@@ -370,6 +397,8 @@ struct loader_physical_device_term {
     struct loader_icd_term *this_icd_term;
     uint8_t icd_index;
     VkPhysicalDevice phys_dev;  // object from ICD
+    // Driver and implicit layer device extensions, filled in by the first vkEnumerateDeviceExtensionProperties call
+    struct loader_extension_list device_extension_cache;
 };
 
 #ifdef LOADER_ENABLE_LINUX_SORT
@@ -435,15 +464,25 @@ enum loader_data_files_type {
     LOADER_DATA_FILE_NUM_TYPES  // Not a real field, used for possible loop terminator
 };
 
+// The file a manifest path resolves to, used to skip manifests which were already found through another path
+struct loader_file_identity {
+    bool known;
+    uint64_t device;
+    uint64_t inode;
+};
+
 struct loader_data_files {
     uint32_t count;
     uint32_t alloc_count;
     char **filename_list;
+    struct loader_file_identity *identity_list;  // Parallel to filename_list, freed once loader_get_data_files returns
 };
 
 struct loader_phys_dev_per_icd {
     uint32_t device_count;
     VkPhysicalDevice *physical_devices;
+    // The properties of physical_devices, NULL unless they were already queried
+    VkPhysicalDeviceProperties *properties;
     uint32_t icd_index;
     struct loader_icd_term *icd_term;
 };
@@ -33,6 +33,13 @@
 #include "log.h"
 
 #include <ctype.h>
+#if defined(__APPLE__)
+#include <crt_externs.h>
+#endif
+
+// FNV-1a
+#define LOADER_ENVIRONMENT_HASH_SEED 14695981039346656037ULL
+#define LOADER_ENVIRONMENT_HASH_PRIME 1099511628211ULL
 
 // Environment variables
 #if defined(__linux__) || defined(__APPLE__) || defined(__Fuchsia__) || defined(__QNXNTO__) || defined(__FreeBSD__) || \
@@ -85,6 +92,27 @@ void loader_free_getenv(char *val, const struct loader_instance *inst) {
     (void)inst;
 }
 
+uint64_t loader_get_environment_hash(void) {
+#if defined(__APPLE__)
+    // environ isn't available to shared libraries on Apple platforms
+    char **env = *_NSGetEnviron();
+#else
+    extern char **environ;
+    char **env = environ;
+#endif
+    uint64_t hash = LOADER_ENVIRONMENT_HASH_SEED;
+    for (; NULL != env && NULL != *env; env++) {
+        // Include each terminator so that moving characters between two variables changes the hash
+        for (const char *c = *env;; c++) {
+            hash = (hash ^ (uint8_t)*c) * LOADER_ENVIRONMENT_HASH_PRIME;
+            if ('\0' == *c) {
+                break;
+            }
+        }
+    }
+    return hash;
+}
+
 #elif defined(WIN32)
 
 bool is_high_integrity() {
@@ -160,6 +188,22 @@ char *loader_secure_getenv(const char *name, const struct loader_instance *inst)
 
 void loader_free_getenv(char *val, const struct loader_instance *inst) { loader_instance_heap_free(inst, (void *)val); }
 
+uint64_t loader_get_environment_hash(void) {
+    uint64_t hash = LOADER_ENVIRONMENT_HASH_SEED;
+    wchar_t *env = GetEnvironmentStringsW();
+    if (NULL == env) {
+        return hash;
+    }
+    // The variables are separated by terminators, and the block ends with an empty one
+    const wchar_t *c = env;
+    while (L'\0' != c[0] || L'\0' != c[1]) {
+        hash = (hash ^ (uint16_t)*c) * LOADER_ENVIRONMENT_HASH_PRIME;
+        c++;
+    }
+    FreeEnvironmentStringsW(env);
+    return hash;
+}
+
 #else
 
 char *loader_getenv(const char *name, const struct loader_instance *inst) {
@@ -173,6 +217,10 @@ void loader_free_getenv(char *val, const struct loader_instance *inst) {
     (void)val;
     (void)inst;
 }
+uint64_t loader_get_environment_hash(void) {
+    // stub func
+    return LOADER_ENVIRONMENT_HASH_SEED;
+}
 
 #endif
 
@@ -35,6 +35,9 @@
 char *loader_getenv(const char *name, const struct loader_instance *inst);
 void loader_free_getenv(char *val, const struct loader_instance *inst);
 
+// Hash of every environment variable and its value, used to notice that the environment changed since something was cached
+uint64_t loader_get_environment_hash(void);
+
 #if defined(WIN32) || defined(__linux__) || defined(__APPLE__) || defined(__Fuchsia__) || defined(__QNXNTO__) || \
     defined(__FreeBSD__) || defined(__OpenBSD__)
 
@@ -24,6 +24,7 @@
 // inclusion doesn't cause unknown header include errors
 #ifdef LOADER_ENABLE_LINUX_SORT
 
+#include <dirent.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -203,31 +204,92 @@ int32_t compare_device_groups(const void *a, const void *b) {
     return 0;
 }
 
-// Search for the default device using the loader environment variable.
-static void linux_env_var_default_device(struct loader_instance *inst, uint32_t device_count,
-                                         struct LinuxSortedDeviceInfo *sorted_device_info) {
+// Reads the vendor ID and device ID of the device selected with VK_LOADER_DEVICE_SELECT. Returns false if it isn't set or
+// isn't of the form "<hex vendor id>:<hex device id>".
+bool linux_get_device_select(const struct loader_instance *inst, uint32_t *vendor_id, uint32_t *device_id) {
+    bool found = false;
     char *selection = loader_getenv("VK_LOADER_DEVICE_SELECT", inst);
     if (NULL != selection) {
+        unsigned selected_vendor_id, selected_device_id;
+        if (2 == sscanf(selection, "%x:%x", &selected_vendor_id, &selected_device_id)) {
+            *vendor_id = selected_vendor_id;
+            *device_id = selected_device_id;
+            found = true;
+        }
+        loader_free_getenv(selection, inst);
+    }
+    return found;
+}
+
+#define LINUX_PCI_DEVICES_PATH "/sys/bus/pci/devices"
+
+bool linux_read_pci_vendors(const struct loader_instance *inst, struct linux_pci_vendors *vendors) {
+    vendors->count = 0;
+    DIR *dir = opendir(LINUX_PCI_DEVICES_PATH);
+    if (NULL == dir) {
         loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                   "linux_env_var_default_device:  Found \'VK_LOADER_DEVICE_SELECT\' set to %s", selection);
-
-        // The environment variable exists, so grab the vendor ID and device ID of the
-        // selected default device
-        unsigned vendor_id, device_id;
-        int32_t matched = sscanf(selection, "%x:%x", &vendor_id, &device_id);
-        if (matched == 2) {
-            for (int32_t i = 0; i < (int32_t)device_count; ++i) {
-                if (sorted_device_info[i].vendor_id == vendor_id && sorted_device_info[i].device_id == device_id) {
-                    loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                               "linux_env_var_default_device:  Found default at index %u \'%s\'", i,
-                               sorted_device_info[i].device_name);
-                    sorted_device_info[i].default_device = true;
-                    break;
+                   "linux_read_pci_vendors: Failed to open " LINUX_PCI_DEVICES_PATH);
+        return false;
+    }
+
+    bool complete = true;
+    struct dirent *entry;
+    while (complete && NULL != (entry = readdir(dir))) {
+        if ('.' == entry->d_name[0]) {
+            continue;
+        }
+        // Each device is a directory named after its address, holding its vendor ID as a hex number in "vendor"
+        char vendor_path[MAX_STRING_SIZE];
+        int length = snprintf(vendor_path, sizeof(vendor_path), LINUX_PCI_DEVICES_PATH "/%s/vendor", entry->d_name);
+        FILE *file = length > 0 && (size_t)length < sizeof(vendor_path) ? fopen(vendor_path, "r") : NULL;
+        unsigned vendor_id = 0;
+        if (NULL == file || 1 != fscanf(file, "%x", &vendor_id)) {
+            loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                       "linux_read_pci_vendors: Failed to read the vendor of PCI device %s", entry->d_name);
+            complete = false;
+        } else {
+            uint32_t i = 0;
+            while (i < vendors->count && vendors->vendor_ids[i] != vendor_id) {
+                i++;
+            }
+            if (i == vendors->count) {
+                if (vendors->count < LINUX_MAX_PCI_VENDORS) {
+                    vendors->vendor_ids[vendors->count++] = vendor_id;
+                } else {
+                    complete = false;
                 }
             }
         }
+        if (NULL != file) {
+            fclose(file);
+        }
+    }
+    closedir(dir);
 
-        loader_free_getenv(selection, inst);
+    if (complete && 0 == vendors->count) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "linux_read_pci_vendors: No PCI devices found in " LINUX_PCI_DEVICES_PATH);
+    }
+    return complete && vendors->count > 0;
+}
+
+// Search for the default device using the loader environment variable.
+static void linux_env_var_default_device(struct loader_instance *inst, uint32_t device_count,
+                                         struct LinuxSortedDeviceInfo *sorted_device_info) {
+    uint32_t vendor_id, device_id;
+    if (linux_get_device_select(inst, &vendor_id, &device_id)) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "linux_env_var_default_device:  Found \'VK_LOADER_DEVICE_SELECT\' set to 0x%x:0x%x", vendor_id, device_id);
+
+        for (int32_t i = 0; i < (int32_t)device_count; ++i) {
+            if (sorted_device_info[i].vendor_id == vendor_id && sorted_device_info[i].device_id == device_id) {
+                loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                           "linux_env_var_default_device:  Found default at index %u \'%s\'", i,
+                           sorted_device_info[i].device_name);
+                sorted_device_info[i].default_device = true;
+                break;
+            }
+        }
     }
 }
 
@@ -260,7 +322,11 @@ VkResult linux_read_sorted_physical_devices(struct loader_instance *inst, uint32
             sorted_device_info[index].icd_term = icd_term;
             sorted_device_info[index].has_pci_bus_info = false;
 
-            icd_term->dispatch.GetPhysicalDeviceProperties(sorted_device_info[index].physical_device, &dev_props);
+            if (NULL != icd_devices[icd_idx].properties) {
+                dev_props = icd_devices[icd_idx].properties[phys_dev];
+            } else {
+                icd_term->dispatch.GetPhysicalDeviceProperties(sorted_device_info[index].physical_device, &dev_props);
+            }
             sorted_device_info[index].device_type = dev_props.deviceType;
             strncpy(sorted_device_info[index].device_name, dev_props.deviceName, VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
             sorted_device_info[index].vendor_id = dev_props.vendorID;
@@ -26,6 +26,21 @@
 
 #include "loader_common.h"
 
+// Reads the device selected with VK_LOADER_DEVICE_SELECT, returns false if there is none
+bool linux_get_device_select(const struct loader_instance *inst, uint32_t *vendor_id, uint32_t *device_id);
+
+#define LINUX_MAX_PCI_VENDORS 32
+
+// The distinct vendor IDs of the PCI devices present in the system
+struct linux_pci_vendors {
+    uint32_t count;
+    uint32_t vendor_ids[LINUX_MAX_PCI_VENDORS];
+};
+
+// Reads the vendor of every device in /sys/bus/pci/devices. Returns false if any of them can't be read, if there are none, or
+// if there are more distinct vendors than fit, as the caller can't rely on the list being complete then.
+bool linux_read_pci_vendors(const struct loader_instance *inst, struct linux_pci_vendors *vendors);
+
 // This function allocates an array in sorted_devices which must be freed by the caller if not null
 VkResult linux_read_sorted_physical_devices(struct loader_instance *inst, uint32_t icd_count,
                                             struct loader_phys_dev_per_icd *icd_devices, uint32_t phys_dev_count,
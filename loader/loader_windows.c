@@ -837,6 +837,7 @@ VkResult windows_read_sorted_physical_devices(struct loader_instance *inst, uint
         struct loader_phys_dev_per_icd *sorted_array = *sorted_devices;
         sorted_array[*sorted_devices_count].device_count = 0;
         sorted_array[*sorted_devices_count].physical_devices = NULL;
+        sorted_array[*sorted_devices_count].properties = NULL;
 
         icd_term = inst->icd_terms;
         for (uint32_t icd_idx = 0; NULL != icd_term; icd_term = icd_term->next, icd_idx++) {
@@ -844,6 +845,10 @@ VkResult windows_read_sorted_physical_devices(struct loader_instance *inst, uint
             if (icd_term->scanned_icd->EnumerateAdapterPhysicalDevices == NULL) {
                 continue;
             }
+            // Drivers left without an instance by VK_LOADER_LAZY_DRIVER_INSTANCES don't expose any physical devices
+            if (icd_term->instance == VK_NULL_HANDLE) {
+                continue;
+            }
 
             uint32_t count = 0;
             VkResult vkres =
@@ -30,12 +30,71 @@
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 
+#include "allocation.h"
 #include "debug_utils.h"
 #include "loader_environment.h"
 
 uint32_t g_loader_debug = 0;
 
+// Repeated message suppression, enabled through VK_LOADER_LOG_RATE_LIMIT.
+// Messages are keyed by their format string and a hash of their formatted text, so that a single call site which fires in a
+// hot loop (eg. trimming the device count in vkEnumeratePhysicalDevices) can't flood stderr and the debug callbacks, while the
+// same call site logging different text isn't mistaken for a repeat. Once a message has been emitted g_loader_log_rate_limit
+// times, further repeats are dropped and a summary of how many were dropped is logged every LOADER_LOG_SUMMARY_INTERVAL
+// repeats, as well as for any remaining repeats when the instance they were logged with is destroyed. Only messages which
+// reach stderr or a debug callback are counted, and when the table is full the message seen least recently makes room for the
+// new one.
+#define LOADER_LOG_DEDUPE_TABLE_SIZE 128
+#define LOADER_LOG_SUMMARY_INTERVAL 1000
+#define LOADER_LOG_MESSAGE_SIZE 512
+
+// FNV-1a
+#define LOADER_LOG_MESSAGE_HASH_SEED 0xcbf29ce484222325ULL
+#define LOADER_LOG_MESSAGE_HASH_PRIME 0x100000001b3ULL
+
+struct loader_log_dedupe_entry {
+    const char *format;
+    uint64_t message_hash;
+    uint32_t emitted_count;
+    uint32_t suppressed_count;
+    // The value of g_loader_log_dedupe_sequence when the message was last seen
+    uint64_t last_seen;
+    // The instance and type of the last suppressed repeat and its text, to log the summary of the repeats still pending when
+    // that instance is destroyed
+    const struct loader_instance *inst;
+    VkFlags msg_type;
+    char message[LOADER_LOG_MESSAGE_SIZE];
+};
+
+static uint32_t g_loader_log_rate_limit = 0;
+static uint64_t g_loader_log_dedupe_sequence = 0;
+// Only allocated while rate limiting is enabled, as it holds the text of every tracked message
+static struct loader_log_dedupe_entry *g_loader_log_dedupe_table = NULL;
+static loader_platform_thread_mutex g_loader_log_dedupe_lock;
+
+static void loader_log_rate_limit_init(void) {
+    if (g_loader_log_rate_limit > 0) return;
+
+    char *env = loader_getenv("VK_LOADER_LOG_RATE_LIMIT", NULL);
+    if (NULL != env) {
+        int limit = atoi(env);
+        if (limit > 0) {
+            // Messages are simply never suppressed if the table can't be allocated
+            g_loader_log_dedupe_table = loader_calloc(NULL, LOADER_LOG_DEDUPE_TABLE_SIZE * sizeof(struct loader_log_dedupe_entry),
+                                                      VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (NULL != g_loader_log_dedupe_table) {
+                g_loader_log_dedupe_sequence = 0;
+                loader_platform_thread_create_mutex(&g_loader_log_dedupe_lock);
+                g_loader_log_rate_limit = (uint32_t)limit;
+            }
+        }
+    }
+    loader_free_getenv(env, NULL);
+}
+
 void loader_debug_init(void) {
     char *env, *orig;
 
@@ -43,6 +102,8 @@ void loader_debug_init(void) {
 
     g_loader_debug = 0;
 
+    loader_log_rate_limit_init();
+
     // Parse comma-separated debug options
     orig = env = loader_getenv("VK_LOADER_DEBUG", NULL);
     while (env) {
@@ -83,22 +144,100 @@ void loader_debug_init(void) {
     loader_free_getenv(orig, NULL);
 }
 
+void loader_debug_release(void) {
+    if (g_loader_log_rate_limit > 0) {
+        // Repeats logged without an instance are summarized when the loader is unloaded
+        loader_log_flush_suppressed(NULL);
+        g_loader_log_rate_limit = 0;
+        loader_platform_thread_delete_mutex(&g_loader_log_dedupe_lock);
+        loader_free(NULL, g_loader_log_dedupe_table);
+        g_loader_log_dedupe_table = NULL;
+    }
+}
+
+void loader_debug_fork_prepare(void) {
+    if (g_loader_log_rate_limit > 0) {
+        loader_platform_thread_lock_mutex(&g_loader_log_dedupe_lock);
+    }
+}
+
+void loader_debug_fork_release(void) {
+    if (g_loader_log_rate_limit > 0) {
+        loader_platform_thread_unlock_mutex(&g_loader_log_dedupe_lock);
+    }
+}
+
 uint32_t loader_get_debug_level(void) { return g_loader_debug; }
 
-void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t msg_code, const char *format, ...) {
-    char msg[512];
+static uint64_t loader_log_hash_message(const char *msg) {
+    uint64_t hash = LOADER_LOG_MESSAGE_HASH_SEED;
+    for (const char *c = msg; *c != '\0'; c++) {
+        hash = (hash ^ (uint8_t)*c) * LOADER_LOG_MESSAGE_HASH_PRIME;
+    }
+    return hash;
+}
+
+// Determines whether a message with the given format and text should be emitted, based on how many times it has been emitted
+// before. When a message has been suppressed LOADER_LOG_SUMMARY_INTERVAL times in a row, suppressed_summary is set to that
+// count so the caller can log a summary in its place.
+static bool loader_log_should_emit(const struct loader_instance *inst, VkFlags msg_type, const char *format, const char *msg,
+                                   uint32_t *suppressed_summary) {
+    bool emit = true;
+    *suppressed_summary = 0;
+
+    uint64_t message_hash = loader_log_hash_message(msg);
+    loader_platform_thread_lock_mutex(&g_loader_log_dedupe_lock);
+    uint32_t index = (uint32_t)((((uintptr_t)format >> 3) ^ message_hash) % LOADER_LOG_DEDUPE_TABLE_SIZE);
+    struct loader_log_dedupe_entry *entry = NULL;
+    struct loader_log_dedupe_entry *least_recent = NULL;
+    for (uint32_t probe = 0; probe < LOADER_LOG_DEDUPE_TABLE_SIZE; probe++) {
+        struct loader_log_dedupe_entry *current = &g_loader_log_dedupe_table[(index + probe) % LOADER_LOG_DEDUPE_TABLE_SIZE];
+        if (NULL == current->format || (current->format == format && current->message_hash == message_hash)) {
+            entry = current;
+            break;
+        }
+        if (NULL == least_recent || current->last_seen < least_recent->last_seen) {
+            least_recent = current;
+        }
+    }
+    // Entries are never emptied, so replacing one in place keeps every other message reachable from its starting index
+    if (NULL == entry) {
+        entry = least_recent;
+    }
+    if (entry->format != format || entry->message_hash != message_hash) {
+        entry->format = format;
+        entry->message_hash = message_hash;
+        entry->emitted_count = 0;
+        entry->suppressed_count = 0;
+        entry->inst = NULL;
+    }
+    entry->last_seen = ++g_loader_log_dedupe_sequence;
+
+    if (entry->emitted_count < g_loader_log_rate_limit) {
+        entry->emitted_count++;
+    } else {
+        emit = false;
+        if (0 == entry->suppressed_count) {
+            strncpy(entry->message, msg, LOADER_LOG_MESSAGE_SIZE - 1);
+            entry->message[LOADER_LOG_MESSAGE_SIZE - 1] = '\0';
+        }
+        entry->suppressed_count++;
+        entry->inst = inst;
+        entry->msg_type = msg_type;
+        if (entry->suppressed_count == LOADER_LOG_SUMMARY_INTERVAL) {
+            *suppressed_summary = entry->suppressed_count;
+            entry->suppressed_count = 0;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&g_loader_log_dedupe_lock);
+
+    return emit;
+}
+
+static void loader_log_emit(const struct loader_instance *inst, VkFlags msg_type, char *msg) {
     char cmd_line_msg[512];
     size_t cmd_line_size = sizeof(cmd_line_msg);
     size_t num_used = 0;
-    va_list ap;
-    int ret;
-
-    va_start(ap, format);
-    ret = vsnprintf(msg, sizeof(msg), format, ap);
-    if ((ret >= (int)sizeof(msg)) || ret < 0) {
-        msg[sizeof(msg) - 1] = '\0';
-    }
-    va_end(ap);
 
     if (inst) {
         VkDebugUtilsMessageSeverityFlagBitsEXT severity = 0;
@@ -114,8 +253,9 @@ void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t ms
             severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
         } else if ((msg_type & VULKAN_LOADER_DEBUG_BIT) != 0) {
             severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_LAYER_BIT) != 0 || (msg_type & VULKAN_LOADER_DRIVER_BIT) != 0) {
-            // Just driver or just layer bit should be treated as an info message in debug utils.
+        } else if ((msg_type & VULKAN_LOADER_LAYER_BIT) != 0 || (msg_type & VULKAN_LOADER_DRIVER_BIT) != 0 ||
+                   (msg_type & VULKAN_LOADER_PERF_BIT) != 0) {
+            // Just driver, just layer, or just perf bit should be treated as an info message in debug utils.
             severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
         }
 
@@ -230,6 +370,69 @@ void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t ms
     }
 }
 
+static void loader_log_emit_summary(const struct loader_instance *inst, VkFlags msg_type, uint32_t suppressed_count,
+                                    const char *msg) {
+    char summary_msg[LOADER_LOG_MESSAGE_SIZE];
+    int ret = snprintf(summary_msg, sizeof(summary_msg), "loader_log: Suppressed %u repeats of message \"%s\"", suppressed_count,
+                       msg);
+    if ((ret >= (int)sizeof(summary_msg)) || ret < 0) {
+        summary_msg[sizeof(summary_msg) - 1] = '\0';
+    }
+    loader_log_emit(inst, msg_type, summary_msg);
+}
+
+void loader_log_flush_suppressed(const struct loader_instance *inst) {
+    if (0 == g_loader_log_rate_limit) return;
+
+    for (uint32_t i = 0; i < LOADER_LOG_DEDUPE_TABLE_SIZE; i++) {
+        uint32_t suppressed_count = 0;
+        VkFlags msg_type = 0;
+        char msg[LOADER_LOG_MESSAGE_SIZE];
+        loader_platform_thread_lock_mutex(&g_loader_log_dedupe_lock);
+        struct loader_log_dedupe_entry *entry = &g_loader_log_dedupe_table[i];
+        if (NULL != entry->format && entry->inst == inst) {
+            suppressed_count = entry->suppressed_count;
+            msg_type = entry->msg_type;
+            memcpy(msg, entry->message, sizeof(msg));
+            entry->suppressed_count = 0;
+            // The instance is going away, so it mustn't be matched against a later instance at the same address
+            entry->inst = NULL;
+        }
+        loader_platform_thread_unlock_mutex(&g_loader_log_dedupe_lock);
+
+        // Emitted outside of the lock as the debug callbacks may log themselves
+        if (suppressed_count > 0) {
+            loader_log_emit_summary(inst, msg_type, suppressed_count, msg);
+        }
+    }
+}
+
+void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t msg_code, const char *format, ...) {
+    char msg[LOADER_LOG_MESSAGE_SIZE];
+    va_list ap;
+    int ret;
+
+    va_start(ap, format);
+    ret = vsnprintf(msg, sizeof(msg), format, ap);
+    if ((ret >= (int)sizeof(msg)) || ret < 0) {
+        msg[sizeof(msg) - 1] = '\0';
+    }
+    va_end(ap);
+
+    // Messages which go nowhere are left out, so that they can't take up the table or count towards the limit
+    if (g_loader_log_rate_limit > 0 && (0 != (msg_type & g_loader_debug) || (NULL != inst && util_HasDebugCallbacks(inst)))) {
+        uint32_t suppressed_summary = 0;
+        if (!loader_log_should_emit(inst, msg_type, format, msg, &suppressed_summary)) {
+            if (suppressed_summary > 0) {
+                loader_log_emit_summary(inst, msg_type, suppressed_summary, msg);
+            }
+            return;
+        }
+    }
+
+    loader_log_emit(inst, msg_type, msg);
+}
+
 void loader_log_asm_function_not_supported(const struct loader_instance *inst, VkFlags msg_type, int32_t msg_code,
                                            const char *func_name) {
     loader_log(inst, msg_type, msg_code, "Function %s not supported for this physical device", func_name);
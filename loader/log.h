@@ -43,9 +43,27 @@ enum vulkan_loader_debug_flags {
 // This should be called before any Vulkan API calls, eg in the initialization of the .dll or .so
 void loader_debug_init(void);
 
+// Releases any resources acquired by loader_debug_init, such as the message rate limiting state
+void loader_debug_release(void);
+
+// Logs a summary of the repeats of each message which VK_LOADER_LOG_RATE_LIMIT suppressed since its last summary, for the
+// messages last suppressed with inst. Called when inst is destroyed, so that no suppressed repeat goes unreported.
+void loader_log_flush_suppressed(const struct loader_instance *inst);
+
+// Holds and releases the message rate limiting state across fork(), used by the loader's fork handlers
+void loader_debug_fork_prepare(void);
+void loader_debug_fork_release(void);
+
 // Returns a bitmask that indicates the current flags that should be output
 uint32_t loader_get_debug_level(void);
 
+// Starts every VULKAN_LOADER_PERF_BIT message, which tools parse, so it and the fields that follow must not change. The
+// prefix is followed by an event name and space separated key=value fields, path always coming last so it may contain spaces:
+//   loader_perf: manifest_read kind=<driver|layer> us=<N> path=<manifest>
+//   loader_perf: library_load kind=<driver|layer> us=<N> path=<library>
+//   loader_perf: driver_create_instance us=<N> path=<library>
+#define LOADER_PERF_MESSAGE_PREFIX "loader_perf: "
+
 // Logs a message to stderr
 // May output to DebugUtils if the instance isn't null and the extension is enabled.
 void loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t msg_code, const char *format, ...);
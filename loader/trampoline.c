@@ -32,6 +32,7 @@
 #include "gpa_helper.h"
 #include "loader.h"
 #include "log.h"
+#include "vk_loader_async.h"
 #include "vk_loader_extensions.h"
 #include "vk_loader_platform.h"
 #include "wsi.h"
@@ -466,7 +467,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
 
     // Handle cases of VK_EXT_debug_utils
     // Setup the temporary messenger(s) here to catch early issues:
-    res = util_CreateDebugUtilsMessengers(ptr_instance, pCreateInfo->pNext, pAllocator);
+    res = util_CreateDebugUtilsMessengers(ptr_instance, pCreateInfo->pNext);
     if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
         // Failure of setting up one or more of the messenger.
         goto out;
@@ -474,7 +475,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
 
     // Handle cases of VK_EXT_debug_report
     // Setup the temporary callback(s) here to catch early issues:
-    res = util_CreateDebugReportCallbacks(ptr_instance, pCreateInfo->pNext, pAllocator);
+    res = util_CreateDebugReportCallbacks(ptr_instance, pCreateInfo->pNext);
     if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
         // Failure of setting up one or more of the callback.
         goto out;
@@ -547,7 +548,15 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
     if (res != VK_SUCCESS) {
         goto out;
     }
-    res = loader_validate_instance_extensions(ptr_instance, &ptr_instance->ext_list, &ptr_instance->instance_layer_list, &ici);
+
+    // Resolve the set of layers to activate. This is done once, as both validating the enabled extensions and building the
+    // instance chain need the same expanded list.
+    res = loader_enable_instance_layers(ptr_instance, &ici, &ptr_instance->instance_layer_list);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+    res = loader_validate_instance_extensions(ptr_instance, &ptr_instance->ext_list, &ptr_instance->expanded_activated_layer_list,
+                                              &ici);
     if (res != VK_SUCCESS) {
         goto out;
     }
@@ -560,19 +569,13 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
         res = VK_ERROR_OUT_OF_HOST_MEMORY;
         goto out;
     }
-    memcpy(&ptr_instance->disp->layer_inst_disp, &instance_disp, sizeof(instance_disp));
+    loader_init_instance_terminator_dispatch(&ptr_instance->disp->layer_inst_disp);
 
     loader_platform_thread_lock_mutex(&loader_global_instance_list_lock);
     ptr_instance->next = loader.instances;
     loader.instances = ptr_instance;
     loader_platform_thread_unlock_mutex(&loader_global_instance_list_lock);
 
-    // Activate any layers on instance chain
-    res = loader_enable_instance_layers(ptr_instance, &ici, &ptr_instance->instance_layer_list);
-    if (res != VK_SUCCESS) {
-        goto out;
-    }
-
     created_instance = (VkInstance)ptr_instance;
     res = loader_create_instance_chain(&ici, pAllocator, ptr_instance, &created_instance);
 
@@ -611,8 +614,9 @@ out:
             loader_platform_thread_unlock_mutex(&loader_global_instance_list_lock);
 
             loader_instance_heap_free(ptr_instance, ptr_instance->disp);
+            loader_log_flush_suppressed(ptr_instance);
             // Remove any created VK_EXT_debug_report or VK_EXT_debug_utils items
-            destroy_debug_callbacks_chain(ptr_instance, pAllocator);
+            destroy_debug_callbacks_chain(ptr_instance);
 
             if (NULL != ptr_instance->expanded_activated_layer_list.list) {
                 loader_deactivate_layers(ptr_instance, NULL, &ptr_instance->expanded_activated_layer_list);
@@ -638,8 +642,7 @@ out:
             loader_instance_heap_free(ptr_instance, ptr_instance);
         } else {
             // success path, swap out created debug callbacks out so they aren't used until instance destruction
-            ptr_instance->InstanceCreationDeletionDebugFunctionHead = ptr_instance->DbgFunctionHead;
-            ptr_instance->DbgFunctionHead = NULL;
+            stash_instance_creation_debug_callbacks(ptr_instance);
         }
         // Only unlock when ptr_instance isn't NULL, as if it is, the above code didn't make it to when loader_lock was locked.
         loader_platform_thread_unlock_mutex(&loader_lock);
@@ -648,6 +651,107 @@ out:
     return res;
 }
 
+struct VkLoaderPendingInstance_T {
+    const VkInstanceCreateInfo *create_info;
+    const VkAllocationCallbacks *allocator;
+    loader_platform_thread thread;
+    loader_platform_thread_mutex lock;
+    bool complete;
+    VkResult result;
+    VkInstance instance;
+};
+
+static LOADER_PLATFORM_THREAD_PROC(loader_create_instance_thread, arg) {
+    struct VkLoaderPendingInstance_T *pending = (struct VkLoaderPendingInstance_T *)arg;
+    VkInstance instance = VK_NULL_HANDLE;
+
+    VkResult res = vkCreateInstance(pending->create_info, pending->allocator, &instance);
+
+    loader_platform_thread_lock_mutex(&pending->lock);
+    pending->instance = instance;
+    pending->result = res;
+    pending->complete = true;
+    loader_platform_thread_unlock_mutex(&pending->lock);
+    return 0;
+}
+
+LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_loaderCreateInstanceAsync(const VkInstanceCreateInfo *pCreateInfo,
+                                                                          const VkAllocationCallbacks *pAllocator,
+                                                                          VkLoaderPendingInstance *pPendingInstance) {
+    LOADER_PLATFORM_THREAD_ONCE(&once_init, loader_initialize);
+
+    if (pCreateInfo == NULL) {
+        loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0,
+                   "vk_loaderCreateInstanceAsync: \'pCreateInfo\' is NULL");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    if (pPendingInstance == NULL) {
+        loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0,
+                   "vk_loaderCreateInstanceAsync: \'pPendingInstance\' is NULL");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    struct VkLoaderPendingInstance_T *pending =
+        loader_calloc(pAllocator, sizeof(struct VkLoaderPendingInstance_T), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (pending == NULL) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    pending->create_info = pCreateInfo;
+    pending->allocator = pAllocator;
+    pending->result = VK_NOT_READY;
+    loader_platform_thread_create_mutex(&pending->lock);
+
+    if (!loader_platform_thread_create(&pending->thread, loader_create_instance_thread, pending)) {
+        loader_log(NULL, VULKAN_LOADER_ERROR_BIT, 0, "vk_loaderCreateInstanceAsync: Failed to start instance creation thread");
+        loader_platform_thread_delete_mutex(&pending->lock);
+        loader_free(pAllocator, pending);
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    *pPendingInstance = pending;
+    return VK_SUCCESS;
+}
+
+LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_loaderGetPendingInstanceStatus(VkLoaderPendingInstance pendingInstance) {
+    if (pendingInstance == NULL) {
+        loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0,
+                   "vk_loaderGetPendingInstanceStatus: \'pendingInstance\' is NULL");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    loader_platform_thread_lock_mutex(&pendingInstance->lock);
+    VkResult res = pendingInstance->complete ? pendingInstance->result : VK_NOT_READY;
+    loader_platform_thread_unlock_mutex(&pendingInstance->lock);
+    return res;
+}
+
+LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_loaderWaitForPendingInstance(VkLoaderPendingInstance pendingInstance,
+                                                                             VkInstance *pInstance) {
+    if (pendingInstance == NULL) {
+        loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0,
+                   "vk_loaderWaitForPendingInstance: \'pendingInstance\' is NULL");
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    // This is the only place the handle is freed, so the thread never outlives it
+    loader_platform_thread_join(pendingInstance->thread);
+
+    VkResult res = pendingInstance->result;
+    if (pInstance != NULL) {
+        *pInstance = pendingInstance->instance;
+    } else if (res == VK_SUCCESS) {
+        // Nowhere to return the instance to, so it would be leaked
+        loader_log(NULL, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_VALIDATION_BIT, 0,
+                   "vk_loaderWaitForPendingInstance: \'pInstance\' is NULL, destroying the created instance");
+        vkDestroyInstance(pendingInstance->instance, pendingInstance->allocator);
+        res = VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    loader_platform_thread_delete_mutex(&pendingInstance->lock);
+    loader_free(pendingInstance->allocator, pendingInstance);
+    return res;
+}
+
 LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
     const VkLayerInstanceDispatchTable *disp;
     struct loader_instance *ptr_instance = NULL;
@@ -670,11 +774,10 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance,
     }
 
     // Remove any callbacks that weren't cleaned up by the application
-    destroy_debug_callbacks_chain(ptr_instance, pAllocator);
+    destroy_debug_callbacks_chain(ptr_instance);
 
     // Swap in the debug callbacks created during instance creation
-    ptr_instance->DbgFunctionHead = ptr_instance->InstanceCreationDeletionDebugFunctionHead;
-    ptr_instance->InstanceCreationDeletionDebugFunctionHead = NULL;
+    restore_instance_creation_debug_callbacks(ptr_instance);
 
     disp = loader_get_instance_layer_dispatch(instance);
     disp->DestroyInstance(ptr_instance->instance, pAllocator);
@@ -693,8 +796,11 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance,
         loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_tramp);
     }
 
+    // Report the repeats VK_LOADER_LOG_RATE_LIMIT suppressed to the debug callbacks created during instance creation
+    loader_log_flush_suppressed(ptr_instance);
+
     // Destroy the debug callbacks created during instance creation
-    destroy_debug_callbacks_chain(ptr_instance, pAllocator);
+    destroy_debug_callbacks_chain(ptr_instance);
 
     loader_instance_heap_free(ptr_instance, ptr_instance->disp);
     loader_instance_heap_free(ptr_instance, ptr_instance);
@@ -25,6 +25,7 @@
 #include "unknown_function_handling.h"
 
 #include "allocation.h"
+#include "loader.h"
 #include "log.h"
 
 // Forward declarations
@@ -34,38 +35,30 @@ void *loader_get_phys_dev_ext_termin(uint32_t index);
 
 // Device function handling
 
-// Initialize device_ext dispatch table entry as follows:
-// If dev == NULL find all logical devices created within this instance and
-//  init the entry (given by idx) in the ext dispatch table.
-// If dev != NULL only initialize the entry in the given dev's dispatch table.
+// Initialize the device_ext dispatch table entry given by idx of dev.
 // The initialization value is gotten by calling down the device chain with
 // GDPA.
 // If GDPA returns NULL then don't initialize the dispatch table entry.
-void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst, struct loader_device *dev, uint32_t idx, const char *funcName)
-
-{
-    void *gdpa_value;
-    if (dev != NULL) {
-        gdpa_value = dev->loader_dispatch.core_dispatch.GetDeviceProcAddr(dev->chain_device, funcName);
-        if (gdpa_value != NULL) dev->loader_dispatch.ext_dispatch[idx] = (PFN_vkDevExt)gdpa_value;
-    } else {
-        for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-            struct loader_device *ldev = icd_term->logical_device_list;
-            while (ldev) {
-                gdpa_value = ldev->loader_dispatch.core_dispatch.GetDeviceProcAddr(ldev->chain_device, funcName);
-                if (gdpa_value != NULL) ldev->loader_dispatch.ext_dispatch[idx] = (PFN_vkDevExt)gdpa_value;
-                ldev = ldev->next;
-            }
-        }
-    }
+static void loader_init_dispatch_dev_ext_entry(struct loader_device *dev, uint32_t idx, const char *funcName) {
+    void *gdpa_value = dev->loader_dispatch.core_dispatch.GetDeviceProcAddr(dev->chain_device, funcName);
+    if (gdpa_value != NULL) dev->loader_dispatch.ext_dispatch[idx] = (PFN_vkDevExt)gdpa_value;
 }
 
 // Find all dev extension in the function names array  and initialize the dispatch table
 // for dev  for each of those extension entrypoints found in function names array.
+// The names are copied under loader_unknown_function_lock and the chain is called without it, as a layer may call
+// vkGetDeviceProcAddr for an unknown function from its own vkGetDeviceProcAddr, which takes the lock again. Names are only ever
+// appended and live as long as the instance, and a function added after the copy is filled in by loader_dev_ext_gpa_impl,
+// since dev is already in its driver's logical device list.
 void loader_init_dispatch_dev_ext(struct loader_instance *inst, struct loader_device *dev) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        if (inst->dev_ext_disp_functions[i] != NULL)
-            loader_init_dispatch_dev_ext_entry(inst, dev, i, inst->dev_ext_disp_functions[i]);
+    char *function_names[MAX_NUM_UNKNOWN_EXTS];
+    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
+    uint32_t function_count = inst->dev_ext_disp_function_count;
+    memcpy(function_names, inst->dev_ext_disp_functions, function_count * sizeof(char *));
+    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
+
+    for (uint32_t i = 0; i < function_count; i++) {
+        if (function_names[i] != NULL) loader_init_dispatch_dev_ext_entry(dev, i, function_names[i]);
     }
 }
 
@@ -73,7 +66,11 @@ bool loader_check_icds_for_dev_ext_address(struct loader_instance *inst, const c
     struct loader_icd_term *icd_term;
     icd_term = inst->icd_terms;
     while (NULL != icd_term) {
-        if (icd_term->scanned_icd->GetInstanceProcAddr(icd_term->instance, funcName))
+        // Only the drivers up to the first one which supports funcName need an instance
+        if (VK_SUCCESS != loader_create_deferred_icd_instance(inst, icd_term)) {
+            return false;
+        }
+        if (VK_NULL_HANDLE != icd_term->instance && icd_term->scanned_icd->GetInstanceProcAddr(icd_term->instance, funcName))
             // this icd supports funcName
             return true;
         icd_term = icd_term->next;
@@ -120,6 +117,62 @@ void loader_free_dev_ext_table(struct loader_instance *inst) {
     memset(inst->dev_ext_disp_functions, 0, sizeof(inst->dev_ext_disp_functions));
 }
 
+// The call down the chain of a logical device which existed when an unknown function was added, made without
+// loader_unknown_function_lock held.
+struct loader_dev_ext_chain_call {
+    struct loader_device *dev;
+    VkDevice chain_device;
+    PFN_vkGetDeviceProcAddr get_device_proc_addr;
+    PFN_vkDevExt function;
+};
+
+// Must be called with loader_unknown_function_lock held, as the logical device lists are walked.
+static uint32_t loader_count_logical_devices(struct loader_instance *inst) {
+    uint32_t count = 0;
+    for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
+        for (struct loader_device *ldev = icd_term->logical_device_list; ldev != NULL; ldev = ldev->next) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// Must be called with loader_unknown_function_lock held, as the logical device lists are walked.
+static void loader_copy_logical_devices(struct loader_instance *inst, struct loader_dev_ext_chain_call *calls) {
+    uint32_t count = 0;
+    for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
+        for (struct loader_device *ldev = icd_term->logical_device_list; ldev != NULL; ldev = ldev->next) {
+            calls[count].dev = ldev;
+            calls[count].chain_device = ldev->chain_device;
+            calls[count].get_device_proc_addr = ldev->loader_dispatch.core_dispatch.GetDeviceProcAddr;
+            count++;
+        }
+    }
+}
+
+// Must be called with loader_unknown_function_lock held, as the logical device lists are walked.
+static bool loader_logical_device_exists(struct loader_instance *inst, const struct loader_dev_ext_chain_call *call) {
+    for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
+        for (struct loader_device *ldev = icd_term->logical_device_list; ldev != NULL; ldev = ldev->next) {
+            if (ldev == call->dev && ldev->chain_device == call->chain_device) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Must be called with loader_unknown_function_lock held.
+static bool loader_find_dev_ext_function(struct loader_instance *inst, const char *funcName, uint32_t *index) {
+    for (uint32_t i = 0; i < inst->dev_ext_disp_function_count; i++) {
+        if (inst->dev_ext_disp_functions[i] && !strcmp(inst->dev_ext_disp_functions[i], funcName)) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
 /*
  * This function returns generic trampoline code address for unknown entry points.
  * Presumably, these unknown entry points (as given by funcName) are device extension
@@ -138,23 +191,50 @@ void loader_free_dev_ext_table(struct loader_instance *inst) {
  * ICD returns a non-NULL GetProcAddr for it.
  */
 void *loader_dev_ext_gpa_impl(struct loader_instance *inst, const char *funcName, bool is_tramp) {
+    uint32_t index = 0;
+
     // Linearly look through already added functions to make sure we haven't seen it before
     // if we have, return the function at the index found
-    for (uint32_t i = 0; i < inst->dev_ext_disp_function_count; i++) {
-        if (inst->dev_ext_disp_functions[i] && !strcmp(inst->dev_ext_disp_functions[i], funcName))
-            return loader_get_dev_ext_trampoline(i);
+    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
+    bool found = loader_find_dev_ext_function(inst, funcName, &index);
+    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
+    if (found) {
+        return loader_get_dev_ext_trampoline(index);
     }
 
-    // Check if funcName is supported in either ICDs or a layer library
+    // Check if funcName is supported in either ICDs or a layer library. The lock isn't held for this as querying the layers
+    // calls down the chain, which comes back into the loader's terminators.
     if (!loader_check_icds_for_dev_ext_address(inst, funcName)) {
         if (!is_tramp || !loader_check_layer_list_for_dev_ext_address(inst, funcName)) {
             // if support found in layers continue on
             return NULL;
         }
     }
+
+    void *out_function = NULL;
+    struct loader_dev_ext_chain_call *calls = NULL;
+    uint32_t device_count = 0;
+    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
+    // Another thread may have added the same function while the lock was released
+    if (loader_find_dev_ext_function(inst, funcName, &index)) {
+        out_function = loader_get_dev_ext_trampoline(index);
+        goto out;
+    }
     if (inst->dev_ext_disp_function_count >= MAX_NUM_UNKNOWN_EXTS) {
         loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0, "loader_dev_ext_gpa: Exhausted the unknown device function array!");
-        return NULL;
+        goto out;
+    }
+
+    // The dispatch tables of the existing devices are filled in by calling down their chains once the lock is released, as a
+    // layer may look up another unknown function from its vkGetDeviceProcAddr, which takes the lock again.
+    device_count = loader_count_logical_devices(inst);
+    if (device_count > 0) {
+        calls = (struct loader_dev_ext_chain_call *)loader_instance_heap_calloc(
+            inst, device_count * sizeof(struct loader_dev_ext_chain_call), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        if (NULL == calls) {
+            goto out;
+        }
+        loader_copy_logical_devices(inst, calls);
     }
 
     // add found function to dev_ext_disp_functions;
@@ -163,13 +243,29 @@ void *loader_dev_ext_gpa_impl(struct loader_instance *inst, const char *funcName
         (char *)loader_instance_heap_alloc(inst, funcName_len, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
     if (NULL == inst->dev_ext_disp_functions[inst->dev_ext_disp_function_count]) {
         // failed to allocate memory, return NULL
-        return NULL;
+        goto out;
     }
     strncpy(inst->dev_ext_disp_functions[inst->dev_ext_disp_function_count], funcName, funcName_len);
-    // init any dev dispatch table entries as needed
-    loader_init_dispatch_dev_ext_entry(inst, NULL, inst->dev_ext_disp_function_count, funcName);
-    void *out_function = loader_get_dev_ext_trampoline(inst->dev_ext_disp_function_count);
-    inst->dev_ext_disp_function_count++;
+    // Devices created from now on fill in the entry themselves in loader_init_dispatch_dev_ext
+    index = inst->dev_ext_disp_function_count++;
+    out_function = loader_get_dev_ext_trampoline(index);
+    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
+
+    for (uint32_t i = 0; i < device_count; i++) {
+        calls[i].function = (PFN_vkDevExt)calls[i].get_device_proc_addr(calls[i].chain_device, funcName);
+    }
+
+    // Devices destroyed while the lock was released are skipped
+    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
+    for (uint32_t i = 0; i < device_count; i++) {
+        if (calls[i].function != NULL && loader_logical_device_exists(inst, &calls[i])) {
+            calls[i].dev->loader_dispatch.ext_dispatch[index] = calls[i].function;
+        }
+    }
+
+out:
+    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
+    loader_instance_heap_free(inst, calls);
     return out_function;
 }
 
@@ -185,9 +281,13 @@ void *loader_dev_ext_gpa_term(struct loader_instance *inst, const char *funcName
 
 bool loader_check_icds_for_phys_dev_ext_address(struct loader_instance *inst, const char *funcName) {
     struct loader_icd_term *icd_term;
+    if (VK_SUCCESS != loader_create_deferred_icd_instances(inst)) {
+        return false;
+    }
     icd_term = inst->icd_terms;
     while (NULL != icd_term) {
-        if (icd_term->scanned_icd->interface_version >= MIN_PHYS_DEV_EXTENSION_ICD_INTERFACE_VERSION &&
+        if (VK_NULL_HANDLE != icd_term->instance &&
+            icd_term->scanned_icd->interface_version >= MIN_PHYS_DEV_EXTENSION_ICD_INTERFACE_VERSION &&
             icd_term->scanned_icd->GetPhysicalDeviceProcAddr &&
             icd_term->scanned_icd->GetPhysicalDeviceProcAddr(icd_term->instance, funcName))
             // this icd supports funcName
@@ -247,6 +347,7 @@ void *loader_phys_dev_ext_gpa_impl(struct loader_instance *inst, const char *fun
 
     bool has_found = false;
     uint32_t new_function_index = 0;
+    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
     // Linearly look through already added functions to make sure we haven't seen it before
     // if we have, return the function at the index found
     for (uint32_t i = 0; i < inst->phys_dev_ext_disp_function_count; i++) {
@@ -262,6 +363,7 @@ void *loader_phys_dev_ext_gpa_impl(struct loader_instance *inst, const char *fun
         if (inst->phys_dev_ext_disp_function_count >= MAX_NUM_UNKNOWN_EXTS) {
             loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                        "loader_dev_ext_gpa: Exhausted the unknown physical device function array!");
+            loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
             return NULL;
         }
 
@@ -275,6 +377,7 @@ void *loader_phys_dev_ext_gpa_impl(struct loader_instance *inst, const char *fun
             (char *)loader_instance_heap_alloc(inst, funcName_len, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
         if (NULL == inst->phys_dev_ext_disp_functions[inst->phys_dev_ext_disp_function_count]) {
             // failed to allocate memory, return NULL
+            loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
             return NULL;
         }
         strncpy(inst->phys_dev_ext_disp_functions[inst->phys_dev_ext_disp_function_count], funcName, funcName_len);
@@ -288,7 +391,8 @@ void *loader_phys_dev_ext_gpa_impl(struct loader_instance *inst, const char *fun
     // Setup the ICD function pointers
     struct loader_icd_term *icd_term = inst->icd_terms;
     while (NULL != icd_term) {
-        if (MIN_PHYS_DEV_EXTENSION_ICD_INTERFACE_VERSION <= icd_term->scanned_icd->interface_version &&
+        if (VK_NULL_HANDLE != icd_term->instance &&
+            MIN_PHYS_DEV_EXTENSION_ICD_INTERFACE_VERSION <= icd_term->scanned_icd->interface_version &&
             NULL != icd_term->scanned_icd->GetPhysicalDeviceProcAddr) {
             icd_term->phys_dev_ext[new_function_index] =
                 (PFN_PhysDevExt)icd_term->scanned_icd->GetPhysicalDeviceProcAddr(icd_term->instance, funcName);
@@ -306,9 +410,11 @@ void *loader_phys_dev_ext_gpa_impl(struct loader_instance *inst, const char *fun
 
         icd_term = icd_term->next;
     }
+    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
 
     // Now if this is being run in the trampoline, search for the first layer attached and query using it to get the first entry
-    // point. Only set the instance dispatch table to it if it isn't NULL.
+    // point. Only set the instance dispatch table to it if it isn't NULL. The lock isn't held while calling down the chain, as
+    // that comes back into the loader's terminators.
     if (is_tramp) {
         for (uint32_t i = 0; i < inst->expanded_activated_layer_list.count; i++) {
             struct loader_layer_properties *layer_prop = &inst->expanded_activated_layer_list.list[i];
@@ -316,9 +422,11 @@ void *loader_phys_dev_ext_gpa_impl(struct loader_instance *inst, const char *fun
                 void *layer_ret_function =
                     (PFN_PhysDevExt)layer_prop->functions.get_physical_device_proc_addr(inst->instance, funcName);
                 if (NULL != layer_ret_function) {
+                    loader_platform_thread_lock_mutex(&loader_unknown_function_lock);
                     inst->disp->phys_dev_ext[new_function_index] = layer_ret_function;
+                    loader_platform_thread_unlock_mutex(&loader_unknown_function_lock);
                     loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "loader_phys_dev_ext_gpa: Layer %s returned ptr %p for %s",
-                               layer_prop->info.layerName, inst->disp->phys_dev_ext[new_function_index], funcName);
+                               layer_prop->info.layerName, layer_ret_function, funcName);
                     break;
                 }
             }
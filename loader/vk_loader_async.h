@@ -0,0 +1,64 @@
+/*
+ *
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Loader specific entrypoints for creating a VkInstance on a loader owned thread.
+//
+// vk_loaderCreateInstanceAsync returns as soon as the thread has been started, with a pending instance handle that is used to
+// query the result of the creation. The work done on the thread is exactly that of vkCreateInstance, so the resulting
+// VkInstance is identical to one created synchronously.
+//
+// pCreateInfo (including anything it points to) and pAllocator must remain valid until vk_loaderWaitForPendingInstance has
+// returned, as they are read by the loader owned thread.
+typedef struct VkLoaderPendingInstance_T *VkLoaderPendingInstance;
+
+// Starts creating a VkInstance on a loader owned thread.
+// Returns VK_SUCCESS if the thread was started, in which case pPendingInstance must later be passed to
+// vk_loaderWaitForPendingInstance.
+typedef VkResult(VKAPI_PTR *PFN_vk_loaderCreateInstanceAsync)(const VkInstanceCreateInfo *pCreateInfo,
+                                                              const VkAllocationCallbacks *pAllocator,
+                                                              VkLoaderPendingInstance *pPendingInstance);
+
+// Returns VK_NOT_READY while instance creation is still in progress, otherwise the result vkCreateInstance returned.
+typedef VkResult(VKAPI_PTR *PFN_vk_loaderGetPendingInstanceStatus)(VkLoaderPendingInstance pendingInstance);
+
+// Blocks until instance creation completes, writes the created instance to pInstance and returns the result vkCreateInstance
+// returned. The loader owned thread is joined and the pending instance handle is freed, so every pending instance must be
+// passed to it exactly once, and must not be used afterwards.
+typedef VkResult(VKAPI_PTR *PFN_vk_loaderWaitForPendingInstance)(VkLoaderPendingInstance pendingInstance, VkInstance *pInstance);
+
+#ifndef VK_NO_PROTOTYPES
+VKAPI_ATTR VkResult VKAPI_CALL vk_loaderCreateInstanceAsync(const VkInstanceCreateInfo *pCreateInfo,
+                                                            const VkAllocationCallbacks *pAllocator,
+                                                            VkLoaderPendingInstance *pPendingInstance);
+
+VKAPI_ATTR VkResult VKAPI_CALL vk_loaderGetPendingInstanceStatus(VkLoaderPendingInstance pendingInstance);
+
+VKAPI_ATTR VkResult VKAPI_CALL vk_loaderWaitForPendingInstance(VkLoaderPendingInstance pendingInstance, VkInstance *pInstance);
+#endif  // VK_NO_PROTOTYPES
+
+#ifdef __cplusplus
+}
+#endif
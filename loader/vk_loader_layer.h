@@ -25,7 +25,7 @@
 #include <stdbool.h>
 #include <vulkan/vulkan.h>
 
-// Linked list node for tree of debug callbacks
+// Debug callbacks, see loader_debug_callbacks
 typedef struct VkDebugReportContent {
     VkDebugReportCallbackEXT msgCallback;
     PFN_vkDebugReportCallbackEXT pfnMsgCallback;
@@ -46,5 +46,16 @@ typedef struct VkLayerDbgFunctionNode_ {
         VkDebugUtilsMessengerContent messenger;
     };
     void *pUserData;
-    struct VkLayerDbgFunctionNode_ *pNext;
 } VkLayerDbgFunctionNode;
+
+// The debug callbacks of an instance are published as an immutable snapshot, so that they can be walked without taking a lock
+// while callbacks are being created and destroyed on other threads. A change makes a new snapshot and atomically swaps it in,
+// and the old snapshot is only freed once no thread is walking it.
+struct loader_debug_callbacks {
+    // How many threads are walking this snapshot
+    uint32_t readers;
+    uint32_t count;
+    VkLayerDbgFunctionNode *nodes;
+    // Chains together the snapshots which were swapped out but may still be walked
+    struct loader_debug_callbacks *retired_next;
+};
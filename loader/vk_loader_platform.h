@@ -51,6 +51,7 @@
 #include <pthread.h>
 #include <stdlib.h>
 #include <libgen.h>
+#include <time.h>
 
 #elif defined(_WIN32)  // defined(__linux__)
 /* Windows-specific common code: */
@@ -214,9 +215,10 @@ static inline bool loader_platform_is_path(const char *path) { return strchr(pat
 
 // The once init functionality is not used when building a DLL on Windows. This is because there is no way to clean up the
 // resources allocated by anything allocated by once init. This isn't a problem for static libraries, but it is for dynamic
-// ones. When building a DLL, we use DllMain() instead to allow properly cleaning up resources.
+// ones. When building a DLL, we use DllMain() instead to allow properly cleaning up resources. Static libraries on other
+// platforms use it as well, as the objects of the archive may be used before their constructors have run.
 
-#if defined(__APPLE__) && defined(BUILD_STATIC_LOADER)
+#if !defined(_WIN32) && defined(BUILD_STATIC_LOADER)
 static inline void loader_platform_thread_once_fn(pthread_once_t *ctl, void (*func)(void)) {
     assert(func != NULL);
     assert(ctl != NULL);
@@ -371,6 +373,44 @@ static inline void loader_platform_thread_lock_mutex(loader_platform_thread_mute
 static inline void loader_platform_thread_unlock_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_unlock(pMutex); }
 static inline void loader_platform_thread_delete_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_destroy(pMutex); }
 
+// Threads:
+#define LOADER_PLATFORM_THREAD_PROC(name, arg) void *name(void *arg)
+typedef void *(*loader_platform_thread_proc)(void *);
+static inline bool loader_platform_thread_create(loader_platform_thread *pThread, loader_platform_thread_proc func, void *arg) {
+    return pthread_create(pThread, NULL, func, arg) == 0;
+}
+static inline void loader_platform_thread_join(loader_platform_thread thread) { pthread_join(thread, NULL); }
+// Lets a thread which is never joined release its resources once it returns
+static inline void loader_platform_thread_detach(loader_platform_thread thread) { pthread_detach(thread); }
+static inline void loader_platform_sleep_us(uint64_t microseconds) {
+    struct timespec duration;
+    duration.tv_sec = (time_t)(microseconds / 1000000);
+    duration.tv_nsec = (long)(microseconds % 1000000) * 1000;
+    nanosleep(&duration, NULL);
+}
+
+// Atomics, all of which are sequentially consistent:
+static inline void *loader_platform_atomic_load_ptr(void *const volatile *ptr) { return __atomic_load_n(ptr, __ATOMIC_SEQ_CST); }
+static inline void loader_platform_atomic_store_ptr(void *volatile *ptr, void *value) {
+    __atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
+}
+static inline uint32_t loader_platform_atomic_load_u32(const volatile uint32_t *value) {
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+static inline uint32_t loader_platform_atomic_increment(volatile uint32_t *value) {
+    return __atomic_add_fetch(value, 1, __ATOMIC_SEQ_CST);
+}
+static inline uint32_t loader_platform_atomic_decrement(volatile uint32_t *value) {
+    return __atomic_sub_fetch(value, 1, __ATOMIC_SEQ_CST);
+}
+
+// Monotonic time in microseconds, used to time the loading of manifests and libraries
+static inline uint64_t loader_platform_get_time_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
 #elif defined(_WIN32)  // defined(__linux__)
 
 // Get the key for the plug n play driver registry
@@ -519,6 +559,46 @@ static void loader_platform_thread_lock_mutex(loader_platform_thread_mutex *pMut
 static void loader_platform_thread_unlock_mutex(loader_platform_thread_mutex *pMutex) { LeaveCriticalSection(pMutex); }
 static void loader_platform_thread_delete_mutex(loader_platform_thread_mutex *pMutex) { DeleteCriticalSection(pMutex); }
 
+// Threads:
+#define LOADER_PLATFORM_THREAD_PROC(name, arg) DWORD WINAPI name(LPVOID arg)
+typedef LPTHREAD_START_ROUTINE loader_platform_thread_proc;
+static bool loader_platform_thread_create(loader_platform_thread *pThread, loader_platform_thread_proc func, void *arg) {
+    *pThread = CreateThread(NULL, 0, func, arg, 0, NULL);
+    return *pThread != NULL;
+}
+static void loader_platform_thread_join(loader_platform_thread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+// Lets a thread which is never joined release its resources once it returns
+static void loader_platform_thread_detach(loader_platform_thread thread) { CloseHandle(thread); }
+// Sleep only has millisecond granularity, so the duration is rounded up
+static void loader_platform_sleep_us(uint64_t microseconds) { Sleep((DWORD)((microseconds + 999) / 1000)); }
+
+// Atomics, all of which are sequentially consistent:
+static void *loader_platform_atomic_load_ptr(void *const volatile *ptr) {
+    return InterlockedCompareExchangePointer((PVOID volatile *)ptr, NULL, NULL);
+}
+static void loader_platform_atomic_store_ptr(void *volatile *ptr, void *value) { InterlockedExchangePointer(ptr, value); }
+static uint32_t loader_platform_atomic_load_u32(const volatile uint32_t *value) {
+    return (uint32_t)InterlockedCompareExchange((volatile LONG *)value, 0, 0);
+}
+static uint32_t loader_platform_atomic_increment(volatile uint32_t *value) {
+    return (uint32_t)InterlockedIncrement((volatile LONG *)value);
+}
+static uint32_t loader_platform_atomic_decrement(volatile uint32_t *value) {
+    return (uint32_t)InterlockedDecrement((volatile LONG *)value);
+}
+
+// Monotonic time in microseconds, used to time the loading of manifests and libraries
+static uint64_t loader_platform_get_time_us(void) {
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000 +
+           (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+}
+
 #else  // defined(_WIN32)
 
 #error The "vk_loader_platform.h" file must be modified for this OS.
@@ -30,6 +30,7 @@
 
 #include "allocation.h"
 #include "loader.h"
+#include "loader_environment.h"
 #include "log.h"
 #include "vk_loader_platform.h"
 #include "wsi.h"
@@ -39,6 +40,12 @@
 #define ICD_VER_SUPPORTS_ICD_SURFACE_KHR 3
 
 void wsi_create_instance(struct loader_instance *loader_inst, const VkInstanceCreateInfo *pCreateInfo) {
+    char *env_value = loader_getenv("VK_LOADER_CACHE_SURFACE_QUERIES", loader_inst);
+    if (NULL != env_value && atoi(env_value) != 0) {
+        loader_inst->wsi_surface_query_cache_enabled = true;
+    }
+    loader_free_getenv(env_value, loader_inst);
+
     for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
         if (strcmp(pCreateInfo->ppEnabledExtensionNames[i], VK_KHR_SURFACE_EXTENSION_NAME) == 0) {
             loader_inst->wsi_surface_enabled = true;
@@ -166,6 +173,206 @@ bool wsi_unsupported_instance_extension(const VkExtensionProperties *ext_prop) {
     return false;
 }
 
+// With VK_LOADER_CACHE_SURFACE_QUERIES, the formats, present modes, and queue family support of a surface are only queried
+// from the driver once per physical device, and kept until the surface is destroyed. Capabilities are never cached since the
+// current extent changes whenever the window is resized.
+enum loader_surface_support {
+    LOADER_SURFACE_SUPPORT_UNKNOWN = 0,
+    LOADER_SURFACE_SUPPORT_UNSUPPORTED,
+    LOADER_SURFACE_SUPPORT_SUPPORTED,
+};
+
+struct loader_surface_query_cache {
+    struct loader_surface_query_cache *next;
+    struct loader_physical_device_term *phys_dev_term;
+    bool formats_cached;
+    uint32_t format_count;
+    VkSurfaceFormatKHR *formats;
+    bool present_modes_cached;
+    uint32_t present_mode_count;
+    VkPresentModeKHR *present_modes;
+    // Indexed by queue family index
+    uint32_t queue_family_count;
+    enum loader_surface_support *queue_family_support;
+};
+
+// Must be called with loader_surface_query_cache_lock held. Returns NULL when out of memory.
+static struct loader_surface_query_cache *wsi_get_surface_query_cache(struct loader_instance *inst, VkIcdSurface *icd_surface,
+                                                                      struct loader_physical_device_term *phys_dev_term) {
+    for (struct loader_surface_query_cache *cache = icd_surface->query_cache; NULL != cache; cache = cache->next) {
+        if (cache->phys_dev_term == phys_dev_term) {
+            return cache;
+        }
+    }
+    struct loader_surface_query_cache *cache =
+        loader_instance_heap_calloc(inst, sizeof(struct loader_surface_query_cache), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    if (NULL != cache) {
+        cache->phys_dev_term = phys_dev_term;
+        cache->next = icd_surface->query_cache;
+        icd_surface->query_cache = cache;
+    }
+    return cache;
+}
+
+static void wsi_free_surface_query_cache(struct loader_instance *inst, VkIcdSurface *icd_surface) {
+    loader_platform_thread_lock_mutex(&loader_surface_query_cache_lock);
+    struct loader_surface_query_cache *cache = icd_surface->query_cache;
+    while (NULL != cache) {
+        struct loader_surface_query_cache *next = cache->next;
+        loader_instance_heap_free(inst, cache->formats);
+        loader_instance_heap_free(inst, cache->present_modes);
+        loader_instance_heap_free(inst, cache->queue_family_support);
+        loader_instance_heap_free(inst, cache);
+        cache = next;
+    }
+    icd_surface->query_cache = NULL;
+    loader_platform_thread_unlock_mutex(&loader_surface_query_cache_lock);
+}
+
+// Returns the cached elements the same way a driver would, including VK_INCOMPLETE if pElements is too small
+static VkResult wsi_copy_cached_elements(const void *elements, uint32_t element_count, size_t element_size, uint32_t *pCount,
+                                         void *pElements) {
+    if (NULL == pElements) {
+        *pCount = element_count;
+        return VK_SUCCESS;
+    }
+    uint32_t copy_count = *pCount < element_count ? *pCount : element_count;
+    if (copy_count > 0) {
+        memcpy(pElements, elements, copy_count * element_size);
+    }
+    *pCount = copy_count;
+    return copy_count < element_count ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+static VkResult wsi_get_cached_surface_support(struct loader_instance *inst, struct loader_physical_device_term *phys_dev_term,
+                                               VkIcdSurface *icd_surface, VkSurfaceKHR driver_surface, uint32_t queueFamilyIndex,
+                                               VkBool32 *pSupported) {
+    struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
+    VkResult res = VK_SUCCESS;
+    loader_platform_thread_lock_mutex(&loader_surface_query_cache_lock);
+    struct loader_surface_query_cache *cache = wsi_get_surface_query_cache(inst, icd_surface, phys_dev_term);
+    if (NULL == cache) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    if (queueFamilyIndex >= cache->queue_family_count) {
+        uint32_t new_count = queueFamilyIndex + 1;
+        enum loader_surface_support *new_support = loader_instance_heap_realloc(
+            inst, cache->queue_family_support, cache->queue_family_count * sizeof(enum loader_surface_support),
+            new_count * sizeof(enum loader_surface_support), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+        if (NULL == new_support) {
+            res = VK_ERROR_OUT_OF_HOST_MEMORY;
+            goto out;
+        }
+        for (uint32_t i = cache->queue_family_count; i < new_count; i++) {
+            new_support[i] = LOADER_SURFACE_SUPPORT_UNKNOWN;
+        }
+        cache->queue_family_support = new_support;
+        cache->queue_family_count = new_count;
+    }
+    if (LOADER_SURFACE_SUPPORT_UNKNOWN == cache->queue_family_support[queueFamilyIndex]) {
+        VkBool32 supported = VK_FALSE;
+        res = icd_term->dispatch.GetPhysicalDeviceSurfaceSupportKHR(phys_dev_term->phys_dev, queueFamilyIndex, driver_surface,
+                                                                    &supported);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        cache->queue_family_support[queueFamilyIndex] =
+            supported ? LOADER_SURFACE_SUPPORT_SUPPORTED : LOADER_SURFACE_SUPPORT_UNSUPPORTED;
+    }
+    *pSupported = LOADER_SURFACE_SUPPORT_SUPPORTED == cache->queue_family_support[queueFamilyIndex];
+out:
+    loader_platform_thread_unlock_mutex(&loader_surface_query_cache_lock);
+    return res;
+}
+
+static VkResult wsi_get_cached_surface_formats(struct loader_instance *inst, struct loader_physical_device_term *phys_dev_term,
+                                               VkIcdSurface *icd_surface, VkSurfaceKHR driver_surface,
+                                               uint32_t *pSurfaceFormatCount, VkSurfaceFormatKHR *pSurfaceFormats) {
+    struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
+    VkResult res = VK_SUCCESS;
+    loader_platform_thread_lock_mutex(&loader_surface_query_cache_lock);
+    struct loader_surface_query_cache *cache = wsi_get_surface_query_cache(inst, icd_surface, phys_dev_term);
+    if (NULL == cache) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    if (!cache->formats_cached) {
+        uint32_t count = 0;
+        VkSurfaceFormatKHR *formats = NULL;
+        res = icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(phys_dev_term->phys_dev, driver_surface, &count, NULL);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        if (count > 0) {
+            formats = loader_instance_heap_alloc(inst, count * sizeof(VkSurfaceFormatKHR), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+            if (NULL == formats) {
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
+            }
+            // VK_INCOMPLETE means the formats changed between the two calls, so the result isn't worth keeping
+            res = icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(phys_dev_term->phys_dev, driver_surface, &count, formats);
+            if (VK_SUCCESS != res) {
+                loader_instance_heap_free(inst, formats);
+                goto out;
+            }
+        }
+        cache->formats_cached = true;
+        cache->format_count = count;
+        cache->formats = formats;
+    }
+    res = wsi_copy_cached_elements(cache->formats, cache->format_count, sizeof(VkSurfaceFormatKHR), pSurfaceFormatCount,
+                                   pSurfaceFormats);
+out:
+    loader_platform_thread_unlock_mutex(&loader_surface_query_cache_lock);
+    return res;
+}
+
+static VkResult wsi_get_cached_surface_present_modes(struct loader_instance *inst,
+                                                     struct loader_physical_device_term *phys_dev_term, VkIcdSurface *icd_surface,
+                                                     VkSurfaceKHR driver_surface, uint32_t *pPresentModeCount,
+                                                     VkPresentModeKHR *pPresentModes) {
+    struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
+    VkResult res = VK_SUCCESS;
+    loader_platform_thread_lock_mutex(&loader_surface_query_cache_lock);
+    struct loader_surface_query_cache *cache = wsi_get_surface_query_cache(inst, icd_surface, phys_dev_term);
+    if (NULL == cache) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    if (!cache->present_modes_cached) {
+        uint32_t count = 0;
+        VkPresentModeKHR *present_modes = NULL;
+        res = icd_term->dispatch.GetPhysicalDeviceSurfacePresentModesKHR(phys_dev_term->phys_dev, driver_surface, &count, NULL);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        if (count > 0) {
+            present_modes =
+                loader_instance_heap_alloc(inst, count * sizeof(VkPresentModeKHR), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+            if (NULL == present_modes) {
+                res = VK_ERROR_OUT_OF_HOST_MEMORY;
+                goto out;
+            }
+            // VK_INCOMPLETE means the present modes changed between the two calls, so the result isn't worth keeping
+            res = icd_term->dispatch.GetPhysicalDeviceSurfacePresentModesKHR(phys_dev_term->phys_dev, driver_surface, &count,
+                                                                             present_modes);
+            if (VK_SUCCESS != res) {
+                loader_instance_heap_free(inst, present_modes);
+                goto out;
+            }
+        }
+        cache->present_modes_cached = true;
+        cache->present_mode_count = count;
+        cache->present_modes = present_modes;
+    }
+    res = wsi_copy_cached_elements(cache->present_modes, cache->present_mode_count, sizeof(VkPresentModeKHR), pPresentModeCount,
+                                   pPresentModes);
+out:
+    loader_platform_thread_unlock_mutex(&loader_surface_query_cache_lock);
+    return res;
+}
+
 // Functions for the VK_KHR_surface extension:
 
 // This is the trampoline entrypoint for DestroySurfaceKHR
@@ -208,6 +415,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroySurfaceKHR(VkInstance instance, VkS
             loader_instance_heap_free(loader_inst, icd_surface->real_icd_surfaces);
         }
 
+        wsi_free_surface_query_cache(loader_inst, icd_surface);
         loader_instance_heap_free(loader_inst, (void *)(uintptr_t)surface);
     }
 }
@@ -259,13 +467,18 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceSupportKHR(VkP
     }
 
     VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
+    VkSurfaceKHR driver_surface = surface;
     if (NULL != icd_surface->real_icd_surfaces &&
         (VkSurfaceKHR)(uintptr_t)NULL != icd_surface->real_icd_surfaces[phys_dev_term->icd_index]) {
-        return icd_term->dispatch.GetPhysicalDeviceSurfaceSupportKHR(
-            phys_dev_term->phys_dev, queueFamilyIndex, icd_surface->real_icd_surfaces[phys_dev_term->icd_index], pSupported);
+        driver_surface = icd_surface->real_icd_surfaces[phys_dev_term->icd_index];
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceSurfaceSupportKHR(phys_dev_term->phys_dev, queueFamilyIndex, surface, pSupported);
+    if (loader_inst->wsi_surface_query_cache_enabled) {
+        return wsi_get_cached_surface_support(loader_inst, phys_dev_term, icd_surface, driver_surface, queueFamilyIndex,
+                                              pSupported);
+    }
+    return icd_term->dispatch.GetPhysicalDeviceSurfaceSupportKHR(phys_dev_term->phys_dev, queueFamilyIndex, driver_surface,
+                                                                 pSupported);
 }
 
 // This is the trampoline entrypoint for GetPhysicalDeviceSurfaceCapabilitiesKHR
@@ -369,14 +582,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceFormatsKHR(VkP
     }
 
     VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
+    VkSurfaceKHR driver_surface = surface;
     if (NULL != icd_surface->real_icd_surfaces &&
         (VkSurfaceKHR)(uintptr_t)NULL != icd_surface->real_icd_surfaces[phys_dev_term->icd_index]) {
-        return icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(phys_dev_term->phys_dev,
-                                                                     icd_surface->real_icd_surfaces[phys_dev_term->icd_index],
-                                                                     pSurfaceFormatCount, pSurfaceFormats);
+        driver_surface = icd_surface->real_icd_surfaces[phys_dev_term->icd_index];
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(phys_dev_term->phys_dev, surface, pSurfaceFormatCount,
+    if (loader_inst->wsi_surface_query_cache_enabled) {
+        return wsi_get_cached_surface_formats(loader_inst, phys_dev_term, icd_surface, driver_surface, pSurfaceFormatCount,
+                                              pSurfaceFormats);
+    }
+    return icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(phys_dev_term->phys_dev, driver_surface, pSurfaceFormatCount,
                                                                  pSurfaceFormats);
 }
 
@@ -427,13 +643,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfacePresentModesKH
     }
 
     VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
+    VkSurfaceKHR driver_surface = surface;
     if (NULL != icd_surface->real_icd_surfaces &&
         (VkSurfaceKHR)(uintptr_t)NULL != icd_surface->real_icd_surfaces[phys_dev_term->icd_index]) {
-        return icd_term->dispatch.GetPhysicalDeviceSurfacePresentModesKHR(
-            phys_dev_term->phys_dev, icd_surface->real_icd_surfaces[phys_dev_term->icd_index], pPresentModeCount, pPresentModes);
+        driver_surface = icd_surface->real_icd_surfaces[phys_dev_term->icd_index];
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceSurfacePresentModesKHR(phys_dev_term->phys_dev, surface, pPresentModeCount,
+    if (loader_inst->wsi_surface_query_cache_enabled) {
+        return wsi_get_cached_surface_present_modes(loader_inst, phys_dev_term, icd_surface, driver_surface, pPresentModeCount,
+                                                    pPresentModes);
+    }
+    return icd_term->dispatch.GetPhysicalDeviceSurfacePresentModesKHR(phys_dev_term->phys_dev, driver_surface, pPresentModeCount,
                                                                       pPresentModes);
 }
 
@@ -551,6 +771,12 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(VkQueue queue, co
 }
 
 static VkIcdSurface *AllocateIcdSurfaceStruct(struct loader_instance *instance, size_t base_size, size_t platform_size) {
+    // The surface is created in every driver, so any driver instance which was deferred must exist first. This only fails when
+    // out of memory.
+    if (VK_SUCCESS != loader_create_deferred_icd_instances(instance)) {
+        return NULL;
+    }
+
     // Next, if so, proceed with the implementation of this function:
     VkIcdSurface *pIcdSurface = loader_instance_heap_alloc(instance, sizeof(VkIcdSurface), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
     if (pIcdSurface != NULL) {
@@ -560,6 +786,7 @@ static VkIcdSurface *AllocateIcdSurfaceStruct(struct loader_instance *instance,
         pIcdSurface->platform_size = (uint32_t)platform_size;
         pIcdSurface->non_platform_offset = (uint32_t)((uint8_t *)(&pIcdSurface->base_size) - (uint8_t *)pIcdSurface);
         pIcdSurface->entire_size = sizeof(VkIcdSurface);
+        pIcdSurface->query_cache = NULL;
 
         pIcdSurface->real_icd_surfaces = loader_instance_heap_calloc(instance, sizeof(VkSurfaceKHR) * instance->total_icd_count,
                                                                      VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
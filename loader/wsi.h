@@ -24,6 +24,8 @@
 
 #include "loader_common.h"
 
+struct loader_surface_query_cache;
+
 typedef struct {
     union {
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
@@ -67,6 +69,8 @@ typedef struct {
     uint32_t non_platform_offset;  // Start offset to base_size
     uint32_t entire_size;          // Size of entire VkIcdSurface
     VkSurfaceKHR *real_icd_surfaces;
+    // Results of the presentation queries of each physical device, only used with VK_LOADER_CACHE_SURFACE_QUERIES
+    struct loader_surface_query_cache *query_cache;
 } VkIcdSurface;
 
 bool wsi_swapchain_instance_gpa(struct loader_instance *ptr_instance, const char *name, void **addr);
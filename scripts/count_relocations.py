@@ -0,0 +1,64 @@
+#!/usr/bin/python3 -i
+#
+# Copyright (c) 2022 The Khronos Group Inc.
+# Copyright (c) 2022 LunarG, Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# This script reports the number of dynamic relocations in the .rela.dyn section of an ELF shared library, which is
+# the work ld.so has to do (and the pages it has to dirty) when loading it. Every pointer stored in initialized data,
+# such as a table of strings or of function pointers, becomes one of these relocations.
+#
+# Usage: count_relocations.py <readelf> <library> [max relocations]
+# If a maximum is given, the script fails when the library has more .rela.dyn entries than that.
+
+import re
+import subprocess
+import sys
+from collections import Counter
+
+if len(sys.argv) < 3:
+    print('Usage: count_relocations.py <readelf> <library> [max relocations]')
+    sys.exit(1)
+
+readelf = sys.argv[1]
+library = sys.argv[2]
+max_relocations = int(sys.argv[3]) if len(sys.argv) > 3 else None
+
+output = subprocess.run([readelf, '--wide', '--relocs', library], check=True, capture_output=True, text=True).stdout
+
+# readelf prints a header for each relocation section followed by one line per entry, the type being the third column
+section_header = re.compile(r"^Relocation section '(?P<name>[^']+)' at offset \S+ contains (?P<count>\d+) entr")
+entry_count = None
+types = Counter()
+in_rela_dyn = False
+for line in output.splitlines():
+    header = section_header.match(line)
+    if header is not None:
+        in_rela_dyn = header.group('name') == '.rela.dyn'
+        if in_rela_dyn:
+            entry_count = int(header.group('count'))
+        continue
+    columns = line.split()
+    if in_rela_dyn and len(columns) >= 3 and re.match(r'^[0-9a-fA-F]+$', columns[0]):
+        types[columns[2]] += 1
+
+if entry_count is None:
+    entry_count = 0
+print(f'{library}: {entry_count} .rela.dyn entries')
+for relocation_type, count in types.most_common():
+    print(f'    {relocation_type}: {count}')
+
+if max_relocations is not None and entry_count > max_relocations:
+    print(f'Error: {entry_count} .rela.dyn entries is more than the maximum of {max_relocations}')
+    sys.exit(1)
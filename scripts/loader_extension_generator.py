@@ -254,7 +254,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
             file_data += self.InstantExtensionCreate()
             file_data += self.DeviceExtensionGetTerminator()
             file_data += self.InitInstLoaderExtensionDispatchTable()
-            file_data += self.OutputInstantExtensionWhitelistArray()
+            file_data += self.OutputInstanceExtensionHashSet()
 
         elif self.genOpts.filename == 'vk_layer_dispatch_table.h':
             file_data += self.OutputLayerInstanceDispatchTable()
@@ -448,12 +448,12 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         protos += '// a terminator.\n'
         protos += 'PFN_vkVoidFunction get_extension_device_proc_terminator(struct loader_device *dev, const char *name, bool* found_name);\n'
         protos += '\n'
-        protos += '// Dispatch table properly filled in with appropriate terminators for the\n'
+        protos += '// Fill in a dispatch table with the appropriate terminators for the\n'
         protos += '// supported extensions.\n'
-        protos += 'extern const VkLayerInstanceDispatchTable instance_disp;\n'
+        protos += 'void loader_init_instance_terminator_dispatch(VkLayerInstanceDispatchTable *table);\n'
         protos += '\n'
-        protos += '// Array of extension strings for instance extensions we support.\n'
-        protos += 'extern const char *const LOADER_INSTANCE_EXTENSIONS[];\n'
+        protos += '// Returns true if name is one of the instance extensions supported by the loader.\n'
+        protos += 'bool loader_is_known_instance_extension(const char *name);\n'
         protos += '\n'
         protos += 'VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_icd_term *icd_term, VkInstance inst,\n'
         protos += '                                                   const PFN_vkGetInstanceProcAddr fp_gipa);\n'
@@ -856,23 +856,97 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
     # Create a lookup table function from the appropriate list of entrypoints and
     # return it as a string
     def OutputLoaderLookupFunc(self):
-        commands = []
         tables = ''
-        cur_type = ''
-        cur_extension_name = ''
 
-        for x in range(0, 2):
-            if x == 0:
-                cur_type = 'device'
+        # Each table is a string of the command names without their 'vk' prefix and an array of the offsets of each name in
+        # that string and of its member in the dispatch table, sorted by name so that it can be binary searched. Offsets
+        # rather than pointers keep both out of the dynamic relocations. Every name is in the string regardless of platform,
+        # only the array entries are guarded by the platform defines.
+        tables += '// The offsets of a command name in the names of a dispatch table, and of its member in the dispatch table\n'
+        tables += 'struct loader_dispatch_table_entry {\n'
+        tables += '    uint16_t name_offset;\n'
+        tables += '    uint16_t table_offset;\n'
+        tables += '};\n'
+        tables += '\n'
+        tables += '// Binary searches entries, which are sorted by name, for name. Returns whether it was found, and the function pointer\n'
+        tables += '// stored in table for it in *function.\n'
+        tables += 'static bool loader_lookup_dispatch_table(const void *table, const char *names, const struct loader_dispatch_table_entry *entries,\n'
+        tables += '                                         size_t entry_count, const char *name, void **function) {\n'
+        tables += '    size_t low = 0;\n'
+        tables += '    size_t high = entry_count;\n'
+        tables += '    while (low < high) {\n'
+        tables += '        size_t middle = low + (high - low) / 2;\n'
+        tables += '        int comparison = strcmp(name, &names[entries[middle].name_offset]);\n'
+        tables += '        if (0 == comparison) {\n'
+        tables += '            PFN_vkVoidFunction entry;\n'
+        tables += '            memcpy(&entry, (const char *)table + entries[middle].table_offset, sizeof(entry));\n'
+        tables += '            *function = (void *)entry;\n'
+        tables += '            return true;\n'
+        tables += '        }\n'
+        tables += '        if (comparison < 0) {\n'
+        tables += '            high = middle;\n'
+        tables += '        } else {\n'
+        tables += '            low = middle + 1;\n'
+        tables += '        }\n'
+        tables += '    }\n'
+        tables += '    *function = NULL;\n'
+        tables += '    return false;\n'
+        tables += '}\n'
+        tables += '\n'
+
+        for cur_type in ['device', 'instance']:
+            table_type = 'VkLayerDispatchTable' if cur_type == 'device' else 'VkLayerInstanceDispatchTable'
+
+            entries = []
+            for cur_cmd in self.core_commands + self.ext_commands:
+                is_inst_handle_type = cur_cmd.handle_type == 'VkInstance' or cur_cmd.handle_type == 'VkPhysicalDevice'
+                if ((cur_type == 'instance' and is_inst_handle_type) or (cur_type == 'device' and not is_inst_handle_type)):
+                    # Remove 'vk' from proto name
+                    base_name = cur_cmd.name[2:]
+
+                    if (base_name == 'CreateInstance' or base_name == 'CreateDevice' or
+                        base_name == 'EnumerateInstanceExtensionProperties' or
+                        base_name == 'EnumerateInstanceLayerProperties' or
+                        base_name == 'EnumerateInstanceVersion'):
+                        continue
+
+                    entries.append((base_name, cur_cmd.protect))
+            entries.sort(key=lambda entry: entry[0].encode())
 
+            offsets = {}
+            offset = 0
+            for base_name, protect in entries:
+                offsets[base_name] = offset
+                offset += len(base_name) + 1
+
+            tables += '// Names of the %s commands in %s, without their "vk" prefix\n' % (cur_type, table_type)
+            tables += 'static const char loader_%s_dispatch_table_names[] =\n' % cur_type
+            for base_name, protect in entries:
+                tables += '    "%s\\0"\n' % base_name
+            tables += '    ;\n'
+            tables += '\n'
+            tables += 'static const struct loader_dispatch_table_entry loader_%s_dispatch_table_entries[] = {\n' % cur_type
+            for base_name, protect in entries:
+                if protect is not None:
+                    tables += '#ifdef %s\n' % protect
+                tables += '    {%d, offsetof(%s, %s)},\n' % (offsets[base_name], table_type, base_name)
+                if protect is not None:
+                    tables += '#endif // %s\n' % protect
+            tables += '};\n'
+            tables += '\n'
+
+            if cur_type == 'device':
                 tables += '// Device command lookup function\n'
                 tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {\n'
                 tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
                 tables += '\n'
-                tables += '    name += 2;\n'
+                tables += '    void *function;\n'
+                tables += '    loader_lookup_dispatch_table(table, loader_device_dispatch_table_names, loader_device_dispatch_table_entries,\n'
+                tables += '                                 sizeof(loader_device_dispatch_table_entries) / sizeof(loader_device_dispatch_table_entries[0]),\n'
+                tables += '                                 name + 2, &function);\n'
+                tables += '    return function;\n'
+                tables += '}\n\n'
             else:
-                cur_type = 'instance'
-
                 tables += '// Instance command lookup function\n'
                 tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
                 tables += '                                                                 bool *found_name) {\n'
@@ -881,48 +955,12 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                 tables += '        return NULL;\n'
                 tables += '    }\n'
                 tables += '\n'
-                tables += '    *found_name = true;\n'
-                tables += '    name += 2;\n'
-
-            for y in range(0, 2):
-                if y == 0:
-                    commands = self.core_commands
-                else:
-                    commands = self.ext_commands
-
-                for cur_cmd in commands:
-                    is_inst_handle_type = cur_cmd.handle_type == 'VkInstance' or cur_cmd.handle_type == 'VkPhysicalDevice'
-                    if ((cur_type == 'instance' and is_inst_handle_type) or (cur_type == 'device' and not is_inst_handle_type)):
-
-                        if cur_cmd.ext_name != cur_extension_name:
-                            if 'VK_VERSION_' in cur_cmd.ext_name:
-                                tables += '\n    // ---- Core %s commands\n' % cur_cmd.ext_name[11:]
-                            else:
-                                tables += '\n    // ---- %s extension commands\n' % cur_cmd.ext_name
-                            cur_extension_name = cur_cmd.ext_name
-
-                        # Remove 'vk' from proto name
-                        base_name = cur_cmd.name[2:]
-
-                        if (base_name == 'CreateInstance' or base_name == 'CreateDevice' or
-                            base_name == 'EnumerateInstanceExtensionProperties' or
-                            base_name == 'EnumerateInstanceLayerProperties' or
-                            base_name == 'EnumerateInstanceVersion'):
-                            continue
-
-                        if cur_cmd.protect is not None:
-                            tables += '#ifdef %s\n' % cur_cmd.protect
-
-                        tables += '    if (!strcmp(name, "%s")) return (void *)table->%s;\n' % (base_name, base_name)
-
-                        if cur_cmd.protect is not None:
-                            tables += '#endif // %s\n' % cur_cmd.protect
-
-            tables += '\n'
-            if x == 1:
-                tables += '    *found_name = false;\n'
-            tables += '    return NULL;\n'
-            tables += '}\n\n'
+                tables += '    void *function;\n'
+                tables += '    *found_name = loader_lookup_dispatch_table(table, loader_instance_dispatch_table_names, loader_instance_dispatch_table_entries,\n'
+                tables += '                                               sizeof(loader_instance_dispatch_table_entries) / sizeof(loader_instance_dispatch_table_entries[0]),\n'
+                tables += '                                               name + 2, &function);\n'
+                tables += '    return function;\n'
+                tables += '}\n\n'
         return tables
 
     #
@@ -1543,10 +1581,13 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         table = ''
         cur_extension_name = ''
 
-        table += '// This table contains the loader\'s instance dispatch table, which contains\n'
+        table += '// Fills in the loader\'s instance dispatch table, which contains\n'
         table += '// default functions if no instance layers are activated.  This contains\n'
-        table += '// pointers to "terminator functions".\n'
-        table += 'const VkLayerInstanceDispatchTable instance_disp = {\n'
+        table += '// pointers to "terminator functions". The table is filled in at runtime instead of\n'
+        table += '// being copied from a static initializer so that none of the pointers need a\n'
+        table += '// dynamic relocation when the loader is loaded.\n'
+        table += 'void loader_init_instance_terminator_dispatch(VkLayerInstanceDispatchTable *table) {\n'
+        table += '    memset(table, 0, sizeof(*table));\n'
 
         for x in range(0, 2):
             if x == 0:
@@ -1578,38 +1619,81 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                         table += '#ifdef %s\n' % cur_cmd.protect
 
                     if base_name == 'GetInstanceProcAddr':
-                        table += '    .%s = %s,\n' % (base_name, cur_cmd.name)
+                        table += '    table->%s = %s;\n' % (base_name, cur_cmd.name)
                     else:
-                        table += '    .%s = terminator_%s,\n' % (base_name, aliased_name)
+                        table += '    table->%s = terminator_%s;\n' % (base_name, aliased_name)
 
                     if cur_cmd.protect is not None:
                         table += '#endif // %s\n' % cur_cmd.protect
-        table += '};\n\n'
+        table += '}\n\n'
 
         return table
 
     #
-    # Create the extension name whitelist array
-    def OutputInstantExtensionWhitelistArray(self):
-        extensions = self.instanceExtensions
+    # Create a perfect hash set of the instance extension names. Every extension in the whitelist (including ones
+    # guarded by a platform define) is given its own slot, so a lookup is one hash and at most one strcmp.
+    def OutputInstanceExtensionHashSet(self):
+        extensions = [ext for ext in self.instanceExtensions if ext.type != 'device' and 'VK_VERSION_' not in ext.name]
+
+        # 32 bit FNV-1a with the offset basis perturbed by seed, with the high bits folded down since the low bits of
+        # FNV-1a only depend on the low bits of the input. Must match loader_is_known_instance_extension.
+        def extension_hash(name, seed):
+            hash = (2166136261 ^ seed) & 0xFFFFFFFF
+            for c in name.encode():
+                hash ^= c
+                hash = (hash * 16777619) & 0xFFFFFFFF
+            return hash ^ (hash >> 16)
+
+        table_size = 1
+        while table_size < 2 * len(extensions):
+            table_size *= 2
+        mask = table_size - 1
+        seed = 0
+        while len(set(extension_hash(ext.name, seed) & mask for ext in extensions)) != len(extensions):
+            seed += 1
+        slots = {ext.name: extension_hash(ext.name, seed) & mask for ext in extensions}
+
+        # The names are stored back to back in one string and the hash set holds offsets into it rather than pointers, so
+        # neither array needs a dynamic relocation. Every name is in the pool regardless of platform, only the hash set
+        # entries are guarded by the platform defines.
+        offsets = {}
+        offset = 0
+        for ext in extensions:
+            offsets[ext.name] = offset
+            offset += len(ext.name) + 1
 
         table = ''
-        table += '// A null-terminated list of all of the instance extensions supported by the loader.\n'
+        table += '// All of the instance extensions supported by the loader, as one string of null-terminated names.\n'
         table += '// If an instance extension name is not in this list, but it is exported by one or more of the\n'
         table += '// ICDs detected by the loader, then the extension name not in the list will be filtered out\n'
         table += '// before passing the list of extensions to the application.\n'
-        table += 'const char *const LOADER_INSTANCE_EXTENSIONS[] = {\n'
+        table += 'static const char loader_instance_extension_names[] =\n'
         for ext in extensions:
-            if ext.type == 'device' or 'VK_VERSION_' in ext.name:
-                continue
-
+            table += '    "%s\\0"\n' % ext.name
+        table += '    ;\n'
+        table += '\n'
+        table += '// Perfect hash set of the supported instance extensions, indexed by the seeded FNV-1a hash of the extension name.\n'
+        table += '// Each slot holds one plus the offset of the name in loader_instance_extension_names, or zero if the slot is empty.\n'
+        table += '#define LOADER_INSTANCE_EXTENSION_HASH_SEED %du\n' % seed
+        table += '#define LOADER_INSTANCE_EXTENSION_HASH_MASK %du\n' % mask
+        table += 'static const uint16_t loader_instance_extension_hash_set[%d] = {\n' % table_size
+        for ext in sorted(extensions, key=lambda ext: slots[ext.name]):
             if ext.protect is not None:
                 table += '#ifdef %s\n' % ext.protect
-            table += '                                                  '
-            table += ext.define + ',\n'
-
+            table += '    [%d] = %d, // %s\n' % (slots[ext.name], offsets[ext.name] + 1, ext.name)
             if ext.protect is not None:
                 table += '#endif // %s\n' % ext.protect
-        table += '                                                  NULL };\n'
+        table += '};\n'
+        table += '\n'
+        table += 'bool loader_is_known_instance_extension(const char *name) {\n'
+        table += '    uint32_t hash = 2166136261u ^ LOADER_INSTANCE_EXTENSION_HASH_SEED;\n'
+        table += '    for (const char *c = name; *c != \'\\0\'; ++c) {\n'
+        table += '        hash ^= (uint8_t)*c;\n'
+        table += '        hash *= 16777619u;\n'
+        table += '    }\n'
+        table += '    hash ^= hash >> 16;\n'
+        table += '    uint16_t slot = loader_instance_extension_hash_set[hash & LOADER_INSTANCE_EXTENSION_HASH_MASK];\n'
+        table += '    return 0 != slot && 0 == strcmp(name, &loader_instance_extension_names[slot - 1]);\n'
+        table += '}\n'
         return table
 
@@ -0,0 +1,63 @@
+#!/usr/bin/python3 -i
+#
+# Copyright (c) 2022 The Khronos Group Inc.
+# Copyright (c) 2022 LunarG, Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# This script reports the file size of an ELF shared library along with the size of the sections which hold its code and
+# data. When a second library is given, such as a loader built without LOADER_HEADLESS_PROFILE, the difference between
+# the two is reported as well.
+#
+# Usage: report_binary_size.py <readelf> <library> [baseline library]
+
+import os
+import re
+import subprocess
+import sys
+
+SECTIONS = ['.text', '.rodata', '.data.rel.ro', '.data', '.bss']
+
+if len(sys.argv) < 3:
+    print('Usage: report_binary_size.py <readelf> <library> [baseline library]')
+    sys.exit(1)
+
+readelf = sys.argv[1]
+library = sys.argv[2]
+baseline = sys.argv[3] if len(sys.argv) > 3 and len(sys.argv[3]) > 0 else None
+
+
+def get_sizes(path):
+    output = subprocess.run([readelf, '--wide', '--section-headers', path], check=True, capture_output=True, text=True).stdout
+    # Each section is printed as "[Nr] Name Type Address Off Size ...", with the sizes in hex
+    section_line = re.compile(r'^\s*\[\s*\d+\]\s+(?P<name>\S+)\s+\S+\s+[0-9a-fA-F]+\s+[0-9a-fA-F]+\s+(?P<size>[0-9a-fA-F]+)')
+    sizes = {'file': os.path.getsize(path)}
+    for line in output.splitlines():
+        match = section_line.match(line)
+        if match is not None and match.group('name') in SECTIONS:
+            sizes[match.group('name')] = int(match.group('size'), 16)
+    return sizes
+
+
+sizes = get_sizes(library)
+baseline_sizes = get_sizes(baseline) if baseline is not None else None
+
+print(f'{library}:' if baseline is None else f'{library} compared to {baseline}:')
+for name in ['file'] + SECTIONS:
+    if name not in sizes:
+        continue
+    line = f'    {name}: {sizes[name]} bytes'
+    if baseline_sizes is not None and name in baseline_sizes:
+        difference = sizes[name] - baseline_sizes[name]
+        line += f' ({difference:+d} bytes from {baseline_sizes[name]})'
+    print(line)
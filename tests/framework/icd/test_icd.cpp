@@ -56,6 +56,25 @@ FRAMEWORK_EXPORT TestICD* reset_icd_func() {
 }
 }
 
+// Simulates a driver which is slow to load by sleeping while its library is being opened. Constructors only run when a library
+// is first opened, so this only applies to a copy of the driver which the test framework hasn't opened itself.
+struct ConstructorLatency {
+    ConstructorLatency() {
+        std::string latency_ms = get_env_var("VK_TEST_ICD_CONSTRUCTOR_LATENCY_MS", false);
+        if (!latency_ms.empty()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(std::stoi(latency_ms)));
+        }
+    }
+} constructor_latency;
+
+// Counts a call to an entry point and applies the artificial latency configured for it
+void simulate_entry_point_call(std::atomic<uint32_t>& call_count, std::chrono::microseconds latency) {
+    call_count++;
+    if (latency.count() > 0) {
+        std::this_thread::sleep_for(latency);
+    }
+}
+
 LayerDefinition& FindLayer(std::vector<LayerDefinition>& layers, std::string layerName) {
     for (auto& layer : layers) {
         if (layer.layerName == layerName) return layer;
@@ -174,6 +193,8 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkEnumerateInstanceVersion(uint32_t* pApiVer
 
 VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) {
+    simulate_entry_point_call(icd.create_instance_call_count, icd.create_instance_latency);
+
     if (pCreateInfo == nullptr || pCreateInfo->pApplicationInfo == nullptr) {
         return VK_ERROR_OUT_OF_HOST_MEMORY;
     }
@@ -204,6 +225,7 @@ VKAPI_ATTR void VKAPI_CALL test_vkDestroyInstance(VkInstance instance, const VkA
 // VK_SUCCESS,VK_INCOMPLETE
 VKAPI_ATTR VkResult VKAPI_CALL test_vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount,
                                                                VkPhysicalDevice* pPhysicalDevices) {
+    simulate_entry_point_call(icd.enumerate_physical_devices_call_count, icd.enumerate_physical_devices_latency);
     if (pPhysicalDevices == nullptr) {
         *pPhysicalDeviceCount = static_cast<uint32_t>(icd.physical_devices.size());
     } else {
@@ -383,6 +405,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateDevice(VkPhysicalDevice physicalDevi
         return phys_dev.vk_physical_device.handle == physicalDevice;
     });
     if (found == icd.physical_devices.end()) return VK_ERROR_INITIALIZATION_FAILED;
+    std::lock_guard<std::mutex> lock(icd.device_mutex);
     auto device_handle = DispatchableHandle<VkDevice>();
     *pDevice = device_handle.handle;
     found->device_handles.push_back(device_handle.handle);
@@ -396,6 +419,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateDevice(VkPhysicalDevice physicalDevi
 }
 
 VKAPI_ATTR void VKAPI_CALL test_vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
+    std::lock_guard<std::mutex> lock(icd.device_mutex);
     auto found = std::find(icd.device_handles.begin(), icd.device_handles.end(), device);
     if (found != icd.device_handles.end()) icd.device_handles.erase(found);
     auto fd = icd.lookup_device(device);
@@ -655,6 +679,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkGetDeviceGroupSurfacePresentModesKHR(VkDev
 // VK_KHR_surface
 VKAPI_ATTR VkResult VKAPI_CALL test_vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex,
                                                                          VkSurfaceKHR surface, VkBool32* pSupported) {
+    icd.get_physical_device_surface_support_call_count++;
     if (surface != VK_NULL_HANDLE) {
         uint64_t fake_surf_handle = (uint64_t)(surface);
         auto found_iter = std::find(icd.surface_handles.begin(), icd.surface_handles.end(), fake_surf_handle);
@@ -670,6 +695,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysi
 }
 VKAPI_ATTR VkResult VKAPI_CALL test_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface,
                                                                               VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) {
+    icd.get_physical_device_surface_capabilities_call_count++;
     if (surface != VK_NULL_HANDLE) {
         uint64_t fake_surf_handle = (uint64_t)(surface);
         auto found_iter = std::find(icd.surface_handles.begin(), icd.surface_handles.end(), fake_surf_handle);
@@ -686,6 +712,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(Vk
 VKAPI_ATTR VkResult VKAPI_CALL test_vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface,
                                                                          uint32_t* pSurfaceFormatCount,
                                                                          VkSurfaceFormatKHR* pSurfaceFormats) {
+    icd.get_physical_device_surface_formats_call_count++;
     if (surface != VK_NULL_HANDLE) {
         uint64_t fake_surf_handle = (uint64_t)(surface);
         auto found_iter = std::find(icd.surface_handles.begin(), icd.surface_handles.end(), fake_surf_handle);
@@ -700,6 +727,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysi
 VKAPI_ATTR VkResult VKAPI_CALL test_vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface,
                                                                               uint32_t* pPresentModeCount,
                                                                               VkPresentModeKHR* pPresentModes) {
+    icd.get_physical_device_surface_present_modes_call_count++;
     if (surface != VK_NULL_HANDLE) {
         uint64_t fake_surf_handle = (uint64_t)(surface);
         auto found_iter = std::find(icd.surface_handles.begin(), icd.surface_handles.end(), fake_surf_handle);
@@ -830,6 +858,7 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkAllocateCommandBuffers(VkDevice device, co
 }
 
 VKAPI_ATTR void VKAPI_CALL test_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+    std::lock_guard<std::mutex> lock(icd.device_mutex);
     *pQueue = icd.physical_devices.back().queue_handles[queueIndex].handle;
 }
 
@@ -1352,6 +1381,7 @@ PFN_vkVoidFunction get_device_func(VkDevice device, const char* pName) {
     TestICD::FindDevice fd{};
     DeviceCreateInfo create_info{};
     if (device != nullptr) {
+        std::lock_guard<std::mutex> lock(icd.device_mutex);
         fd = icd.lookup_device(device);
         if (!fd.found) return NULL;
         create_info = icd.physical_devices.at(fd.phys_dev_index).device_create_infos.at(fd.dev_index);
@@ -1402,6 +1432,7 @@ PFN_vkVoidFunction get_device_func(VkDevice device, const char* pName) {
 }
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL test_vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
+    simulate_entry_point_call(icd.get_instance_proc_addr_call_count, icd.get_instance_proc_addr_latency);
     return get_instance_func(instance, pName);
 }
 
@@ -1434,6 +1465,7 @@ PFN_vkVoidFunction base_get_instance_proc_addr(VkInstance instance, const char*
 extern "C" {
 #if TEST_ICD_EXPORT_NEGOTIATE_INTERFACE_VERSION
 extern FRAMEWORK_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t* pSupportedVersion) {
+    simulate_entry_point_call(icd.negotiate_interface_call_count, icd.negotiate_interface_latency);
     if (icd.called_vk_icd_gipa == CalledICDGIPA::not_called &&
         icd.called_negotiate_interface == CalledNegotiateInterface::not_called)
         icd.called_negotiate_interface = CalledNegotiateInterface::vk_icd_negotiate;
@@ -1478,6 +1510,7 @@ FRAMEWORK_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcA
 
     if (icd.called_vk_icd_gipa == CalledICDGIPA::not_called) icd.called_vk_icd_gipa = CalledICDGIPA::vk_icd_gipa;
 
+    simulate_entry_point_call(icd.get_instance_proc_addr_call_count, icd.get_instance_proc_addr_latency);
     return base_get_instance_proc_addr(instance, pName);
 }
 #else   // !TEST_ICD_EXPORT_ICD_GIPA
@@ -1485,6 +1518,7 @@ FRAMEWORK_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(
     // std::cout << "icdGetInstanceProcAddr: " << pName << "\n";
 
     if (icd.called_vk_icd_gipa == CalledICDGIPA::not_called) icd.called_vk_icd_gipa = CalledICDGIPA::vk_gipa;
+    simulate_entry_point_call(icd.get_instance_proc_addr_call_count, icd.get_instance_proc_addr_latency);
     return base_get_instance_proc_addr(instance, pName);
 }
 FRAMEWORK_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo,
@@ -29,6 +29,9 @@
 
 #include "test_util.h"
 
+#include <atomic>
+#include <mutex>
+
 #include "layer/layer_util.h"
 
 #include "physical_device.h"
@@ -75,6 +78,8 @@ struct TestICD {
     BUILDER_VECTOR(TestICD, PhysicalDeviceGroup, physical_device_groups, physical_device_group);
 
     DispatchableHandle<VkInstance> instance_handle;
+    // Guards the per device state below and in PhysicalDevice, as devices may be created and destroyed from many threads
+    std::mutex device_mutex;
     std::vector<DispatchableHandle<VkDevice>> device_handles;
     std::vector<uint64_t> surface_handles;
     std::vector<uint64_t> messenger_handles;
@@ -95,6 +100,62 @@ struct TestICD {
 
     VkInstanceCreateFlags passed_in_instance_create_flags{};
 
+    // Number of times each entry point was called in this driver. Atomic since tests may call into the driver from many threads.
+    std::atomic<uint32_t> negotiate_interface_call_count{0};
+    std::atomic<uint32_t> create_instance_call_count{0};
+    std::atomic<uint32_t> enumerate_physical_devices_call_count{0};
+    std::atomic<uint32_t> get_instance_proc_addr_call_count{0};
+    std::atomic<uint32_t> get_physical_device_surface_support_call_count{0};
+    std::atomic<uint32_t> get_physical_device_surface_capabilities_call_count{0};
+    std::atomic<uint32_t> get_physical_device_surface_formats_call_count{0};
+    std::atomic<uint32_t> get_physical_device_surface_present_modes_call_count{0};
+
+    // Artificial latency added to each call of an entry point, used to simulate drivers which are slow to initialize or to
+    // answer queries. vkGetInstanceProcAddr covers both the exported function and the one returned from it.
+    BUILDER_VALUE(TestICD, std::chrono::microseconds, negotiate_interface_latency, std::chrono::microseconds(0))
+    BUILDER_VALUE(TestICD, std::chrono::microseconds, create_instance_latency, std::chrono::microseconds(0))
+    BUILDER_VALUE(TestICD, std::chrono::microseconds, enumerate_physical_devices_latency, std::chrono::microseconds(0))
+    BUILDER_VALUE(TestICD, std::chrono::microseconds, get_instance_proc_addr_latency, std::chrono::microseconds(0))
+
+    // Helpers for building large populations, to measure how the loader scales without needing real hardware.
+    // Adds count physical devices named "<name_prefix><index>", each with a single graphics queue family
+    TestICD& add_generated_physical_devices(uint32_t count, std::string const& name_prefix = "physical_device_") {
+        for (uint32_t i = 0; i < count; i++) {
+            physical_devices.emplace_back(name_prefix + std::to_string(i));
+            physical_devices.back().add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, false});
+        }
+        return *this;
+    }
+    // Splits the physical devices into groups of group_size (the last group may be smaller). Must be called after all
+    // physical devices are added, as groups point into physical_devices.
+    TestICD& add_generated_physical_device_groups(uint32_t group_size) {
+        for (size_t i = 0; i < physical_devices.size(); i += group_size) {
+            PhysicalDeviceGroup group;
+            for (size_t j = i; j < physical_devices.size() && j < i + group_size; j++) {
+                group.use_physical_device(physical_devices[j]);
+            }
+            physical_device_groups.push_back(group);
+        }
+        return *this;
+    }
+    // Adds count instance extensions named "<name_prefix><index>". The loader doesn't know them, so they are filtered out.
+    TestICD& add_generated_instance_extensions(uint32_t count,
+                                               std::string const& name_prefix = "VK_TEST_generated_instance_extension_") {
+        for (uint32_t i = 0; i < count; i++) {
+            add_instance_extension({name_prefix + std::to_string(i)});
+        }
+        return *this;
+    }
+    // Adds count device extensions named "<name_prefix><index>" to every physical device
+    TestICD& add_generated_device_extensions(uint32_t count, std::string const& name_prefix = "VK_TEST_generated_device_extension_") {
+        for (auto& phys_dev : physical_devices) {
+            for (uint32_t i = 0; i < count; i++) {
+                phys_dev.add_extension({name_prefix + std::to_string(i)});
+            }
+        }
+        return *this;
+    }
+
     PhysicalDevice& GetPhysDevice(VkPhysicalDevice physicalDevice) {
         for (auto& phys_dev : physical_devices) {
             if (phys_dev.vk_physical_device.handle == physicalDevice) return phys_dev;
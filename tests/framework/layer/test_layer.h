@@ -121,6 +121,8 @@ struct TestLayer {
     BUILDER_VALUE(TestLayer, std::function<VkResult(TestLayer& layer)>, create_instance_callback, {})
     // Called in vkCreateDevice after calling down the chain & returning
     BUILDER_VALUE(TestLayer, std::function<VkResult(TestLayer& layer)>, create_device_callback, {})
+    // Called in vkGetDeviceProcAddr before looking up the function
+    BUILDER_VALUE(TestLayer, std::function<void(TestLayer& layer, const char* pName)>, get_device_proc_addr_callback, {})
 
     // Physical device modifier test flags and members.  This data is primarily used to test adding, removing and
     // re-ordering physical device data in a layer.
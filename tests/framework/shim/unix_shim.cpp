@@ -48,6 +48,7 @@ FRAMEWORK_EXPORT PlatformShim* get_platform_shim(std::vector<fs::FolderManager>*
 #define CLOSEDIR_FUNC_NAME closedir
 #define ACCESS_FUNC_NAME access
 #define FOPEN_FUNC_NAME fopen
+#define STAT_FUNC_NAME stat
 #define GETEUID_FUNC_NAME geteuid
 #define GETEGID_FUNC_NAME getegid
 #if defined(HAVE_SECURE_GETENV)
@@ -62,6 +63,7 @@ FRAMEWORK_EXPORT PlatformShim* get_platform_shim(std::vector<fs::FolderManager>*
 #define CLOSEDIR_FUNC_NAME my_closedir
 #define ACCESS_FUNC_NAME my_access
 #define FOPEN_FUNC_NAME my_fopen
+#define STAT_FUNC_NAME my_stat
 #define GETEUID_FUNC_NAME my_geteuid
 #define GETEGID_FUNC_NAME my_getegid
 #if defined(HAVE_SECURE_GETENV)
@@ -77,6 +79,7 @@ using PFN_READDIR = struct dirent* (*)(DIR* dir_stream);
 using PFN_CLOSEDIR = int (*)(DIR* dir_stream);
 using PFN_ACCESS = int (*)(const char* pathname, int mode);
 using PFN_FOPEN = FILE* (*)(const char* filename, const char* mode);
+using PFN_STAT = int (*)(const char* pathname, struct stat* statbuf);
 using PFN_GETEUID = uid_t (*)(void);
 using PFN_GETEGID = gid_t (*)(void);
 #if defined(HAVE_SECURE_GETENV) || defined(HAVE___SECURE_GETENV)
@@ -89,6 +92,7 @@ using PFN_SEC_GETENV = char* (*)(const char* name);
 #define real_closedir closedir
 #define real_access access
 #define real_fopen fopen
+#define real_stat stat
 #define real_geteuid geteuid
 #define real_getegid getegid
 #if defined(HAVE_SECURE_GETENV)
@@ -103,6 +107,7 @@ static PFN_READDIR real_readdir = nullptr;
 static PFN_CLOSEDIR real_closedir = nullptr;
 static PFN_ACCESS real_access = nullptr;
 static PFN_FOPEN real_fopen = nullptr;
+static PFN_STAT real_stat = nullptr;
 static PFN_GETEUID real_geteuid = nullptr;
 static PFN_GETEGID real_getegid = nullptr;
 #if defined(HAVE_SECURE_GETENV)
@@ -220,6 +225,56 @@ FRAMEWORK_EXPORT FILE* FOPEN_FUNC_NAME(const char* in_filename, const char* mode
     return f_ptr;
 }
 
+FRAMEWORK_EXPORT int STAT_FUNC_NAME(const char* in_pathname, struct stat* statbuf) {
+#if !defined(__APPLE__)
+    if (!real_stat) real_stat = (PFN_STAT)dlsym(RTLD_NEXT, "stat");
+#endif
+    fs::path path{in_pathname};
+    if (!path.has_parent_path()) {
+        return real_stat(in_pathname, statbuf);
+    }
+
+    if (platform_shim.is_fake_path(path.parent_path())) {
+        fs::path fake_path = platform_shim.get_fake_path(path.parent_path());
+        fake_path /= path.filename();
+        return real_stat(fake_path.c_str(), statbuf);
+    }
+    return real_stat(in_pathname, statbuf);
+}
+
+#if defined(__GLIBC__)
+#if !__GLIBC_PREREQ(2, 33)
+// Before glibc 2.33, stat is a wrapper linked into each library from libc_nonshared which calls __xstat, so that is what gets
+// shimmed instead
+using PFN_XSTAT = int (*)(int ver, const char* pathname, struct stat* statbuf);
+using PFN_XSTAT64 = int (*)(int ver, const char* pathname, struct stat64* statbuf);
+static PFN_XSTAT real_xstat = nullptr;
+static PFN_XSTAT64 real_xstat64 = nullptr;
+
+FRAMEWORK_EXPORT int __xstat(int ver, const char* in_pathname, struct stat* statbuf) {
+    if (!real_xstat) real_xstat = (PFN_XSTAT)dlsym(RTLD_NEXT, "__xstat");
+    fs::path path{in_pathname};
+    if (path.has_parent_path() && platform_shim.is_fake_path(path.parent_path())) {
+        fs::path fake_path = platform_shim.get_fake_path(path.parent_path());
+        fake_path /= path.filename();
+        return real_xstat(ver, fake_path.c_str(), statbuf);
+    }
+    return real_xstat(ver, in_pathname, statbuf);
+}
+
+FRAMEWORK_EXPORT int __xstat64(int ver, const char* in_pathname, struct stat64* statbuf) {
+    if (!real_xstat64) real_xstat64 = (PFN_XSTAT64)dlsym(RTLD_NEXT, "__xstat64");
+    fs::path path{in_pathname};
+    if (path.has_parent_path() && platform_shim.is_fake_path(path.parent_path())) {
+        fs::path fake_path = platform_shim.get_fake_path(path.parent_path());
+        fake_path /= path.filename();
+        return real_xstat64(ver, fake_path.c_str(), statbuf);
+    }
+    return real_xstat64(ver, in_pathname, statbuf);
+}
+#endif
+#endif
+
 FRAMEWORK_EXPORT uid_t GETEUID_FUNC_NAME(void) {
 #if !defined(__APPLE__)
     if (!real_geteuid) real_geteuid = (PFN_GETEUID)dlsym(RTLD_NEXT, "geteuid");
@@ -289,6 +344,7 @@ __attribute__((used)) static Interposer _interpose_opendir MACOS_ATTRIB = {VOIDP
 __attribute__((used)) static Interposer _interpose_closedir MACOS_ATTRIB = {VOIDP_CAST(my_closedir), VOIDP_CAST(closedir)};
 __attribute__((used)) static Interposer _interpose_access MACOS_ATTRIB = {VOIDP_CAST(my_access), VOIDP_CAST(access)};
 __attribute__((used)) static Interposer _interpose_fopen MACOS_ATTRIB = {VOIDP_CAST(my_fopen), VOIDP_CAST(fopen)};
+__attribute__((used)) static Interposer _interpose_stat MACOS_ATTRIB = {VOIDP_CAST(my_stat), VOIDP_CAST(stat)};
 __attribute__((used)) static Interposer _interpose_euid MACOS_ATTRIB = {VOIDP_CAST(my_geteuid), VOIDP_CAST(geteuid)};
 __attribute__((used)) static Interposer _interpose_egid MACOS_ATTRIB = {VOIDP_CAST(my_getegid), VOIDP_CAST(getegid)};
 #if defined(HAVE_SECURE_GETENV)
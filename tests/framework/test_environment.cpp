@@ -49,6 +49,9 @@ void init_vulkan_functions(VulkanFunctions& funcs) {
     funcs.vkEnumerateInstanceLayerProperties = GPA(vkEnumerateInstanceLayerProperties);
     funcs.vkEnumerateInstanceVersion = GPA(vkEnumerateInstanceVersion);
     funcs.vkCreateInstance = GPA(vkCreateInstance);
+    funcs.vk_loaderCreateInstanceAsync = GPA(vk_loaderCreateInstanceAsync);
+    funcs.vk_loaderGetPendingInstanceStatus = GPA(vk_loaderGetPendingInstanceStatus);
+    funcs.vk_loaderWaitForPendingInstance = GPA(vk_loaderWaitForPendingInstance);
     funcs.vkDestroyInstance = GPA(vkDestroyInstance);
     funcs.vkEnumeratePhysicalDevices = GPA(vkEnumeratePhysicalDevices);
     funcs.vkEnumeratePhysicalDeviceGroups = GPA(vkEnumeratePhysicalDeviceGroups);
@@ -360,8 +363,13 @@ FrameworkEnvironment::FrameworkEnvironment(bool enable_log, bool set_default_sea
     folders.emplace_back(FRAMEWORK_BUILD_DIRECTORY, std::string("implicit_layer_manifests"));
     folders.emplace_back(FRAMEWORK_BUILD_DIRECTORY, std::string("override_layer_manifests"));
     folders.emplace_back(FRAMEWORK_BUILD_DIRECTORY, std::string("app_package_manifests"));
+    folders.emplace_back(FRAMEWORK_BUILD_DIRECTORY, std::string("pci_devices"));
 
     platform_shim->redirect_all_paths(get_folder(ManifestLocation::null).location());
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    // Keep the PCI devices of the machine running the tests from changing which drivers are loaded
+    platform_shim->redirect_path("/sys/bus/pci/devices", get_folder(ManifestLocation::pci_devices).location());
+#endif
     if (set_default_search_paths) {
         platform_shim->set_path(ManifestCategory::icd, get_folder(ManifestLocation::driver).location());
         platform_shim->set_path(ManifestCategory::explicit_layer, get_folder(ManifestLocation::explicit_layer).location());
@@ -444,6 +452,18 @@ void FrameworkEnvironment::add_explicit_layer(TestLayerDetails layer_details) no
     add_layer_impl(layer_details, ManifestCategory::explicit_layer);
 }
 
+std::vector<std::string> FrameworkEnvironment::add_pass_through_layers(uint32_t count, const std::string& name_prefix) noexcept {
+    std::vector<std::string> layer_names;
+    for (uint32_t i = 0; i < count; i++) {
+        layer_names.push_back(name_prefix + std::to_string(i));
+        add_explicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                         .set_name(layer_names.back())
+                                                         .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+                           layer_names.back() + ".json");
+    }
+    return layer_names;
+}
+
 void FrameworkEnvironment::add_layer_impl(TestLayerDetails layer_details, ManifestCategory category) {
     fs::FolderManager* fs_ptr = &get_folder(ManifestLocation::explicit_layer);
     switch (layer_details.discovery_type) {
@@ -515,6 +535,17 @@ fs::FolderManager& FrameworkEnvironment::get_folder(ManifestLocation location) n
     // index it directly using the enum location since they will always be in that order
     return folders.at(static_cast<size_t>(location));
 }
+
+void FrameworkEnvironment::add_pci_device(std::string const& address, uint32_t vendor_id) noexcept {
+    // The entry listed in the devices folder only has to exist, as its "vendor" file is read from a folder of its own
+    get_folder(ManifestLocation::pci_devices).write_manifest(address, "");
+    folders.emplace_back(FRAMEWORK_BUILD_DIRECTORY, "pci_device_" + address);
+    char vendor[16];
+    snprintf(vendor, sizeof(vendor), "0x%04x", vendor_id);
+    folders.back().write_manifest("vendor", vendor);
+    platform_shim->redirect_path(fs::path("/sys/bus/pci/devices") / address, folders.back().location());
+}
+
 const char* get_platform_wsi_extension(const char* api_selection) {
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
     return "VK_KHR_android_surface";
@@ -72,6 +72,8 @@
 
 #include "layer/test_layer.h"
 
+#include "loader/vk_loader_async.h"
+
 // handle checking
 template <typename T>
 void handle_assert_has_value(T const& handle) {
@@ -130,6 +132,11 @@ struct VulkanFunctions {
     PFN_vkEnumerateInstanceVersion vkEnumerateInstanceVersion = nullptr;
     PFN_vkCreateInstance vkCreateInstance = nullptr;
 
+    // Loader specific asynchronous instance creation
+    PFN_vk_loaderCreateInstanceAsync vk_loaderCreateInstanceAsync = nullptr;
+    PFN_vk_loaderGetPendingInstanceStatus vk_loaderGetPendingInstanceStatus = nullptr;
+    PFN_vk_loaderWaitForPendingInstance vk_loaderWaitForPendingInstance = nullptr;
+
     // Instance
     PFN_vkDestroyInstance vkDestroyInstance = nullptr;
     PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices = nullptr;
@@ -353,6 +360,16 @@ struct DebugUtilsLogger {
     // Find a string in the log output
     bool find(std::string const& search_text) const { return returned_output.find(search_text) != std::string::npos; }
 
+    // Count the number of times a string occurs in the log output
+    size_t count(std::string const& search_text) const {
+        size_t occurrences = 0;
+        for (size_t pos = returned_output.find(search_text); pos != std::string::npos;
+             pos = returned_output.find(search_text, pos + search_text.size())) {
+            occurrences++;
+        }
+        return occurrences;
+    }
+
     // Look through the event log. If you find a line containing the prefix we're interested in, look for the end of
     // line character, and then see if the postfix occurs in it as well.
     bool find_prefix_then_postfix(const char* prefix, const char* postfix) const;
@@ -489,6 +506,7 @@ enum class ManifestLocation {
     implicit_layer = 6,
     override_layer = 7,
     windows_app_package = 8,
+    pci_devices = 9,
 };
 
 struct FrameworkEnvironment {
@@ -503,6 +521,10 @@ struct FrameworkEnvironment {
     void add_explicit_layer(TestLayerDetails layer_details) noexcept;
     void add_fake_implicit_layer(ManifestLayer layer_manifest, const std::string& json_name) noexcept;
     void add_fake_explicit_layer(ManifestLayer layer_manifest, const std::string& json_name) noexcept;
+    // Adds count explicit layers named "<name_prefix><index>", each backed by its own copy of the pass-through test layer.
+    // Returns the names in the order they were added, which is useful for building deep layer chains.
+    std::vector<std::string> add_pass_through_layers(uint32_t count,
+                                                     const std::string& name_prefix = "VK_LAYER_pass_through_") noexcept;
 
     TestICD& get_test_icd(size_t index = 0) noexcept;
     TestICD& reset_icd(size_t index = 0) noexcept;
@@ -516,6 +538,9 @@ struct FrameworkEnvironment {
 
     fs::FolderManager& get_folder(ManifestLocation location) noexcept;
 
+    // Adds a device to the fake /sys/bus/pci/devices which the loader reads on Unix, and is otherwise empty
+    void add_pci_device(std::string const& address, uint32_t vendor_id) noexcept;
+
     PlatformShimWrapper platform_shim;
     std::vector<fs::FolderManager> folders;
 
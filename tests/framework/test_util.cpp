@@ -135,6 +135,15 @@ std::string ManifestICD::get_manifest_str() const {
     out += "        \"library_path\": \"" + fs::fixup_backslashes_in_path(lib_path) + "\",\n";
     out += "        \"api_version\": \"" + version_to_string(api_version) + "\",\n";
     out += "        \"is_portability_driver\": " + to_text(is_portability_driver);
+    if (!pci_vendor_ids.empty()) {
+        out += ",\n        \"pci_vendor_ids\": [";
+        for (size_t i = 0; i < pci_vendor_ids.size(); i++) {
+            char vendor_id[16];
+            snprintf(vendor_id, sizeof(vendor_id), "0x%04x", pci_vendor_ids[i]);
+            out += std::string(i > 0 ? ", " : "") + "\"" + vendor_id + "\"";
+        }
+        out += "]";
+    }
     if (!library_arch.empty()) {
         out += ",\n       \"library_arch\": \"" + library_arch + "\"\n";
     } else {
@@ -44,6 +44,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <iostream>
 #include <fstream>
 #include <ostream>
@@ -53,6 +54,7 @@
 #include <utility>
 #include <memory>
 #include <functional>
+#include <thread>
 
 #include <cassert>
 #include <cstring>
@@ -356,6 +358,11 @@ struct LibraryWrapper {
         }
         return FromVoidStarFunc(symbol);
     }
+    // Like get_symbol, but for symbols which only some builds export, so it returns nullptr when symbol_name isn't found
+    FromVoidStarFunc find_symbol(const char* symbol_name) const {
+        assert(lib_handle != nullptr && "Cannot get symbol with null library handle");
+        return FromVoidStarFunc(loader_platform_get_proc_address(lib_handle, symbol_name));
+    }
 
     explicit operator bool() const noexcept { return lib_handle != nullptr; }
 
@@ -559,6 +566,7 @@ struct ManifestICD {
     BUILDER_VALUE(ManifestICD, std::string, lib_path, {})
     BUILDER_VALUE(ManifestICD, bool, is_portability_driver, false)
     BUILDER_VALUE(ManifestICD, std::string, library_arch, "")
+    BUILDER_VECTOR(ManifestICD, uint32_t, pci_vendor_ids, pci_vendor_id)
     std::string get_manifest_str() const;
 };
 
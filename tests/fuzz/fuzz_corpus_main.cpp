@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+// Stands in for the main of libFuzzer when the fuzzers are built without it, running each file given on the command line, or
+// each file in each directory given, through the fuzzer once. Options meant for libFuzzer, which start with '-', are ignored so
+// that both builds can be run the same way.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+extern "C" int LLVMFuzzerInitialize(int* argc, char*** argv);
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+namespace {
+
+bool read_file(std::string const& path, std::vector<uint8_t>& contents) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return false;
+    contents.clear();
+    uint8_t buffer[4096];
+    size_t read = 0;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) contents.insert(contents.end(), buffer, buffer + read);
+    bool failed = ferror(file) != 0;
+    fclose(file);
+    return !failed;
+}
+
+// Directories are listed in sorted order so that runs are reproducible
+bool add_inputs(std::string const& path, std::vector<std::string>& inputs) {
+    struct stat path_stat {};
+    if (0 != stat(path.c_str(), &path_stat)) return false;
+    if (!S_ISDIR(path_stat.st_mode)) {
+        inputs.push_back(path);
+        return true;
+    }
+    DIR* dir = opendir(path.c_str());
+    if (dir == nullptr) return false;
+    std::vector<std::string> entries;
+    while (struct dirent* entry = readdir(dir)) {
+        std::string entry_path = path + "/" + entry->d_name;
+        struct stat entry_stat {};
+        if (0 == stat(entry_path.c_str(), &entry_stat) && S_ISREG(entry_stat.st_mode)) entries.push_back(entry_path);
+    }
+    closedir(dir);
+    std::sort(entries.begin(), entries.end());
+    inputs.insert(inputs.end(), entries.begin(), entries.end());
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    LLVMFuzzerInitialize(&argc, &argv);
+
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-') continue;
+        if (!add_inputs(argv[i], inputs)) {
+            fprintf(stderr, "Failed to read %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (inputs.empty()) {
+        fprintf(stderr, "Usage: %s <file or directory>...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<uint8_t> contents;
+    for (auto const& input : inputs) {
+        if (!read_file(input, contents)) {
+            fprintf(stderr, "Failed to read %s\n", input.c_str());
+            return 1;
+        }
+        printf("Running %s (%zu bytes)\n", input.c_str(), contents.size());
+        fflush(stdout);
+        // Any failure aborts inside of the fuzzer
+        LLVMFuzzerTestOneInput(contents.data(), contents.size());
+    }
+    printf("Ran %zu inputs\n", inputs.size());
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+// Fuzzes the manifest parsing of the loader, which is cJSON along with loader_read_layer_json and loader_parse_icd_manifest.
+// Those are internal to the loader, so each input is written out as both a driver manifest and an explicit layer manifest
+// which the loader reads while creating an instance. Every Vulkan process on a system parses the manifests installed on it,
+// so besides crashing, an input fails when parsing it makes more allocations than a budget which grows linearly with the size
+// of the input. Inputs which take longer than a similar time budget are only reported, as the time depends on the machine.
+// Every other place the loader looks for manifests is pointed at an empty directory, so that the manifests installed on the
+// machine running the fuzzer don't change the results.
+
+#include <vulkan/vulkan.h>
+
+#if defined(MANIFEST_FUZZER_USE_SHIM)
+#include "shim.h"
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// The base of each budget covers creating an instance from an empty manifest, including with sanitizers and coverage
+// instrumentation. The per byte part is generous, as the goal is to catch parsing which is super-linear in the input size
+// rather than to measure its constant factors. Allocations are counted the same way on every machine, so only they fail.
+const uint64_t allocation_budget_base = 4096;
+const uint64_t allocation_budget_per_byte = 16;
+const std::chrono::microseconds time_budget_base = std::chrono::milliseconds(500);
+const std::chrono::microseconds time_budget_per_byte = std::chrono::microseconds(50);
+
+std::string fuzz_directory;
+std::string driver_manifest_path;
+std::string layer_manifest_path;
+
+uint64_t allocation_count = 0;
+
+VKAPI_ATTR void* VKAPI_CALL counting_allocation(void*, size_t size, size_t alignment, VkSystemAllocationScope) {
+    allocation_count++;
+    void* memory = nullptr;
+    if (0 != posix_memalign(&memory, alignment < sizeof(void*) ? sizeof(void*) : alignment, size)) return nullptr;
+    return memory;
+}
+
+VKAPI_ATTR void* VKAPI_CALL counting_reallocation(void*, void* original, size_t size, size_t, VkSystemAllocationScope) {
+    allocation_count++;
+    return realloc(original, size);
+}
+
+VKAPI_ATTR void VKAPI_CALL counting_free(void*, void* memory) { free(memory); }
+
+bool write_file(std::string const& path, const uint8_t* data, size_t size) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) return false;
+    bool written = size == fwrite(data, 1, size, file);
+    return 0 == fclose(file) && written;
+}
+
+void remove_fuzz_directory() {
+    remove(driver_manifest_path.c_str());
+    remove(layer_manifest_path.c_str());
+    rmdir((fuzz_directory + "/layers").c_str());
+    rmdir((fuzz_directory + "/empty").c_str());
+    rmdir(fuzz_directory.c_str());
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerInitialize(int*, char***) {
+    const char* tmp = getenv("TMPDIR");
+    std::string directory_template = std::string(tmp != nullptr ? tmp : "/tmp") + "/vk_manifest_fuzzer_XXXXXX";
+    if (mkdtemp(&directory_template[0]) == nullptr) {
+        perror("manifest_fuzzer: Failed to create a temporary directory");
+        abort();
+    }
+    fuzz_directory = directory_template;
+    if (0 != mkdir((fuzz_directory + "/layers").c_str(), 0700) || 0 != mkdir((fuzz_directory + "/empty").c_str(), 0700)) {
+        perror("manifest_fuzzer: Failed to create the manifest directories");
+        abort();
+    }
+    std::string empty_directory = fuzz_directory + "/empty";
+    driver_manifest_path = fuzz_directory + "/driver.json";
+    layer_manifest_path = fuzz_directory + "/layers/layer.json";
+    atexit(remove_fuzz_directory);
+
+    // Only the fuzzed manifests are used, and nothing which changes how much work the loader does is left enabled
+    setenv("VK_DRIVER_FILES", driver_manifest_path.c_str(), 1);
+    setenv("VK_LAYER_PATH", (fuzz_directory + "/layers").c_str(), 1);
+    unsetenv("VK_ICD_FILENAMES");
+    unsetenv("VK_ADD_DRIVER_FILES");
+    unsetenv("VK_ADD_LAYER_PATH");
+    unsetenv("VK_INSTANCE_LAYERS");
+    unsetenv("VK_LOADER_LAYERS_ENABLE");
+    unsetenv("VK_LOADER_DEBUG");
+    unsetenv("VK_LOADER_FORK_SAFE");
+    unsetenv("VK_LOADER_LAZY_DRIVER_INSTANCES");
+    unsetenv("VK_LOADER_DRIVER_TIMEOUT_MS");
+
+    // Implicit layers are searched for in the home and XDG directories, which can all be moved to the empty directory, and in
+    // the system configuration directories, which only the shim can redirect
+    setenv("HOME", empty_directory.c_str(), 1);
+    setenv("XDG_CONFIG_HOME", empty_directory.c_str(), 1);
+    setenv("XDG_CONFIG_DIRS", empty_directory.c_str(), 1);
+    setenv("XDG_DATA_HOME", empty_directory.c_str(), 1);
+    setenv("XDG_DATA_DIRS", empty_directory.c_str(), 1);
+#if defined(MANIFEST_FUZZER_USE_SHIM)
+    static std::vector<fs::FolderManager> no_folders;
+    PlatformShim* platform_shim = get_platform_shim(&no_folders);
+    platform_shim->reset();
+    platform_shim->redirect_all_paths(empty_directory);
+#endif
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (!write_file(driver_manifest_path, data, size) || !write_file(layer_manifest_path, data, size)) {
+        perror("manifest_fuzzer: Failed to write the manifests");
+        abort();
+    }
+
+    VkAllocationCallbacks allocator{};
+    allocator.pfnAllocation = counting_allocation;
+    allocator.pfnReallocation = counting_reallocation;
+    allocator.pfnFree = counting_free;
+
+    VkInstanceCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    VkInstance instance = VK_NULL_HANDLE;
+
+    allocation_count = 0;
+    auto start = std::chrono::steady_clock::now();
+    VkResult result = vkCreateInstance(&create_info, &allocator, &instance);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    uint64_t allocations = allocation_count;
+    // Creation fails unless the input names a real driver library, which is fine as the manifests were parsed regardless
+    if (result == VK_SUCCESS) vkDestroyInstance(instance, &allocator);
+
+    uint64_t allocation_budget = allocation_budget_base + allocation_budget_per_byte * size;
+    std::chrono::microseconds time_budget = time_budget_base + time_budget_per_byte * static_cast<int64_t>(size);
+    if (allocations > allocation_budget) {
+        fprintf(stderr, "manifest_fuzzer: A %zu byte manifest made %llu allocations, more than the budget of %llu\n", size,
+                static_cast<unsigned long long>(allocations), static_cast<unsigned long long>(allocation_budget));
+        abort();
+    }
+    if (elapsed > time_budget) {
+        fprintf(stderr, "manifest_fuzzer: A %zu byte manifest took %lld us to parse, more than the budget of %lld us\n", size,
+                static_cast<long long>(elapsed.count()), static_cast<long long>(time_budget.count()));
+    }
+    return 0;
+}
@@ -303,6 +303,69 @@ TEST(Allocation, InstanceAndDevice) {
     }
     ASSERT_TRUE(tracker.empty());
 }
+
+// Test that once everything has been queried once, repeating the common queries doesn't call the allocation functions again.
+TEST(Allocation, SteadyStateQueriesDontAllocate) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+
+    MemoryTracker tracker;
+    auto& driver = env.get_test_icd();
+    driver.physical_devices.emplace_back("physical_device_0");
+    driver.physical_devices[0].add_extensions({"VK_EXT_one", "VK_EXT_two", "VK_EXT_three"});
+    driver.physical_devices[0].add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, false});
+    driver.physical_devices.emplace_back("physical_device_1");
+    driver.physical_devices[1].add_extensions({"VK_EXT_four"});
+    {
+        InstWrapper inst{env.vulkan_functions, tracker.get()};
+        ASSERT_NO_FATAL_FAILURE(inst.CheckCreate());
+
+        VkPhysicalDevice physical_devices[2]{};
+        DeviceCreateInfo dev_create_info;
+        DeviceQueueCreateInfo queue_info;
+        queue_info.add_priority(0.0f);
+        dev_create_info.add_device_queue(queue_info);
+
+        auto query_everything = [&](VkDevice device) {
+            uint32_t physical_count = 0;
+            ASSERT_EQ(VK_SUCCESS, inst->vkEnumeratePhysicalDevices(inst.inst, &physical_count, nullptr));
+            ASSERT_EQ(physical_count, 2U);
+            ASSERT_EQ(VK_SUCCESS, inst->vkEnumeratePhysicalDevices(inst.inst, &physical_count, physical_devices));
+            ASSERT_EQ(physical_count, 2U);
+            for (auto physical_device : physical_devices) {
+                uint32_t extension_count = 0;
+                ASSERT_EQ(VK_SUCCESS,
+                          inst->vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, nullptr));
+                std::array<VkExtensionProperties, 8> extensions{};
+                ASSERT_LE(extension_count, extensions.size());
+                ASSERT_EQ(VK_SUCCESS, inst->vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count,
+                                                                                 extensions.data()));
+            }
+            ASSERT_NE(nullptr, inst->vkGetInstanceProcAddr(inst.inst, "vkEnumeratePhysicalDevices"));
+            ASSERT_NE(nullptr, inst->vkGetInstanceProcAddr(inst.inst, "vkGetPhysicalDeviceProperties"));
+            if (VK_NULL_HANDLE != device) {
+                ASSERT_NE(nullptr, inst->vkGetDeviceProcAddr(device, "vkDestroyDevice"));
+                ASSERT_NE(nullptr, inst->vkGetDeviceProcAddr(device, "vkGetDeviceQueue"));
+            }
+        };
+
+        // The first round is allowed to allocate
+        ASSERT_NO_FATAL_FAILURE(query_everything(VK_NULL_HANDLE));
+        VkDevice device;
+        ASSERT_EQ(inst->vkCreateDevice(physical_devices[0], dev_create_info.get(), tracker.get(), &device), VK_SUCCESS);
+        ASSERT_NO_FATAL_FAILURE(query_everything(device));
+
+        const size_t call_count = tracker.current_call_count();
+        for (uint32_t i = 0; i < 10; i++) {
+            ASSERT_NO_FATAL_FAILURE(query_everything(device));
+        }
+        ASSERT_EQ(call_count, tracker.current_call_count());
+
+        inst->vkDestroyDevice(device, tracker.get());
+    }
+    ASSERT_TRUE(tracker.empty());
+}
+
 // Test making sure the allocation functions are called to allocate and cleanup everything from
 // vkCreateInstance, to vkCreateDevicce, and then through their destructors.  With special
 // allocators used on only the instance and not the device.
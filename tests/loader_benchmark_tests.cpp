@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+// Benchmarks of loader hot paths. These check the results they produce but otherwise only report timings, so they live in
+// their own executable which isn't run as part of ctest.
+
+#include "test_environment.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+template <typename Func>
+std::chrono::nanoseconds time_iterations(uint32_t iterations, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        func();
+    }
+    return (std::chrono::steady_clock::now() - start) / iterations;
+}
+
+void report(std::string const& name, std::chrono::nanoseconds per_iteration) {
+    std::cout << "[ BENCHMARK] " << name << ": " << std::chrono::duration_cast<std::chrono::microseconds>(per_iteration).count()
+              << " us per iteration\n";
+}
+
+// Runs op on 1 to 64 threads at once, each calling it ops_per_thread times, and reports the combined throughput along with
+// how close that is to scaling linearly with the number of threads.
+template <typename Func>
+void report_thread_scaling(std::string const& name, uint32_t ops_per_thread, Func&& op) {
+    double single_thread_throughput = 0.0;
+    for (uint32_t thread_count : {1U, 2U, 4U, 8U, 16U, 32U, 64U}) {
+        std::atomic<bool> start{false};
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < thread_count; t++) {
+            threads.emplace_back([&]() {
+                while (!start) {
+                    std::this_thread::yield();
+                }
+                for (uint32_t i = 0; i < ops_per_thread; i++) {
+                    op(i);
+                }
+            });
+        }
+        auto begin = std::chrono::steady_clock::now();
+        start = true;
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+        double throughput = static_cast<double>(thread_count) * ops_per_thread / elapsed.count();
+        if (thread_count == 1) {
+            single_thread_throughput = throughput;
+        }
+        std::cout << "[ BENCHMARK] " << name << ": " << thread_count << " threads, " << static_cast<uint64_t>(throughput)
+                  << " ops/s, " << static_cast<uint32_t>(100.0 * throughput / (single_thread_throughput * thread_count))
+                  << "% scaling efficiency\n";
+    }
+}
+
+// Drivers advertising hundreds of instance extensions the loader doesn't know about, mixed in with a few it does, which
+// stresses the filtering done in loader_get_icd_loader_instance_extensions and loader_validate_instance_extensions.
+TEST(InstanceExtensionFiltering, HundredsOfUnknownDriverExtensions) {
+    const uint32_t driver_count = 4;
+    const uint32_t unknown_extension_count = 500;
+    const std::vector<const char*> known_extensions = {VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_DISPLAY_EXTENSION_NAME,
+                                                       VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
+                                                       VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME};
+
+    FrameworkEnvironment env{false};
+    for (uint32_t driver = 0; driver < driver_count; driver++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        auto& driver_icd = env.get_test_icd(driver);
+        driver_icd.add_generated_physical_devices(1);
+        for (auto const& known_extension : known_extensions) {
+            driver_icd.add_generated_instance_extensions(unknown_extension_count / static_cast<uint32_t>(known_extensions.size()),
+                                                         std::string("VK_VENDOR_unknown_") + std::to_string(driver) + "_" +
+                                                             known_extension + "_");
+            driver_icd.add_instance_extension({known_extension});
+        }
+    }
+
+    uint32_t extension_count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceExtensionProperties(nullptr, &extension_count, nullptr));
+    // The known extensions plus debug report, debug utils, and portability enumeration which the loader adds
+    ASSERT_EQ(extension_count, known_extensions.size() + 3);
+
+    report("vkEnumerateInstanceExtensionProperties", time_iterations(100, [&]() {
+               uint32_t count = 0;
+               env.vulkan_functions.vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr);
+           }));
+
+    report("vkCreateInstance/vkDestroyInstance", time_iterations(100, [&]() {
+               InstWrapper inst{env.vulkan_functions};
+               inst.create_info.add_extensions(known_extensions);
+               inst.CheckCreate();
+           }));
+}
+
+// Cost of building the instance and device chains, and of resolving functions through them, as the number of enabled
+// pass-through layers grows.
+TEST(LayerChainDepth, CreationAndProcAddrResolution) {
+    const std::vector<uint32_t> depths = {0, 1, 2, 5, 10, 20};
+    const uint32_t iterations = 50;
+    const uint32_t lookups = 1000;
+
+    FrameworkEnvironment env{false};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().add_generated_physical_devices(1);
+    auto layer_names = env.add_pass_through_layers(depths.back());
+
+    for (uint32_t depth : depths) {
+        const std::string label = "depth " + std::to_string(depth) + ": ";
+        auto enable_layers = [&](InstWrapper& inst) {
+            for (uint32_t i = 0; i < depth; i++) {
+                inst.create_info.add_layer(layer_names[i].c_str());
+            }
+        };
+
+        report(label + "vkCreateInstance/vkDestroyInstance", time_iterations(iterations, [&]() {
+                   InstWrapper inst{env.vulkan_functions};
+                   enable_layers(inst);
+                   inst.CheckCreate();
+               }));
+
+        InstWrapper inst{env.vulkan_functions};
+        enable_layers(inst);
+        inst.CheckCreate();
+        auto phys_dev = inst.GetPhysDev();
+        uint32_t layer_count = 0;
+        env.vulkan_functions.vkEnumerateDeviceLayerProperties(phys_dev, &layer_count, nullptr);
+        ASSERT_EQ(layer_count, depth);
+
+        report(label + "vkCreateDevice/vkDestroyDevice", time_iterations(iterations, [&]() {
+                   DeviceWrapper dev{inst};
+                   dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+                   dev.CheckCreate(phys_dev);
+               }));
+
+        DeviceWrapper dev{inst};
+        dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+        dev.CheckCreate(phys_dev);
+
+        // Known functions are answered from the loader's tables, unknown ones have to be passed down the whole chain
+        for (const char* name : {"vkGetPhysicalDeviceProperties", "vkCmdDraw", "vkNotARealFunction"}) {
+            report(label + "1000 vkGetInstanceProcAddr(" + name + ")", time_iterations(iterations, [&]() {
+                       for (uint32_t i = 0; i < lookups; i++) {
+                           env.vulkan_functions.vkGetInstanceProcAddr(inst, name);
+                       }
+                   }));
+            report(label + "1000 vkGetDeviceProcAddr(" + name + ")", time_iterations(iterations, [&]() {
+                       for (uint32_t i = 0; i < lookups; i++) {
+                           env.vulkan_functions.vkGetDeviceProcAddr(dev, name);
+                       }
+                   }));
+        }
+    }
+}
+
+// Matches loader_test_set_device_dispatch_through_terminator in loader/loader.h, which loaders built with
+// LOADER_ENABLE_TEST_HOOKS export
+using PFN_loader_test_set_device_dispatch_through_terminator = void(VKAPI_PTR*)(VkBool32 enable);
+
+// vkCreateDevice with no layers, where the loader fills the device dispatch table straight from the driver, compared with the
+// baseline of filling it through loader_gpa_device_terminator as was done before, and with a single pass-through layer, where
+// every entry is still resolved through the layer and loader_gpa_device_terminator.
+// The baseline needs a loader built with LOADER_ENABLE_TEST_HOOKS, and is skipped otherwise.
+TEST(DeviceDispatchTable, NoLayersVersusTerminatorAndPassThroughLayer) {
+    const uint32_t iterations = 200;
+
+    FrameworkEnvironment env{false};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().add_generated_physical_devices(1);
+    auto layer_names = env.add_pass_through_layers(1);
+
+    PFN_loader_test_set_device_dispatch_through_terminator set_dispatch_through_terminator = nullptr;
+#if !defined(BUILD_STATIC_LOADER) && !defined(_WIN32)
+    set_dispatch_through_terminator = env.vulkan_functions.loader.find_symbol("loader_test_set_device_dispatch_through_terminator");
+#endif
+    if (set_dispatch_through_terminator == nullptr) {
+        std::cout << "[ BENCHMARK] no layers, through loader_gpa_device_terminator: skipped, the loader wasn't built with "
+                     "LOADER_ENABLE_TEST_HOOKS\n";
+    }
+
+    struct Configuration {
+        const char* name;
+        bool through_terminator;
+        bool enable_layer;
+    };
+    for (auto const& configuration : {Configuration{"no layers, through loader_gpa_device_terminator", true, false},
+                                      Configuration{"no layers", false, false}, Configuration{"pass-through layer", false, true}}) {
+        if (configuration.through_terminator && set_dispatch_through_terminator == nullptr) {
+            continue;
+        }
+        InstWrapper inst{env.vulkan_functions};
+        if (configuration.enable_layer) {
+            inst.create_info.add_layer(layer_names[0].c_str());
+        }
+        inst.CheckCreate();
+        auto phys_dev = inst.GetPhysDev();
+
+        if (configuration.through_terminator) {
+            set_dispatch_through_terminator(VK_TRUE);
+        }
+        report(std::string(configuration.name) + ": vkCreateDevice/vkDestroyDevice", time_iterations(iterations, [&]() {
+                   DeviceWrapper dev{inst};
+                   dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+                   dev.CheckCreate(phys_dev);
+               }));
+
+        // Every way of filling in the table has to end up calling the driver
+        {
+            DeviceWrapper dev{inst};
+            dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+            dev.CheckCreate(phys_dev);
+            VkQueue queue = VK_NULL_HANDLE;
+            env.vulkan_functions.vkGetDeviceQueue(dev, 0, 0, &queue);
+            EXPECT_NE(queue, VK_NULL_HANDLE);
+        }
+        if (configuration.through_terminator) {
+            set_dispatch_through_terminator(VK_FALSE);
+        }
+    }
+}
+
+// Many threads sharing one instance, which shows how much the loader serializes on its global locks (loader_lock and
+// loader_global_instance_list_lock) for common queries and for device creation.
+TEST(ThreadScaling, SharedInstance) {
+    const uint32_t physical_device_count = 4;
+
+    FrameworkEnvironment env{false};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    env.get_test_icd().add_generated_physical_devices(physical_device_count);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    auto phys_devs = inst.GetPhysDevs(physical_device_count);
+
+    DeviceWrapper shared_dev{inst};
+    shared_dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+    shared_dev.CheckCreate(phys_devs[0]);
+
+    std::vector<std::string> unknown_device_function_names;
+    for (uint32_t i = 0; i < 16; i++) {
+        unknown_device_function_names.push_back("vkUnknownBenchmarkDeviceFunction_" + std::to_string(i));
+    }
+
+    report_thread_scaling("vkGetInstanceProcAddr", 10000,
+                          [&](uint32_t) { env.vulkan_functions.vkGetInstanceProcAddr(inst, "vkCreateDevice"); });
+
+    report_thread_scaling("vkGetDeviceProcAddr (unknown names)", 10000, [&](uint32_t i) {
+        env.vulkan_functions.vkGetDeviceProcAddr(
+            shared_dev, unknown_device_function_names[i % unknown_device_function_names.size()].c_str());
+    });
+
+    report_thread_scaling("vkEnumeratePhysicalDevices", 1000, [&](uint32_t) {
+        std::array<VkPhysicalDevice, physical_device_count> devices{};
+        uint32_t count = physical_device_count;
+        env.vulkan_functions.vkEnumeratePhysicalDevices(inst, &count, devices.data());
+    });
+
+    report_thread_scaling("vkCreateDevice/vkDestroyDevice", 100, [&](uint32_t i) {
+        DeviceWrapper dev{inst};
+        dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+        dev.CheckCreate(phys_devs[i % physical_device_count]);
+    });
+}
@@ -28,6 +28,10 @@
 
 #include "test_environment.h"
 
+#include <atomic>
+#include <memory>
+#include <thread>
+
 //
 // VK_EXT_debug_report specific tests
 // =========================================
@@ -1009,3 +1013,244 @@ TEST(GetDeviceProcAddr, DebugFuncsWithTerminator) {
     ASSERT_NO_FATAL_FAILURE(CheckDeviceFunctions(env, true, false));
     ASSERT_NO_FATAL_FAILURE(CheckDeviceFunctions(env, true, true));
 }
+
+struct DestroyedMessengerState {
+    std::atomic<bool> destroyed{false};
+    std::atomic<uint32_t> calls_after_destroy{0};
+};
+
+VKAPI_ATTR VkBool32 VKAPI_CALL destroyed_messenger_callback(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                            const VkDebugUtilsMessengerCallbackDataEXT*, void* user_data) {
+    auto state = static_cast<DestroyedMessengerState*>(user_data);
+    // Give the destroying thread time to get ahead of this call
+    std::this_thread::yield();
+    if (state->destroyed) {
+        state->calls_after_destroy++;
+    }
+    return VK_FALSE;
+}
+
+// The callbacks are read without a lock, so a message may be walking a messenger while it is destroyed. Destroying it has to wait
+// for that message, since the application may free what pUserData points to as soon as vkDestroyDebugUtilsMessengerEXT returns.
+TEST(DestroyDebugUtilsMessenger, NotCalledAfterDestroyReturns) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    inst.CheckCreate();
+
+    PFN_vkCreateDebugUtilsMessengerEXT create_messenger = inst.load("vkCreateDebugUtilsMessengerEXT");
+    PFN_vkDestroyDebugUtilsMessengerEXT destroy_messenger = inst.load("vkDestroyDebugUtilsMessengerEXT");
+    PFN_vkSubmitDebugUtilsMessageEXT submit_message = inst.load("vkSubmitDebugUtilsMessageEXT");
+    ASSERT_NE(nullptr, create_messenger);
+    ASSERT_NE(nullptr, destroy_messenger);
+    ASSERT_NE(nullptr, submit_message);
+
+    std::atomic<bool> stop_logging{false};
+    std::thread logging_thread([&]() {
+        VkDebugUtilsMessengerCallbackDataEXT callback_data{VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT};
+        callback_data.pMessageIdName = "destroy";
+        callback_data.pMessage = "logged while the messenger is destroyed";
+        while (!stop_logging) {
+            submit_message(inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT,
+                           &callback_data);
+        }
+    });
+
+    // Each messenger gets its own state, so that a late call is counted against the messenger it was made for
+    const uint32_t messenger_count = 500;
+    std::vector<std::unique_ptr<DestroyedMessengerState>> states;
+    for (uint32_t i = 0; i < messenger_count; i++) {
+        states.emplace_back(new DestroyedMessengerState());
+
+        VkDebugUtilsMessengerCreateInfoEXT messenger_info{VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+        messenger_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
+        messenger_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT;
+        messenger_info.pfnUserCallback = destroyed_messenger_callback;
+        messenger_info.pUserData = states.back().get();
+        VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+        VkResult res = create_messenger(inst, &messenger_info, nullptr, &messenger);
+        EXPECT_EQ(VK_SUCCESS, res);
+        if (VK_SUCCESS != res) break;
+        std::this_thread::yield();
+        destroy_messenger(inst, messenger, nullptr);
+        states.back()->destroyed = true;
+    }
+
+    stop_logging = true;
+    logging_thread.join();
+    for (size_t i = 0; i < states.size(); i++) {
+        ASSERT_EQ(0U, states[i]->calls_after_destroy.load()) << "Messenger " << i << " was called after it was destroyed";
+    }
+}
+
+// Tools such as vk_startup_profiler parse the performance messages, so their format must stay the same
+TEST(LoaderPerfMessages, StructuredFormat) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+    const char* layer_name = "VK_LAYER_perf_messages";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "perf_messages_layer.json");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_layer(layer_name);
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+
+    std::string driver_path = " path=" + env.get_test_icd_path().str();
+    std::string layer_path = " path=" + env.get_test_layer_path().str();
+    ASSERT_TRUE(env.debug_log.find_prefix_then_postfix("loader_perf: manifest_read kind=driver us=", ".json"));
+    ASSERT_TRUE(env.debug_log.find_prefix_then_postfix("loader_perf: manifest_read kind=layer us=", "perf_messages_layer.json"));
+    ASSERT_TRUE(env.debug_log.find_prefix_then_postfix("loader_perf: library_load kind=driver us=", driver_path.c_str()));
+    ASSERT_TRUE(env.debug_log.find_prefix_then_postfix("loader_perf: library_load kind=layer us=", layer_path.c_str()));
+    ASSERT_TRUE(env.debug_log.find_prefix_then_postfix("loader_perf: driver_create_instance us=", driver_path.c_str()));
+}
+
+// The static loader reads VK_LOADER_LOG_RATE_LIMIT once at process startup, so it can't be changed per test.
+#if !defined(BUILD_STATIC_LOADER)
+// Repeatedly trigger the same loader message and make sure VK_LOADER_LOG_RATE_LIMIT bounds the number of callbacks
+TEST(LoaderLogRateLimit, RepeatedMessagesSuppressed) {
+    EnvVarCleaner rate_limit_cleaner("VK_LOADER_LOG_RATE_LIMIT");
+    set_env_var("VK_LOADER_LOG_RATE_LIMIT", "5");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.push_back({});
+    env.get_test_icd().physical_devices.push_back({});
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    inst.CheckCreate();
+
+    DebugUtilsWrapper log{inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT};
+    ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(log));
+
+    const uint32_t repeat_count = 2500;
+    for (uint32_t i = 0; i < repeat_count; i++) {
+        uint32_t count = 1;
+        VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+        ASSERT_EQ(VK_INCOMPLETE, inst->vkEnumeratePhysicalDevices(inst, &count, &phys_dev));
+    }
+
+    // The first 5 messages get through, after which a summary is emitted every 1000 suppressed repeats
+    const size_t trimmed_count = log.logger.count("Trimming device count from 2 to 1");
+    const size_t summary_count = log.logger.count("loader_log: Suppressed 1000 repeats of message");
+    ASSERT_EQ(trimmed_count, 5U + summary_count);
+    ASSERT_EQ(summary_count, 2U);
+}
+
+// Messages which reach neither stderr nor a debug callback don't count towards VK_LOADER_LOG_RATE_LIMIT
+TEST(LoaderLogRateLimit, DroppedMessagesArentCounted) {
+    EnvVarCleaner rate_limit_cleaner("VK_LOADER_LOG_RATE_LIMIT");
+    set_env_var("VK_LOADER_LOG_RATE_LIMIT", "5");
+    remove_env_var("VK_LOADER_DEBUG");
+
+    FrameworkEnvironment env{false};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.push_back({});
+    env.get_test_icd().physical_devices.push_back({});
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    inst.CheckCreate();
+
+    const uint32_t repeat_count = 100;
+    for (uint32_t i = 0; i < repeat_count; i++) {
+        uint32_t count = 1;
+        VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+        ASSERT_EQ(VK_INCOMPLETE, inst->vkEnumeratePhysicalDevices(inst, &count, &phys_dev));
+    }
+
+    DebugUtilsWrapper log{inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT};
+    ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(log));
+    for (uint32_t i = 0; i < repeat_count; i++) {
+        uint32_t count = 1;
+        VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+        ASSERT_EQ(VK_INCOMPLETE, inst->vkEnumeratePhysicalDevices(inst, &count, &phys_dev));
+    }
+    ASSERT_EQ(log.logger.count("Trimming device count from 2 to 1"), 5U);
+}
+
+// Messages from the same logging location with different text are limited separately
+TEST(LoaderLogRateLimit, DifferentTextIsntARepeat) {
+    EnvVarCleaner rate_limit_cleaner("VK_LOADER_LOG_RATE_LIMIT");
+    set_env_var("VK_LOADER_LOG_RATE_LIMIT", "5");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.push_back({});
+    env.get_test_icd().physical_devices.push_back({});
+    env.get_test_icd().physical_devices.push_back({});
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    inst.CheckCreate();
+
+    DebugUtilsWrapper log{inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT};
+    ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(log));
+
+    const uint32_t repeat_count = 20;
+    for (uint32_t i = 0; i < repeat_count; i++) {
+        uint32_t count = 1 + (i % 2);
+        std::array<VkPhysicalDevice, 2> phys_devs{};
+        ASSERT_EQ(VK_INCOMPLETE, inst->vkEnumeratePhysicalDevices(inst, &count, phys_devs.data()));
+    }
+    ASSERT_EQ(log.logger.count("Trimming device count from 3 to 1"), 5U);
+    ASSERT_EQ(log.logger.count("Trimming device count from 3 to 2"), 5U);
+}
+
+// The repeats which haven't reached the periodic summary yet are summarized when the instance is destroyed
+TEST(LoaderLogRateLimit, PendingRepeatsSummarizedOnDestroy) {
+    EnvVarCleaner rate_limit_cleaner("VK_LOADER_LOG_RATE_LIMIT");
+    set_env_var("VK_LOADER_LOG_RATE_LIMIT", "5");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.push_back({});
+    env.get_test_icd().physical_devices.push_back({});
+
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+
+        const uint32_t repeat_count = 12;
+        for (uint32_t i = 0; i < repeat_count; i++) {
+            uint32_t count = 1;
+            VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+            ASSERT_EQ(VK_INCOMPLETE, inst->vkEnumeratePhysicalDevices(inst, &count, &phys_dev));
+        }
+        ASSERT_FALSE(env.debug_log.find("loader_log: Suppressed"));
+    }
+    ASSERT_TRUE(env.debug_log.find("loader_log: Suppressed 7 repeats of message"));
+}
+#endif  // !defined(BUILD_STATIC_LOADER)
+
+// Without VK_LOADER_LOG_RATE_LIMIT every message should reach the callback
+TEST(LoaderLogRateLimit, DisabledByDefault) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.push_back({});
+    env.get_test_icd().physical_devices.push_back({});
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    inst.CheckCreate();
+
+    DebugUtilsWrapper log{inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT};
+    ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(log));
+
+    const uint32_t repeat_count = 100;
+    for (uint32_t i = 0; i < repeat_count; i++) {
+        uint32_t count = 1;
+        VkPhysicalDevice phys_dev = VK_NULL_HANDLE;
+        ASSERT_EQ(VK_INCOMPLETE, inst->vkEnumeratePhysicalDevices(inst, &count, &phys_dev));
+    }
+    ASSERT_EQ(log.logger.count("Trimming device count from 2 to 1"), repeat_count);
+    ASSERT_FALSE(log.find("loader_log: Suppressed"));
+}
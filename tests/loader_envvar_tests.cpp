@@ -28,6 +28,14 @@
 
 #include "test_environment.h"
 
+#include <atomic>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 class EnvVarICDOverrideSetup : public ::testing::Test {
    protected:
     virtual void SetUp() {
@@ -710,3 +718,101 @@ TEST(EnvVarICDOverrideSetup, FilterSelectAndDisableDriver) {
     ASSERT_FALSE(env.debug_log.find_prefix_then_postfix("CDE_ICD.json", "ignored because not selected by env var"));
     ASSERT_FALSE(env.debug_log.find_prefix_then_postfix("CDE_ICD.json", "ignored because it was disabled by env var"));
 }
+
+// The static loader reads VK_LOADER_FORK_SAFE once at process startup, so it can't be changed per test.
+#if !defined(_WIN32) && !defined(BUILD_STATIC_LOADER)
+// Googletest assertions don't work in a forked child, so this reports failure through the return value instead
+bool child_creates_instance(VulkanFunctions& functions, uint32_t expected_physical_device_count) {
+    InstanceCreateInfo create_info{};
+    VkInstance inst = VK_NULL_HANDLE;
+    if (VK_SUCCESS != functions.vkCreateInstance(create_info.get(), nullptr, &inst)) {
+        return false;
+    }
+    uint32_t physical_device_count = 0;
+    VkResult res = functions.vkEnumeratePhysicalDevices(inst, &physical_device_count, nullptr);
+    functions.vkDestroyInstance(inst, nullptr);
+    return VK_SUCCESS == res && physical_device_count == expected_physical_device_count;
+}
+
+// Discover the drivers in the parent, remove their manifests, then fork while other threads are creating instances.
+// The children must still find the drivers, which means they didn't search the manifest directories again, and must not
+// deadlock on a lock which was held by one of the other threads.
+TEST(ForkSafe, ForkAfterDriverDiscovery) {
+    EnvVarCleaner fork_safe_cleaner("VK_LOADER_FORK_SAFE");
+    set_env_var("VK_LOADER_FORK_SAFE", "1");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDev();
+    }
+
+    env.get_folder(ManifestLocation::driver).remove(env.get_icd_manifest_path().filename().str());
+
+    std::atomic_bool stop_threads{false};
+    std::vector<std::thread> instance_creation_threads;
+    for (uint32_t i = 0; i < 4; i++) {
+        instance_creation_threads.emplace_back([&env, &stop_threads]() {
+            while (!stop_threads) {
+                InstWrapper inst{env.vulkan_functions};
+                inst.CheckCreate();
+            }
+        });
+    }
+
+    std::vector<int> child_statuses;
+    for (uint32_t i = 0; i < 8; i++) {
+        pid_t pid = fork();
+        if (0 == pid) {
+            _exit(child_creates_instance(env.vulkan_functions, 1) ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        int status = -1;
+        if (-1 == pid || pid != waitpid(pid, &status, 0)) {
+            status = -1;
+        }
+        child_statuses.push_back(status);
+    }
+
+    stop_threads = true;
+    for (auto& thread : instance_creation_threads) {
+        thread.join();
+    }
+
+    for (int status : child_statuses) {
+        ASSERT_TRUE(WIFEXITED(status));
+        ASSERT_EQ(WEXITSTATUS(status), EXIT_SUCCESS);
+    }
+
+    // The parent keeps using the same driver list
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    inst.GetPhysDev();
+}
+
+// Changing the driver manifest environment variables makes the loader search for the driver manifests again
+TEST(ForkSafe, DriverManifestEnvVarChangesAreFound) {
+    EnvVarCleaner fork_safe_cleaner("VK_LOADER_FORK_SAFE");
+    set_env_var("VK_LOADER_FORK_SAFE", "1");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2).set_discovery_type(ManifestDiscoveryType::env_var));
+    env.get_test_icd(0).physical_devices.emplace_back("physical_device_0");
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDevs(1);
+    }
+
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2).set_discovery_type(ManifestDiscoveryType::env_var));
+    env.get_test_icd(1).physical_devices.emplace_back("physical_device_1");
+
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+    inst.GetPhysDevs(2);
+    ASSERT_TRUE(env.debug_log.find("Searching for driver manifests again as the driver manifest environment variables changed"));
+}
+#endif  // !defined(_WIN32) && !defined(BUILD_STATIC_LOADER)
@@ -1268,6 +1268,57 @@ TEST(MetaLayers, DeviceExtensionInComponentLayer) {
     }
 }
 
+// The set of layers to activate is resolved once per vkCreateInstance and shared between extension validation and building
+// the instance chain, so the filter env-vars are applied and meta-layers expanded only once.
+TEST(MetaLayers, LayerSetResolvedOncePerCreateInstance) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    env.get_test_icd().add_physical_device({});
+    const char* meta_layer_name = "VK_LAYER_MetaTestLayer";
+    const char* regular_layer_name = "VK_LAYER_TestLayer";
+    const char* disabled_layer_name = "VK_LAYER_DisabledTestLayer";
+    const char* forced_layer_name = "VK_LAYER_ForcedTestLayer";
+    const char* instance_ext_name = "VK_EXT_headless_surface";
+    env.add_explicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                         .set_name(regular_layer_name)
+                                                         .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                         .add_instance_extension({instance_ext_name})),
+                           "regular_test_layer.json");
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(disabled_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "disabled_test_layer.json");
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(forced_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "forced_test_layer.json");
+    env.add_explicit_layer(ManifestLayer{}
+                               .set_file_format_version(ManifestVersion(1, 1, 2))
+                               .add_layer(ManifestLayer::LayerDescription{}
+                                              .set_name(meta_layer_name)
+                                              .add_component_layers({regular_layer_name, disabled_layer_name})),
+                           "meta_test_layer.json");
+
+    EnvVarCleaner layers_enable_cleaner("VK_LOADER_LAYERS_ENABLE");
+    EnvVarCleaner layers_disable_cleaner("VK_LOADER_LAYERS_DISABLE");
+    set_env_var("VK_LOADER_LAYERS_ENABLE", forced_layer_name);
+    set_env_var("VK_LOADER_LAYERS_DISABLE", disabled_layer_name);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_layer(meta_layer_name);
+    // The extension only comes from a component layer, so validation must see the expanded meta-layer
+    inst.create_info.add_extension(instance_ext_name);
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+
+    EXPECT_EQ(1U, env.debug_log.count(std::string("Layer \"") + forced_layer_name + "\" forced enabled due to env var"));
+    EXPECT_EQ(1U, env.debug_log.count(std::string("Meta Layer \"") + meta_layer_name + "\" component layer \"" +
+                                      disabled_layer_name + "\" disabled."));
+    EXPECT_TRUE(env.debug_log.find_prefix_then_postfix("Insert instance layer", regular_layer_name));
+    EXPECT_TRUE(env.debug_log.find_prefix_then_postfix("Insert instance layer", forced_layer_name));
+    EXPECT_FALSE(env.debug_log.find_prefix_then_postfix("Insert instance layer", disabled_layer_name));
+}
+
 // Override meta layer missing disable environment variable still enables the layer
 TEST(OverrideMetaLayer, InvalidDisableEnvironment) {
     FrameworkEnvironment env;
@@ -2022,6 +2073,28 @@ TEST(LayerCreateInstance, GetPhysicalDeviceProperties2KHR) {
     inst.CheckCreate();
 }
 
+TEST(ExplicitLayers, DeepPassThroughChain) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().add_generated_physical_devices(1);
+    auto layer_names = env.add_pass_through_layers(10);
+
+    InstWrapper inst{env.vulkan_functions};
+    for (auto const& layer_name : layer_names) {
+        inst.create_info.add_layer(layer_name.c_str());
+    }
+    inst.CheckCreate();
+
+    auto phys_dev = inst.GetPhysDev();
+    uint32_t count = 0;
+    env.vulkan_functions.vkEnumerateDeviceLayerProperties(phys_dev, &count, nullptr);
+    ASSERT_EQ(count, layer_names.size());
+
+    DeviceWrapper dev{inst};
+    dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+    dev.CheckCreate(phys_dev);
+}
+
 TEST(ExplicitLayers, WrapObjects) {
     FrameworkEnvironment env;
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
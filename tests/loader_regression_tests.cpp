@@ -27,6 +27,9 @@
 
 #include "test_environment.h"
 
+#include <sys/types.h>
+#include <sys/stat.h>
+
 // Test case origin
 // LX = lunar exchange
 // LVLGH = loader and validation github
@@ -130,6 +133,586 @@ TEST(CreateInstance, ConsecutiveCreateWithoutDestruction) {
     }
 }
 
+TEST(CreateInstanceAsync, MatchesSynchronousCreation) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    const auto latency = std::chrono::milliseconds(250);
+    auto& driver = env.get_test_icd().set_create_instance_latency(latency);
+    driver.physical_devices.emplace_back("physical_device_0");
+    driver.physical_devices.emplace_back("physical_device_1");
+
+    InstanceCreateInfo create_info;
+    create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+
+    auto start = std::chrono::steady_clock::now();
+    VkLoaderPendingInstance pending = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vk_loaderCreateInstanceAsync(create_info.get(), nullptr, &pending));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    // The calling thread should not have to wait for the driver
+    ASSERT_LT(elapsed, latency);
+    ASSERT_EQ(VK_NOT_READY, env.vulkan_functions.vk_loaderGetPendingInstanceStatus(pending));
+
+    VkInstance async_instance = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vk_loaderWaitForPendingInstance(pending, &async_instance));
+    handle_assert_has_value(async_instance);
+    InstWrapper async_inst{env.vulkan_functions, async_instance};
+
+    InstWrapper sync_inst{env.vulkan_functions};
+    sync_inst.create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    sync_inst.CheckCreate();
+
+    auto async_phys_devs = async_inst.GetPhysDevs(2);
+    auto sync_phys_devs = sync_inst.GetPhysDevs(2);
+    for (uint32_t i = 0; i < 2; i++) {
+        VkPhysicalDeviceProperties async_props{};
+        VkPhysicalDeviceProperties sync_props{};
+        env.vulkan_functions.vkGetPhysicalDeviceProperties(async_phys_devs[i], &async_props);
+        env.vulkan_functions.vkGetPhysicalDeviceProperties(sync_phys_devs[i], &sync_props);
+        ASSERT_TRUE(string_eq(async_props.deviceName, sync_props.deviceName));
+    }
+    // The extension was enabled on both instances, so the extension functions should be available from both
+    PFN_vkCreateDebugUtilsMessengerEXT async_create_messenger = async_inst.load("vkCreateDebugUtilsMessengerEXT");
+    PFN_vkCreateDebugUtilsMessengerEXT sync_create_messenger = sync_inst.load("vkCreateDebugUtilsMessengerEXT");
+    ASSERT_NE(nullptr, async_create_messenger);
+    ASSERT_NE(nullptr, sync_create_messenger);
+}
+
+TEST(CreateInstanceAsync, PollUntilComplete) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().set_create_instance_latency(std::chrono::milliseconds(50));
+
+    InstanceCreateInfo create_info;
+    VkLoaderPendingInstance pending = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vk_loaderCreateInstanceAsync(create_info.get(), nullptr, &pending));
+
+    VkResult status = VK_NOT_READY;
+    while (VK_NOT_READY == (status = env.vulkan_functions.vk_loaderGetPendingInstanceStatus(pending))) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(VK_SUCCESS, status);
+
+    VkInstance instance = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vk_loaderWaitForPendingInstance(pending, &instance));
+    InstWrapper inst{env.vulkan_functions, instance};
+    inst.GetPhysDev();
+}
+
+TEST(CreateInstanceAsync, ErrorMatchesSynchronousCreation) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().set_create_instance_latency(std::chrono::milliseconds(10));
+
+    InstanceCreateInfo create_info;
+    create_info.add_extension("Non_existant_extension");
+    VkLoaderPendingInstance pending = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vk_loaderCreateInstanceAsync(create_info.get(), nullptr, &pending));
+
+    VkInstance instance = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_ERROR_EXTENSION_NOT_PRESENT, env.vulkan_functions.vk_loaderWaitForPendingInstance(pending, &instance));
+    handle_assert_null(instance);
+
+    InstWrapper sync_inst{env.vulkan_functions};
+    sync_inst.create_info.add_extension("Non_existant_extension");
+    sync_inst.CheckCreate(VK_ERROR_EXTENSION_NOT_PRESENT);
+}
+
+// The static loader keeps the drivers it has seen and the ones which timed out for the whole test process, which these
+// tests expect to start out empty.
+#if !defined(BUILD_STATIC_LOADER)
+TEST(LazyDriverInstances, DisabledByDefault) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    ASSERT_EQ(env.get_test_icd().create_instance_call_count, 1U);
+}
+
+TEST(LazyDriverInstances, CreatedWhenPhysicalDevicesAreEnumerated) {
+    EnvVarCleaner lazy_cleaner("VK_LOADER_LAZY_DRIVER_INSTANCES");
+    set_env_var("VK_LOADER_LAZY_DRIVER_INSTANCES", "1");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(0).physical_devices.emplace_back("physical_device_0");
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(1).physical_devices.emplace_back("physical_device_1");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 0U);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 0U);
+
+    auto phys_devs = inst.GetPhysDevs(2);
+    ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 1U);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+
+    // Enumerating again must not create the driver instances a second time
+    inst.GetPhysDevs(2);
+    ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 1U);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+
+    DeviceWrapper dev{inst};
+    dev.CheckCreate(phys_devs[0]);
+}
+
+// Strict mode trusts that a driver without physical devices stays without them, however much time passes
+TEST(LazyDriverInstances, DriversWithoutPhysicalDevicesAreNeverInstantiatedAgain) {
+    EnvVarCleaner lazy_cleaner("VK_LOADER_LAZY_DRIVER_INSTANCES");
+    set_env_var("VK_LOADER_LAZY_DRIVER_INSTANCES", "2");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(0).physical_devices.emplace_back("physical_device_0");
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(2).physical_devices.emplace_back("physical_device_2");
+
+    {
+        // Nothing is known about the drivers yet, so all of them have to be asked for their physical devices
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDevs(2);
+        ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 1U);
+        ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+        ASSERT_EQ(env.get_test_icd(2).create_instance_call_count, 1U);
+    }
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        auto phys_devs = inst.GetPhysDevs(2);
+        ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 2U);
+        ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+        ASSERT_EQ(env.get_test_icd(2).create_instance_call_count, 2U);
+
+        // The order of the physical devices is unchanged by skipping the empty driver
+        InstWrapper eager_inst{env.vulkan_functions};
+        remove_env_var("VK_LOADER_LAZY_DRIVER_INSTANCES");
+        eager_inst.CheckCreate();
+        auto eager_phys_devs = eager_inst.GetPhysDevs(2);
+        for (uint32_t i = 0; i < 2; i++) {
+            VkPhysicalDeviceProperties props{};
+            VkPhysicalDeviceProperties eager_props{};
+            env.vulkan_functions.vkGetPhysicalDeviceProperties(phys_devs[i], &props);
+            env.vulkan_functions.vkGetPhysicalDeviceProperties(eager_phys_devs[i], &eager_props);
+            ASSERT_TRUE(string_eq(props.deviceName, eager_props.deviceName));
+        }
+    }
+}
+
+// Outside of strict mode a driver which reported no physical devices is asked again once the environment it was asked in
+// changes, as that may be what the driver picks its devices with
+TEST(LazyDriverInstances, DriversWithoutPhysicalDevicesAreCheckedAgainWhenTheEnvironmentChanges) {
+    EnvVarCleaner lazy_cleaner("VK_LOADER_LAZY_DRIVER_INSTANCES");
+    set_env_var("VK_LOADER_LAZY_DRIVER_INSTANCES", "1");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(0).physical_devices.emplace_back("physical_device_0");
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDevs(1);
+        ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+    }
+
+    // However long it takes, the same environment keeps the driver from being asked again
+    env.get_test_icd(1).physical_devices.emplace_back("physical_device_1");
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDevs(1);
+        ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+    }
+
+    // The loader can't tell which environment variables a driver reads, so a change to any of them counts
+    EnvVarCleaner unrelated_cleaner("VK_LAZY_DRIVER_INSTANCES_TEST_VAR");
+    set_env_var("VK_LAZY_DRIVER_INSTANCES_TEST_VAR", "1");
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDevs(2);
+        ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 2U);
+    }
+}
+
+static void test_vkLazyDriverInstancesTestFunc(VkDevice) {}
+
+// Each driver's instance is only created when that driver is first needed, so looking up a function which the first driver
+// supports doesn't create the instances of the others
+TEST(LazyDriverInstances, DriversAreCreatedOneAtATime) {
+    EnvVarCleaner lazy_cleaner("VK_LOADER_LAZY_DRIVER_INSTANCES");
+    set_env_var("VK_LOADER_LAZY_DRIVER_INSTANCES", "1");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(0).physical_devices.emplace_back("physical_device_0");
+    env.get_test_icd(0).physical_devices.back().add_device_function(
+        VulkanFunction{"vkLazyDriverInstancesTestFunc", to_vkVoidFunction(test_vkLazyDriverInstancesTestFunc)});
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(1).physical_devices.emplace_back("physical_device_1");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    ASSERT_NE(nullptr, env.vulkan_functions.vkGetInstanceProcAddr(inst, "vkLazyDriverInstancesTestFunc"));
+    ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 1U);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 0U);
+
+    inst.GetPhysDevs(2);
+    ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 1U);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+}
+
+TEST(DriverTimeout, SlowCreateInstanceIsSkipped) {
+    EnvVarCleaner timeout_cleaner("VK_LOADER_DRIVER_TIMEOUT_MS");
+    set_env_var("VK_LOADER_DRIVER_TIMEOUT_MS", "50");
+
+    FrameworkEnvironment env{};
+    const auto latency = std::chrono::milliseconds(500);
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(0).set_create_instance_latency(latency).physical_devices.emplace_back("slow_physical_device");
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(1).physical_devices.emplace_back("fast_physical_device");
+
+    auto start = std::chrono::steady_clock::now();
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+    // The slow driver is given up on rather than waited for
+    ASSERT_LT(std::chrono::steady_clock::now() - start, latency);
+    ASSERT_TRUE(env.debug_log.find("allowed by VK_LOADER_DRIVER_TIMEOUT_MS"));
+
+    auto phys_devs = inst.GetPhysDevs(1);
+    VkPhysicalDeviceProperties props{};
+    env.vulkan_functions.vkGetPhysicalDeviceProperties(phys_devs[0], &props);
+    ASSERT_TRUE(string_eq(props.deviceName, "fast_physical_device"));
+
+    // The abandoned call still uses the driver, so let it return before the driver is reset by the next test
+    std::this_thread::sleep_for(latency);
+}
+
+TEST(DriverTimeout, SlowNegotiationIsSkipped) {
+    EnvVarCleaner timeout_cleaner("VK_LOADER_DRIVER_TIMEOUT_MS");
+    set_env_var("VK_LOADER_DRIVER_TIMEOUT_MS", "50");
+
+    FrameworkEnvironment env{};
+    const auto latency = std::chrono::milliseconds(500);
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(0).set_negotiate_interface_latency(latency).physical_devices.emplace_back("slow_physical_device");
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(1).physical_devices.emplace_back("fast_physical_device");
+
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find("allowed by VK_LOADER_DRIVER_TIMEOUT_MS to load"));
+        ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 0U);
+        inst.GetPhysDevs(1);
+    }
+
+    // Without a quarantine file the driver is still remembered, so later instances skip it rather than wait for it again
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find("exceeded VK_LOADER_DRIVER_TIMEOUT_MS earlier in this process"));
+        ASSERT_EQ(env.get_test_icd(0).negotiate_interface_call_count, 1U);
+        inst.GetPhysDevs(1);
+    }
+
+    std::this_thread::sleep_for(latency);
+}
+
+// A driver which hangs in the constructors of its library is given up on like one which hangs in a call. On Linux no other
+// library can be opened until those constructors return, so the drivers after it are left for the next scan.
+TEST(DriverTimeout, SlowLibraryConstructorIsSkipped) {
+    EnvVarCleaner timeout_cleaner("VK_LOADER_DRIVER_TIMEOUT_MS");
+    EnvVarCleaner constructor_latency_cleaner("VK_TEST_ICD_CONSTRUCTOR_LATENCY_MS");
+    set_env_var("VK_LOADER_DRIVER_TIMEOUT_MS", "50");
+
+    FrameworkEnvironment env{};
+    const auto latency = std::chrono::milliseconds(500);
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("fast_physical_device");
+
+    // Constructors only run when a library is first opened, and the framework opens the libraries of the drivers it adds, so
+    // the slow driver is a copy which only the loader opens
+    auto& folder = env.get_folder(ManifestLocation::driver);
+    fs::path slow_driver =
+        folder.copy_file(TEST_ICD_PATH_VERSION_2, "slow_constructor_icd" + fs::path(TEST_ICD_PATH_VERSION_2).extension().str());
+    auto slow_manifest = ManifestICD().set_lib_path(slow_driver.str()).set_api_version(VK_API_VERSION_1_0);
+    env.platform_shim->add_manifest(ManifestCategory::icd,
+                                    folder.write_manifest("slow_constructor_icd.json", slow_manifest.get_manifest_str()));
+    set_env_var("VK_TEST_ICD_CONSTRUCTOR_LATENCY_MS", std::to_string(latency.count()));
+
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find("slow_constructor_icd"));
+        ASSERT_TRUE(env.debug_log.find("allowed by VK_LOADER_DRIVER_TIMEOUT_MS to load"));
+
+        auto phys_devs = inst.GetPhysDevs(1);
+        VkPhysicalDeviceProperties props{};
+        env.vulkan_functions.vkGetPhysicalDeviceProperties(phys_devs[0], &props);
+        ASSERT_TRUE(string_eq(props.deviceName, "fast_physical_device"));
+    }
+
+    // Later instances don't try to open it again
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find("exceeded VK_LOADER_DRIVER_TIMEOUT_MS earlier in this process"));
+        inst.GetPhysDevs(1);
+    }
+
+    // The abandoned call runs loader code until the library finishes opening
+    std::this_thread::sleep_for(latency);
+}
+
+// Drivers after one whose library is still opening would only time out waiting for it, so they aren't loaded by that scan, nor
+// quarantined, and later scans load them as usual
+TEST(DriverTimeout, SlowLibraryConstructorDoesntQuarantineLaterDrivers) {
+    EnvVarCleaner timeout_cleaner("VK_LOADER_DRIVER_TIMEOUT_MS");
+    EnvVarCleaner quarantine_cleaner("VK_LOADER_DRIVER_QUARANTINE_FILE");
+    EnvVarCleaner driver_files_cleaner("VK_DRIVER_FILES");
+    EnvVarCleaner constructor_latency_cleaner("VK_TEST_ICD_CONSTRUCTOR_LATENCY_MS");
+    set_env_var("VK_LOADER_DRIVER_TIMEOUT_MS", "50");
+
+    FrameworkEnvironment env{};
+    const auto latency = std::chrono::milliseconds(500);
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2).set_discovery_type(ManifestDiscoveryType::env_var));
+    env.get_test_icd().physical_devices.emplace_back("fast_physical_device");
+    auto& folder = env.get_folder(ManifestLocation::driver);
+    fs::path quarantine_file = folder.location() / "quarantine.txt";
+    folder.add_existing_file("quarantine.txt");
+    set_env_var("VK_LOADER_DRIVER_QUARANTINE_FILE", quarantine_file.str());
+
+    // The slow driver is listed first so that the fast driver comes after it
+    fs::path slow_driver =
+        folder.copy_file(TEST_ICD_PATH_VERSION_2, "slow_constructor_icd" + fs::path(TEST_ICD_PATH_VERSION_2).extension().str());
+    auto slow_manifest = ManifestICD().set_lib_path(slow_driver.str()).set_api_version(VK_API_VERSION_1_0);
+    fs::path slow_manifest_path = folder.write_manifest("slow_constructor_icd.json", slow_manifest.get_manifest_str());
+    set_env_var("VK_DRIVER_FILES", slow_manifest_path.str() + OS_ENV_VAR_LIST_SEPARATOR + get_env_var("VK_DRIVER_FILES"));
+    set_env_var("VK_TEST_ICD_CONSTRUCTOR_LATENCY_MS", std::to_string(latency.count()));
+
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate(VK_ERROR_INCOMPATIBLE_DRIVER);
+        ASSERT_TRUE(env.debug_log.find("allowed by VK_LOADER_DRIVER_TIMEOUT_MS to load"));
+        ASSERT_TRUE(env.debug_log.find("may still be opening"));
+    }
+    std::string quarantined;
+    {
+        std::ifstream file(quarantine_file.str());
+        for (std::string line; std::getline(file, line);) quarantined += line + "\n";
+    }
+    ASSERT_NE(quarantined.find(slow_driver.str()), std::string::npos);
+    ASSERT_EQ(quarantined.find(env.get_test_icd_path().str()), std::string::npos);
+
+    // Once the slow library is open, the fast driver is loaded again
+    std::this_thread::sleep_for(latency);
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    auto phys_devs = inst.GetPhysDevs(1);
+    VkPhysicalDeviceProperties props{};
+    env.vulkan_functions.vkGetPhysicalDeviceProperties(phys_devs[0], &props);
+    ASSERT_TRUE(string_eq(props.deviceName, "fast_physical_device"));
+}
+
+// The validation structures can be copied for the time limited call, so they don't turn the time limit off
+TEST(DriverTimeout, ValidationFeaturesKeepTimeLimit) {
+    EnvVarCleaner timeout_cleaner("VK_LOADER_DRIVER_TIMEOUT_MS");
+    set_env_var("VK_LOADER_DRIVER_TIMEOUT_MS", "50");
+
+    FrameworkEnvironment env{};
+    const auto latency = std::chrono::milliseconds(500);
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(0).set_create_instance_latency(latency).physical_devices.emplace_back("slow_physical_device");
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(1).physical_devices.emplace_back("fast_physical_device");
+
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    VkValidationFeatureEnableEXT enabled_feature = VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT;
+    VkValidationFeaturesEXT features{};
+    features.sType = VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT;
+    features.pNext = inst.create_info.instance_info.pNext;
+    features.enabledValidationFeatureCount = 1;
+    features.pEnabledValidationFeatures = &enabled_feature;
+    inst.create_info.instance_info.pNext = &features;
+
+    auto start = std::chrono::steady_clock::now();
+    inst.CheckCreate();
+    ASSERT_LT(std::chrono::steady_clock::now() - start, latency);
+    ASSERT_TRUE(env.debug_log.find("allowed by VK_LOADER_DRIVER_TIMEOUT_MS"));
+    ASSERT_FALSE(env.debug_log.find("without a time limit"));
+    inst.GetPhysDevs(1);
+
+    // The abandoned call still uses the driver, so let it return before the driver is reset by the next test
+    std::this_thread::sleep_for(latency);
+}
+
+TEST(DriverTimeout, FastDriversAreUnaffected) {
+    EnvVarCleaner timeout_cleaner("VK_LOADER_DRIVER_TIMEOUT_MS");
+    EnvVarCleaner quarantine_cleaner("VK_LOADER_DRIVER_QUARANTINE_FILE");
+    set_env_var("VK_LOADER_DRIVER_TIMEOUT_MS", "5000");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().add_generated_physical_devices(2);
+    fs::path quarantine_file = env.get_folder(ManifestLocation::driver).location() / "quarantine.txt";
+    set_env_var("VK_LOADER_DRIVER_QUARANTINE_FILE", quarantine_file.str());
+
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+    inst.GetPhysDevs(2);
+    ASSERT_EQ(env.get_test_icd().create_instance_call_count, 1U);
+    ASSERT_FALSE(env.debug_log.find("VK_LOADER_DRIVER_TIMEOUT_MS"));
+    // Nothing was quarantined, so the file was never written
+    ASSERT_FALSE(std::ifstream(quarantine_file.str()).good());
+}
+
+TEST(DriverTimeout, TimedOutDriversAreQuarantined) {
+    EnvVarCleaner timeout_cleaner("VK_LOADER_DRIVER_TIMEOUT_MS");
+    EnvVarCleaner quarantine_cleaner("VK_LOADER_DRIVER_QUARANTINE_FILE");
+
+    FrameworkEnvironment env{};
+    const auto latency = std::chrono::milliseconds(500);
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().set_create_instance_latency(latency).physical_devices.emplace_back("physical_device_0");
+    auto& folder = env.get_folder(ManifestLocation::driver);
+    fs::path quarantine_file = folder.location() / "quarantine.txt";
+    folder.add_existing_file("quarantine.txt");
+    set_env_var("VK_LOADER_DRIVER_QUARANTINE_FILE", quarantine_file.str());
+
+    set_env_var("VK_LOADER_DRIVER_TIMEOUT_MS", "50");
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate(VK_ERROR_INCOMPATIBLE_DRIVER);
+        ASSERT_TRUE(env.debug_log.find("later processes skip it until the library changes"));
+    }
+    std::this_thread::sleep_for(latency);
+
+    std::string contents;
+    {
+        std::ifstream file(quarantine_file.str());
+        std::getline(file, contents);
+    }
+    ASSERT_NE(contents.find(" " + env.get_test_icd_path().str()), std::string::npos);
+
+    // The rest of this process skips the driver without loading it, even once it is fast, no timeout is set, and the quarantine
+    // file no longer lists it
+    env.get_test_icd().set_create_instance_latency(std::chrono::microseconds(0));
+    remove_env_var("VK_LOADER_DRIVER_TIMEOUT_MS");
+    {
+        std::ofstream file(quarantine_file.str(), std::ios::trunc);
+    }
+    uint32_t negotiate_call_count = env.get_test_icd().negotiate_interface_call_count;
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate(VK_ERROR_INCOMPATIBLE_DRIVER);
+    ASSERT_TRUE(env.debug_log.find("exceeded VK_LOADER_DRIVER_TIMEOUT_MS earlier in this process"));
+    ASSERT_EQ(env.get_test_icd().negotiate_interface_call_count, negotiate_call_count);
+}
+
+// Stands in for a later process, which only knows about the drivers that timed out from the quarantine file
+TEST(DriverTimeout, QuarantinedDriversAreSkippedUntilTheyChange) {
+    EnvVarCleaner quarantine_cleaner("VK_LOADER_DRIVER_QUARANTINE_FILE");
+
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+    auto& folder = env.get_folder(ManifestLocation::driver);
+    fs::path quarantine_file = folder.location() / "quarantine.txt";
+    folder.add_existing_file("quarantine.txt");
+    set_env_var("VK_LOADER_DRIVER_QUARANTINE_FILE", quarantine_file.str());
+
+    // Each line is "<size> <modification time> <library>", as written for a driver exceeding VK_LOADER_DRIVER_TIMEOUT_MS
+    std::string driver_path = env.get_test_icd_path().str();
+#if defined(_WIN32)
+    struct _stat64 driver_stat {};
+    ASSERT_EQ(0, _stat64(driver_path.c_str(), &driver_stat));
+#else
+    struct stat driver_stat {};
+    ASSERT_EQ(0, stat(driver_path.c_str(), &driver_stat));
+#endif
+    {
+        std::ofstream file(quarantine_file.str(), std::ios::trunc);
+        file << static_cast<uint64_t>(driver_stat.st_size) << " " << static_cast<int64_t>(driver_stat.st_mtime) << " "
+             << driver_path << "\n";
+    }
+
+    // The driver is skipped without being loaded, whether or not a timeout is set
+    uint32_t negotiate_call_count = env.get_test_icd().negotiate_interface_call_count;
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate(VK_ERROR_INCOMPATIBLE_DRIVER);
+        ASSERT_TRUE(env.debug_log.find("ignored because it is quarantined"));
+        ASSERT_EQ(env.get_test_icd().negotiate_interface_call_count, negotiate_call_count);
+    }
+
+    // An entry for a different build of the library no longer applies
+    {
+        std::ofstream file(quarantine_file.str(), std::ios::trunc);
+        file << "0 0 " << driver_path << "\n";
+    }
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    inst.GetPhysDevs(1);
+}
+#endif  // !defined(BUILD_STATIC_LOADER)
+
+TEST(DriverSimulation, GeneratedPhysicalDevicesAndGroups) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    auto& driver = env.get_test_icd().set_min_icd_interface_version(5).set_icd_api_version(VK_API_VERSION_1_1);
+    driver.add_generated_physical_devices(30).add_generated_physical_device_groups(4).add_generated_device_extensions(100);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.set_api_version(VK_API_VERSION_1_1);
+    inst.CheckCreate();
+    auto phys_devs = inst.GetPhysDevs(30);
+    ASSERT_GT(driver.enumerate_physical_devices_call_count, 0U);
+    ASSERT_GT(driver.get_instance_proc_addr_call_count, 0U);
+
+    uint32_t group_count = 0;
+    ASSERT_EQ(VK_SUCCESS, inst->vkEnumeratePhysicalDeviceGroups(inst, &group_count, nullptr));
+    // 7 full groups and a final group holding the remaining 2 physical devices
+    ASSERT_EQ(group_count, 8U);
+
+    uint32_t extension_count = 0;
+    ASSERT_EQ(VK_SUCCESS, inst->vkEnumerateDeviceExtensionProperties(phys_devs[29], nullptr, &extension_count, nullptr));
+    ASSERT_EQ(extension_count, 100U);
+}
+
+TEST(DriverSimulation, EntryPointLatency) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    const auto latency = std::chrono::milliseconds(50);
+    auto& driver = env.get_test_icd().set_enumerate_physical_devices_latency(latency);
+    driver.add_generated_physical_devices(1);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    uint32_t calls_before = driver.enumerate_physical_devices_call_count;
+
+    auto start = std::chrono::steady_clock::now();
+    inst.GetPhysDev();
+    ASSERT_GE(std::chrono::steady_clock::now() - start, latency);
+    ASSERT_GT(driver.enumerate_physical_devices_call_count, calls_before);
+}
+
 TEST(NoDrivers, CreateInstance) {
     FrameworkEnvironment env{};
     InstWrapper inst{env.vulkan_functions};
@@ -3279,6 +3862,180 @@ TEST(SortedPhysicalDevices, DeviceGroupsSortedDisabled) {
     }
 }
 
+// The static loader remembers the drivers from earlier tests, so these only run against the shared loader
+#if !defined(BUILD_STATIC_LOADER)
+TEST(SortedPhysicalDevices, DeviceSelectPruneSkipsOtherDrivers) {
+    EnvVarCleaner select_cleaner("VK_LOADER_DEVICE_SELECT");
+    EnvVarCleaner prune_cleaner("VK_LOADER_DEVICE_SELECT_PRUNE");
+    set_env_var("VK_LOADER_DEVICE_SELECT", "0x5001:0x6001");
+    set_env_var("VK_LOADER_DEVICE_SELECT_PRUNE", "1");
+
+    FrameworkEnvironment env{};
+    for (uint32_t icd = 0; icd < 3; icd++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        env.get_test_icd(icd).physical_devices.emplace_back("pd" + std::to_string(icd));
+        FillInRandomDeviceProps(env.get_test_icd(icd).physical_devices.back().properties, VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU,
+                                VK_API_VERSION_1_0, 0x5000 + icd, 0x6000 + icd);
+    }
+
+    {
+        // Nothing is known about the drivers yet, so all of them have to be loaded to find the selected device
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDevs(3);
+        for (uint32_t icd = 0; icd < 3; icd++) {
+            ASSERT_EQ(env.get_test_icd(icd).create_instance_call_count, 1U);
+            env.get_test_icd(icd).called_negotiate_interface = CalledNegotiateInterface::not_called;
+        }
+    }
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        auto phys_dev = inst.GetPhysDev();
+        VkPhysicalDeviceProperties props{};
+        env.vulkan_functions.vkGetPhysicalDeviceProperties(phys_dev, &props);
+        ASSERT_EQ(props.vendorID, 0x5001U);
+        ASSERT_EQ(props.deviceID, 0x6001U);
+
+        // Only the driver exposing the selected device was opened and instantiated
+        ASSERT_EQ(env.get_test_icd(0).called_negotiate_interface, CalledNegotiateInterface::not_called);
+        ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 1U);
+        ASSERT_NE(env.get_test_icd(1).called_negotiate_interface, CalledNegotiateInterface::not_called);
+        ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 2U);
+        ASSERT_EQ(env.get_test_icd(2).called_negotiate_interface, CalledNegotiateInterface::not_called);
+        ASSERT_EQ(env.get_test_icd(2).create_instance_call_count, 1U);
+    }
+}
+
+TEST(SortedPhysicalDevices, DeviceSelectPruneLoadsEveryDriverOnCacheMiss) {
+    EnvVarCleaner select_cleaner("VK_LOADER_DEVICE_SELECT");
+    EnvVarCleaner prune_cleaner("VK_LOADER_DEVICE_SELECT_PRUNE");
+    set_env_var("VK_LOADER_DEVICE_SELECT_PRUNE", "1");
+    set_env_var("VK_LOADER_DEVICE_SELECT", "0x7001:0x8001");
+
+    FrameworkEnvironment env{};
+    for (uint32_t icd = 0; icd < 2; icd++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        env.get_test_icd(icd).physical_devices.emplace_back("pd" + std::to_string(icd));
+        FillInRandomDeviceProps(env.get_test_icd(icd).physical_devices.back().properties, VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU,
+                                VK_API_VERSION_1_0, 0x7000 + icd, 0x8000 + icd);
+    }
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDevs(2);
+    }
+
+    // No driver exposes the newly selected device, so every driver is loaded again
+    set_env_var("VK_LOADER_DEVICE_SELECT", "0x7002:0x8002");
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    inst.GetPhysDevs(2);
+    ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 2U);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 2U);
+}
+
+TEST(SortedPhysicalDevices, DeviceSelectPruneKeepsInstanceExtensionsOfOtherDrivers) {
+    EnvVarCleaner select_cleaner("VK_LOADER_DEVICE_SELECT");
+    EnvVarCleaner prune_cleaner("VK_LOADER_DEVICE_SELECT_PRUNE");
+    set_env_var("VK_LOADER_DEVICE_SELECT", "0x9001:0xa001");
+    set_env_var("VK_LOADER_DEVICE_SELECT_PRUNE", "1");
+
+    FrameworkEnvironment env{};
+    for (uint32_t icd = 0; icd < 2; icd++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        env.get_test_icd(icd).physical_devices.emplace_back("pd" + std::to_string(icd));
+        FillInRandomDeviceProps(env.get_test_icd(icd).physical_devices.back().properties, VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU,
+                                VK_API_VERSION_1_0, 0x9000 + icd, 0xa000 + icd);
+    }
+    Extension pruned_driver_ext{"VK_EXT_headless_surface"};
+    env.get_test_icd(0).add_instance_extensions({pruned_driver_ext});
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+        inst.GetPhysDevs(2);
+    }
+
+    // The first driver is pruned when creating an instance, but its extensions are still available to enable
+    uint32_t extension_count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceExtensionProperties(nullptr, &extension_count, nullptr));
+    std::vector<VkExtensionProperties> extensions(extension_count);
+    ASSERT_EQ(VK_SUCCESS,
+              env.vulkan_functions.vkEnumerateInstanceExtensionProperties(nullptr, &extension_count, extensions.data()));
+    ASSERT_TRUE(std::any_of(extensions.begin(), extensions.end(), [&](VkExtensionProperties const& ext) {
+        return pruned_driver_ext.extensionName == ext.extensionName;
+    }));
+}
+#endif  // !defined(BUILD_STATIC_LOADER)
+
+// Adds a driver per entry of vendor_lists, where an empty list means the manifest doesn't declare any PCI vendors
+static void add_pci_vendor_drivers(FrameworkEnvironment& env, std::vector<std::vector<uint32_t>> const& vendor_lists) {
+    for (size_t icd = 0; icd < vendor_lists.size(); icd++) {
+        env.add_icd(TestICDDetails(ManifestICD{}
+                                       .set_lib_path(TEST_ICD_PATH_VERSION_2)
+                                       .set_api_version(VK_API_VERSION_1_0)
+                                       .add_pci_vendor_ids(vendor_lists[icd])));
+        env.get_test_icd(icd).physical_devices.emplace_back("pd" + std::to_string(icd));
+    }
+}
+
+TEST(PciVendorFilter, DriversForAbsentVendorsAreSkipped) {
+    FrameworkEnvironment env{};
+    add_pci_vendor_drivers(env, {{0x10de}, {0x8086, 0x1002}, {}});
+    env.add_pci_device("0000:00:02.0", 0x8086);
+    env.add_pci_device("0000:00:1f.0", 0x8086);
+
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+    inst.GetPhysDevs(2);
+    ASSERT_TRUE(env.debug_log.find("Driver \"" + env.get_test_icd_path(0).str() +
+                                   "\" not loaded because no PCI device from the vendors its manifest lists is present"));
+    ASSERT_EQ(env.get_test_icd(0).called_negotiate_interface, CalledNegotiateInterface::not_called);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+    ASSERT_EQ(env.get_test_icd(2).create_instance_call_count, 1U);
+}
+
+TEST(PciVendorFilter, OverrideLoadsEveryDriver) {
+    EnvVarCleaner disable_cleaner("VK_LOADER_DISABLE_PCI_FILTER");
+    set_env_var("VK_LOADER_DISABLE_PCI_FILTER", "1");
+
+    FrameworkEnvironment env{};
+    add_pci_vendor_drivers(env, {{0x10de}, {0x1002}});
+    env.add_pci_device("0000:00:02.0", 0x8086);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    inst.GetPhysDevs(2);
+    ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 1U);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+}
+
+TEST(PciVendorFilter, EveryDriverIsLoadedWithoutPciDevices) {
+    // Such as on systems whose GPUs aren't PCI devices, or which don't expose sysfs
+    FrameworkEnvironment env{};
+    add_pci_vendor_drivers(env, {{0x10de}, {0x1002}});
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    inst.GetPhysDevs(2);
+    ASSERT_EQ(env.get_test_icd(0).create_instance_call_count, 1U);
+    ASSERT_EQ(env.get_test_icd(1).create_instance_call_count, 1U);
+}
+
+TEST(PciVendorFilter, InvalidVendorListsAreIgnored) {
+    FrameworkEnvironment env{};
+    // PCI vendor IDs are 16 bits
+    add_pci_vendor_drivers(env, {{0x10de, 0x10000}});
+    env.add_pci_device("0000:00:02.0", 0x8086);
+
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+    inst.GetPhysDevs(1);
+    ASSERT_TRUE(env.debug_log.find("Ignoring the \'pci_vendor_ids\' field of ICD JSON"));
+}
+
 #endif  // __linux__ || __FreeBSD__ || __OpenBSD__
 
 const char* portability_driver_warning =
@@ -3609,6 +4366,39 @@ TEST(ManifestDiscovery, ValidSymlink) {
     inst.CheckCreate();
 }
 
+// Check that a manifest which can be reached through several search paths, directly or through a symlink, is only read once
+TEST(ManifestDiscovery, SameManifestThroughSeveralPaths) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    env.get_test_icd().physical_devices.push_back({});
+
+    std::string symlink_name = "symlink_to_driver.json";
+    fs::path symlink_path = env.get_folder(ManifestLocation::driver_env_var).location() / symlink_name;
+    env.get_folder(ManifestLocation::driver_env_var).add_existing_file(symlink_name);
+    int res = symlink(env.get_icd_manifest_path().c_str(), symlink_path.c_str());
+    ASSERT_EQ(res, 0);
+
+    // The first data dir overlaps with the folder the driver is in, the second only holds the symlink to the driver's manifest
+    set_env_var("XDG_DATA_DIRS", "/usr/fake_share_a:/usr/fake_share_b");
+    EnvVarCleaner xdg_data_dirs_cleaner("XDG_DATA_DIRS");
+    env.platform_shim->redirect_path("/usr/fake_share_a/vulkan/icd.d", env.get_folder(ManifestLocation::driver).location());
+    env.platform_shim->redirect_path("/usr/fake_share_b/vulkan/icd.d",
+                                     env.get_folder(ManifestLocation::driver_env_var).location());
+
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+
+    ASSERT_EQ(env.debug_log.count("Found ICD manifest file"), 1U);
+    ASSERT_TRUE(env.debug_log.find("Skipping manifest file /usr/fake_share_a/vulkan/icd.d/" +
+                                   env.get_icd_manifest_path().filename().str()));
+    ASSERT_TRUE(env.debug_log.find("Skipping manifest file /usr/fake_share_b/vulkan/icd.d/" + symlink_name));
+
+    uint32_t phys_dev_count = 0;
+    ASSERT_EQ(inst->vkEnumeratePhysicalDevices(inst.inst, &phys_dev_count, nullptr), VK_SUCCESS);
+    ASSERT_EQ(phys_dev_count, 1U);
+}
+
 // Check that invalid symlinks do not cause the loader to crash when directly in an XDG env-var
 TEST(ManifestDiscovery, InvalidSymlinkXDGEnvVar) {
     FrameworkEnvironment env{true, false};
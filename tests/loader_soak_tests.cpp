@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+// Soak tests which create and destroy instances and devices tens of thousands of times, the way long running services do for
+// health checks or to isolate jobs from each other. Once the first cycles have filled the loader's process wide caches, every
+// cycle has to leave the loader as it found it, so these fail if the allocations or libraries it holds grow from one cycle to
+// the next. They take minutes to run, so they live in their own executable which isn't run as part of ctest.
+
+#include "test_environment.h"
+
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <link.h>
+#endif
+
+namespace {
+
+// Counts the allocations made through the VkAllocationCallbacks given to the loader, which is everything an instance or device
+// allocates, and separately those the loader makes with the system allocator, which hold the process wide state it keeps.
+class AllocationCounter {
+   public:
+    AllocationCounter() noexcept;
+    ~AllocationCounter() noexcept {
+        for (auto& allocation : live) ::free(allocation.second.original);
+    }
+
+    VkAllocationCallbacks* get() noexcept { return &callbacks; }
+
+    // Starts counting the calls and the peaks of a new cycle, live allocations carry over
+    void start_cycle() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        allocation_calls = 0;
+        peak_count = live.size();
+        peak_bytes = live_bytes;
+        system_allocation_calls = 0;
+    }
+
+    size_t get_live_count() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        return live.size();
+    }
+    size_t get_live_bytes() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        return live_bytes;
+    }
+    size_t get_peak_count() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        return peak_count;
+    }
+    size_t get_peak_bytes() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        return peak_bytes;
+    }
+    size_t get_allocation_calls() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        return allocation_calls;
+    }
+    size_t get_system_live_count() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        return system_live.size();
+    }
+    size_t get_system_live_bytes() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        return system_live_bytes;
+    }
+    size_t get_system_allocation_calls() noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        return system_allocation_calls;
+    }
+
+    void* allocate(size_t size, size_t alignment) noexcept {
+        // Over allocate so that any alignment can be honored without a platform specific aligned allocator
+        void* original = ::malloc(size + alignment);
+        if (original == nullptr) return nullptr;
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(original) + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        std::lock_guard<std::mutex> lock(mutex);
+        live[reinterpret_cast<void*>(aligned)] = Allocation{original, size};
+        live_bytes += size;
+        allocation_calls++;
+        peak_count = std::max(peak_count, live.size());
+        peak_bytes = std::max(peak_bytes, live_bytes);
+        return reinterpret_cast<void*>(aligned);
+    }
+    void* reallocate(void* original, size_t size, size_t alignment) noexcept {
+        if (original == nullptr) return allocate(size, alignment);
+        if (size == 0) {
+            free(original);
+            return nullptr;
+        }
+        size_t original_size = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = live.find(original);
+            if (found == live.end()) return nullptr;
+            original_size = found->second.size;
+        }
+        void* memory = allocate(size, alignment);
+        if (memory == nullptr) return nullptr;
+        memcpy(memory, original, std::min(size, original_size));
+        free(original);
+        return memory;
+    }
+    void free(void* memory) noexcept {
+        if (memory == nullptr) return;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = live.find(memory);
+        if (found == live.end()) return;
+        live_bytes -= found->second.size;
+        ::free(found->second.original);
+        live.erase(found);
+    }
+
+    // Only observes the system allocator, memory allocated before the observer was set is freed without being seen
+    void observe_system_allocation(void* memory, void* original, size_t size) noexcept {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (original != nullptr) {
+            auto found = system_live.find(original);
+            if (found != system_live.end()) {
+                system_live_bytes -= found->second;
+                system_live.erase(found);
+            }
+        }
+        if (memory != nullptr) {
+            system_live[memory] = size;
+            system_live_bytes += size;
+            system_allocation_calls++;
+        }
+    }
+
+   private:
+    struct Allocation {
+        void* original;
+        size_t size;
+    };
+
+    VkAllocationCallbacks callbacks{};
+    std::mutex mutex;
+    std::unordered_map<void*, Allocation> live;
+    size_t live_bytes = 0;
+    size_t peak_count = 0;
+    size_t peak_bytes = 0;
+    size_t allocation_calls = 0;
+    std::unordered_map<void*, size_t> system_live;
+    size_t system_live_bytes = 0;
+    size_t system_allocation_calls = 0;
+};
+
+VKAPI_ATTR void* VKAPI_CALL counting_allocation(void* user_data, size_t size, size_t alignment, VkSystemAllocationScope) {
+    return static_cast<AllocationCounter*>(user_data)->allocate(size, alignment);
+}
+
+VKAPI_ATTR void* VKAPI_CALL counting_reallocation(void* user_data, void* original, size_t size, size_t alignment,
+                                                  VkSystemAllocationScope) {
+    return static_cast<AllocationCounter*>(user_data)->reallocate(original, size, alignment);
+}
+
+VKAPI_ATTR void VKAPI_CALL counting_free(void* user_data, void* memory) {
+    static_cast<AllocationCounter*>(user_data)->free(memory);
+}
+
+AllocationCounter::AllocationCounter() noexcept {
+    callbacks.pUserData = this;
+    callbacks.pfnAllocation = counting_allocation;
+    callbacks.pfnReallocation = counting_reallocation;
+    callbacks.pfnFree = counting_free;
+}
+
+// Matches PFN_loader_system_allocation_observer in loader/allocation.h, which loaders built with LOADER_ENABLE_TEST_HOOKS
+// export a setter for
+using PFN_loader_system_allocation_observer = void(VKAPI_PTR*)(void* user_data, void* pMemory, void* pOriginal, size_t size);
+using PFN_loader_test_set_system_allocation_observer = void(VKAPI_PTR*)(PFN_loader_system_allocation_observer observer,
+                                                                       void* user_data);
+
+VKAPI_ATTR void VKAPI_CALL counting_system_allocation(void* user_data, void* memory, void* original, size_t size) {
+    static_cast<AllocationCounter*>(user_data)->observe_system_allocation(memory, original, size);
+}
+
+// Reports the system allocations of the loader to an AllocationCounter for as long as it exists
+class SystemAllocationObserver {
+   public:
+    SystemAllocationObserver(FrameworkEnvironment& env, AllocationCounter& allocations) noexcept {
+// The setter is only exported by loaders built with LOADER_ENABLE_TEST_HOOKS, and isn't in vulkan-1.def, so Windows builds of
+// the loader never export it
+#if !defined(BUILD_STATIC_LOADER) && !defined(_WIN32)
+        set_observer = env.vulkan_functions.loader.find_symbol("loader_test_set_system_allocation_observer");
+#else
+        (void)env;
+#endif
+        if (set_observer != nullptr) set_observer(counting_system_allocation, &allocations);
+    }
+    ~SystemAllocationObserver() noexcept {
+        if (set_observer != nullptr) set_observer(nullptr, nullptr);
+    }
+    SystemAllocationObserver(SystemAllocationObserver const&) = delete;
+    SystemAllocationObserver& operator=(SystemAllocationObserver const&) = delete;
+
+    bool is_observing() const noexcept { return set_observer != nullptr; }
+
+   private:
+    PFN_loader_test_set_system_allocation_observer set_observer = nullptr;
+};
+
+// The number of libraries mapped into the process, which a cycle that leaves a driver or layer library loaded increases
+size_t get_loaded_library_count() {
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    size_t count = 0;
+    dl_iterate_phdr(
+        [](struct dl_phdr_info*, size_t, void* data) {
+            (*static_cast<size_t*>(data))++;
+            return 0;
+        },
+        &count);
+    return count;
+#else
+    // Loaded libraries are only counted on Linux and BSD
+    return 0;
+#endif
+}
+
+void report_latency_percentiles(std::string const& name, std::vector<std::chrono::nanoseconds> latencies) {
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double fraction) {
+        size_t index = static_cast<size_t>(fraction * static_cast<double>(latencies.size() - 1));
+        return std::chrono::duration_cast<std::chrono::microseconds>(latencies[index]).count();
+    };
+    std::cout << "[      SOAK] " << name << ": " << latencies.size() << " cycles, p50 " << percentile(0.5) << " us, p90 "
+              << percentile(0.9) << " us, p99 " << percentile(0.99) << " us, p99.9 " << percentile(0.999) << " us, max "
+              << percentile(1.0) << " us\n";
+}
+
+}  // namespace
+
+// Every cycle creates an instance with several layers on top of several drivers, enumerates the physical devices, and creates
+// and destroys a device on each of them. The first cycles are a warm up which sets the limits that no later cycle may exceed.
+TEST(InstanceAndDeviceChurn, NothingGrowsAcrossCycles) {
+    const uint32_t warm_up_cycles = 100;
+    const uint32_t cycles = 20000;
+    const uint32_t driver_count = 3;
+    const uint32_t layer_count = 3;
+
+    FrameworkEnvironment env{false};
+    for (uint32_t driver = 0; driver < driver_count; driver++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        env.get_test_icd(driver).add_generated_physical_devices(1);
+    }
+    auto layer_names = env.add_pass_through_layers(layer_count);
+
+    AllocationCounter allocations;
+    SystemAllocationObserver system_allocations{env, allocations};
+    auto run_cycle = [&]() {
+        InstWrapper inst{env.vulkan_functions, allocations.get()};
+        for (auto const& layer_name : layer_names) {
+            inst.create_info.add_layer(layer_name.c_str());
+        }
+        inst.CheckCreate();
+        for (auto phys_dev : inst.GetPhysDevs(driver_count)) {
+            DeviceWrapper dev{inst, allocations.get()};
+            dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(1.0));
+            dev.CheckCreate(phys_dev);
+        }
+    };
+
+    size_t max_peak_count = 0;
+    size_t max_peak_bytes = 0;
+    size_t max_allocation_calls = 0;
+    size_t max_system_allocation_calls = 0;
+    for (uint32_t cycle = 0; cycle < warm_up_cycles; cycle++) {
+        allocations.start_cycle();
+        run_cycle();
+        ASSERT_EQ(allocations.get_live_count(), 0U) << "Warm up cycle " << cycle << " leaked allocations";
+        max_peak_count = std::max(max_peak_count, allocations.get_peak_count());
+        max_peak_bytes = std::max(max_peak_bytes, allocations.get_peak_bytes());
+        max_allocation_calls = std::max(max_allocation_calls, allocations.get_allocation_calls());
+        max_system_allocation_calls = std::max(max_system_allocation_calls, allocations.get_system_allocation_calls());
+    }
+    // The process wide state the loader keeps with the system allocator is filled in by now, and may not grow any further
+    const size_t system_live_count = allocations.get_system_live_count();
+    const size_t system_live_bytes = allocations.get_system_live_bytes();
+    const size_t loaded_libraries = get_loaded_library_count();
+
+    std::vector<std::chrono::nanoseconds> latencies;
+    latencies.reserve(cycles);
+    for (uint32_t cycle = 0; cycle < cycles; cycle++) {
+        allocations.start_cycle();
+        auto start = std::chrono::steady_clock::now();
+        run_cycle();
+        latencies.push_back(std::chrono::steady_clock::now() - start);
+
+        ASSERT_EQ(allocations.get_live_count(), 0U) << "Cycle " << cycle << " leaked " << allocations.get_live_bytes() << " bytes";
+        ASSERT_LE(allocations.get_peak_count(), max_peak_count) << "Cycle " << cycle << " held more allocations at once";
+        ASSERT_LE(allocations.get_peak_bytes(), max_peak_bytes) << "Cycle " << cycle << " held more allocated bytes at once";
+        ASSERT_LE(allocations.get_allocation_calls(), max_allocation_calls) << "Cycle " << cycle << " allocated more often";
+        ASSERT_LE(allocations.get_system_live_count(), system_live_count) << "Cycle " << cycle << " leaked system allocations";
+        ASSERT_LE(allocations.get_system_live_bytes(), system_live_bytes) << "Cycle " << cycle << " leaked system allocated bytes";
+        ASSERT_LE(allocations.get_system_allocation_calls(), max_system_allocation_calls)
+            << "Cycle " << cycle << " allocated from the system more often";
+        ASSERT_LE(get_loaded_library_count(), loaded_libraries) << "Cycle " << cycle << " left libraries loaded";
+    }
+
+    std::cout << "[      SOAK] Per cycle: at most " << max_peak_count << " live allocations of " << max_peak_bytes << " bytes, "
+              << max_allocation_calls << " allocation calls, " << loaded_libraries << " libraries loaded between cycles\n";
+    if (system_allocations.is_observing()) {
+        std::cout << "[      SOAK] Per cycle: at most " << max_system_allocation_calls << " system allocation calls, "
+                  << system_live_count << " live system allocations of " << system_live_bytes << " bytes between cycles\n";
+    }
+    report_latency_percentiles("vkCreateInstance/vkCreateDevice/vkDestroyDevice/vkDestroyInstance", latencies);
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ */
+
+#include "test_environment.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "startup_profiler.h"
+
+size_t count_kind(std::vector<startup_profiler::ManifestTiming> const& manifests, std::string const& kind) {
+    return static_cast<size_t>(std::count_if(manifests.begin(), manifests.end(),
+                                             [&](startup_profiler::ManifestTiming const& m) { return m.kind == kind; }));
+}
+
+const startup_profiler::LibraryTiming* find_library(std::vector<startup_profiler::LibraryTiming> const& libraries,
+                                                    std::string const& path) {
+    for (auto const& library : libraries) {
+        if (library.path == path) return &library;
+    }
+    return nullptr;
+}
+
+TEST(StartupProfiler, FakeEnvironment) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(0).add_generated_physical_devices(1);
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd(1).add_generated_physical_devices(2);
+
+    const char* implicit_layer_name = "VK_LAYER_profiled_implicit";
+    env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                         .set_name(implicit_layer_name)
+                                                         .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                         .set_disable_environment("DISABLE_PROFILED_IMPLICIT_LAYER")),
+                           "profiled_implicit_layer.json");
+    const char* explicit_layer_name = "VK_LAYER_profiled_explicit";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(explicit_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "profiled_explicit_layer.json");
+
+    startup_profiler::Options options;
+    options.layers.push_back(explicit_layer_name);
+    // Makes every library count as slow
+    options.slow_library_threshold = std::chrono::microseconds(0);
+
+    auto report = startup_profiler::run(env.vulkan_functions.vkGetInstanceProcAddr, options);
+    ASSERT_EQ(report.result, VK_SUCCESS);
+    ASSERT_TRUE(report.failed_phase.empty());
+
+    ASSERT_EQ(report.phases.size(), 5U);
+    ASSERT_EQ(report.phases[0].name, "layer discovery");
+    ASSERT_EQ(report.phases[1].name, "instance creation");
+    ASSERT_EQ(report.phases[2].name, "physical device enumeration");
+    ASSERT_EQ(report.phases[3].name, "device creation");
+    ASSERT_EQ(report.phases[4].name, "instance destruction");
+    ASSERT_EQ(report.devices.size(), 3U);
+
+    ASSERT_EQ(count_kind(report.manifests, "driver"), 2U);
+    ASSERT_EQ(count_kind(report.manifests, "layer"), 2U);
+
+    ASSERT_EQ(report.libraries.size(), 4U);
+    for (size_t i = 0; i < 2; i++) {
+        auto driver = find_library(report.libraries, env.get_test_icd_path(i).str());
+        ASSERT_NE(driver, nullptr);
+        ASSERT_EQ(driver->kind, "driver");
+        auto layer = find_library(report.libraries, env.get_test_layer_path(i).str());
+        ASSERT_NE(layer, nullptr);
+        ASSERT_EQ(layer->kind, "layer");
+    }
+    ASSERT_EQ(startup_profiler::slow_libraries(report, options).size(), 4U);
+
+    std::stringstream json;
+    startup_profiler::write_json(json, report, options);
+    ASSERT_EQ(json.str().front(), '{');
+    ASSERT_NE(json.str().find("\"failed_phase\": null"), std::string::npos);
+    ASSERT_NE(json.str().find("\"path\": \"" + env.get_test_icd_path(1).str() + "\""), std::string::npos);
+
+    std::stringstream text;
+    startup_profiler::write_text(text, report, options);
+    ASSERT_NE(text.str().find("Slow libraries"), std::string::npos);
+}
+
+TEST(StartupProfiler, ReportsFailedPhase) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().add_generated_physical_devices(1);
+
+    startup_profiler::Options options;
+    options.layers.push_back("VK_LAYER_does_not_exist");
+
+    auto report = startup_profiler::run(env.vulkan_functions.vkGetInstanceProcAddr, options);
+    ASSERT_EQ(report.result, VK_ERROR_LAYER_NOT_PRESENT);
+    ASSERT_EQ(report.failed_phase, "instance creation");
+
+    std::stringstream json;
+    startup_profiler::write_json(json, report, options);
+    ASSERT_NE(json.str().find("\"failed_phase\": \"instance creation\""), std::string::npos);
+}
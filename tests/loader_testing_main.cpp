@@ -61,6 +61,14 @@ int main(int argc, char** argv) {
     remove_env_var("VK_LOADER_LAYERS_DISABLE");
     remove_env_var("VK_LOADER_DEBUG");
     remove_env_var("VK_LOADER_DISABLE_INST_EXT_FILTER");
+    remove_env_var("VK_LOADER_LOG_RATE_LIMIT");
+    remove_env_var("VK_LOADER_LAZY_DRIVER_INSTANCES");
+    remove_env_var("VK_LOADER_FORK_SAFE");
+    remove_env_var("VK_LOADER_DRIVER_TIMEOUT_MS");
+    remove_env_var("VK_LOADER_DRIVER_QUARANTINE_FILE");
+    remove_env_var("VK_LOADER_DEVICE_SELECT_PRUNE");
+    remove_env_var("VK_LOADER_CACHE_SURFACE_QUERIES");
+    remove_env_var("VK_LOADER_DISABLE_PCI_FILTER");
 
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
     set_env_var("XDG_CONFIG_HOME", "/etc");
@@ -30,6 +30,7 @@
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <algorithm>
 
 void create_destroy_instance_loop_with_function_queries(FrameworkEnvironment* env, uint32_t num_loops_create_destroy_instance,
                                                         uint32_t num_loops_try_get_instance_proc_addr,
@@ -147,3 +148,280 @@ TEST(Threading, DeviceCreateDestroyLoop) {
         device_creation_threads[i].join();
     }
 }
+
+VKAPI_ATTR uint32_t VKAPI_CALL stress_device_function(VkDevice device, uint32_t value) { return value; }
+VKAPI_ATTR uint32_t VKAPI_CALL stress_physical_device_function(VkPhysicalDevice phys_dev, uint32_t value) { return value + 1; }
+using PFN_stress_device_function = decltype(&stress_device_function);
+using PFN_stress_physical_device_function = decltype(&stress_physical_device_function);
+
+// Races every kind of entry point which relies on the loader's locks against each other: GetProcAddr of known and unknown
+// functions, enumeration, device creation, debug messenger creation, and instance teardown. Built with
+// TEST_USE_THREAD_SANITIZER this must report no races, which is what allows the locking to be made finer grained safely.
+TEST(Threading, RaceStress) {
+#if defined(__APPLE__)
+    GTEST_SKIP() << "Skip this test as currently macOS doesn't fully support unknown functions.";
+#endif
+    const uint32_t threads_per_kind = std::max(2U, std::thread::hardware_concurrency() / 4);
+    const uint32_t iterations = 50;
+    const uint32_t unknown_function_count = 16;
+
+    FrameworkEnvironment env{false};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    auto& driver = env.get_test_icd();
+    driver.physical_devices.emplace_back("physical_device_0");
+    driver.physical_devices.back().add_extension("VK_EXT_stress_test_extension");
+    driver.physical_devices.back().known_device_functions.push_back(
+        {"vkCmdBindPipeline", to_vkVoidFunction(test_vkCmdBindPipeline)});
+
+    std::vector<std::string> device_function_names;
+    std::vector<std::string> physical_device_function_names;
+    for (uint32_t i = 0; i < unknown_function_count; i++) {
+        device_function_names.push_back("vkStressTestDeviceFunction" + std::to_string(i) + "EXT");
+        physical_device_function_names.push_back("vkStressTestPhysicalDeviceFunction" + std::to_string(i) + "EXT");
+        driver.physical_devices.back().known_device_functions.push_back(
+            {device_function_names.back(), to_vkVoidFunction(stress_device_function)});
+        driver.physical_devices.back().custom_physical_device_functions.push_back(
+            {physical_device_function_names.back(), to_vkVoidFunction(stress_physical_device_function)});
+    }
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    VkPhysicalDevice phys_dev = inst.GetPhysDev();
+    DeviceWrapper shared_dev{inst};
+    shared_dev.CheckCreate(phys_dev);
+
+    // Every thread waits for the others so that the first lookups of each unknown function race each other
+    std::atomic<uint32_t> ready_count{0};
+    const uint32_t total_thread_count = threads_per_kind * 4;
+    auto wait_for_all_threads = [&]() {
+        ready_count++;
+        while (ready_count < total_thread_count) std::this_thread::yield();
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threads_per_kind; t++) {
+        // GetProcAddr, with each thread registering the unknown functions in a different order
+        threads.emplace_back([&, t]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                for (uint32_t f = 0; f < unknown_function_count; f++) {
+                    uint32_t index = (f + t * 3) % unknown_function_count;
+                    ASSERT_NE(nullptr, inst.functions->vkGetInstanceProcAddr(inst, device_function_names[index].c_str()));
+                    ASSERT_NE(nullptr,
+                              inst.functions->vkGetInstanceProcAddr(inst, physical_device_function_names[index].c_str()));
+                }
+                ASSERT_NE(nullptr, inst.functions->vkGetInstanceProcAddr(inst, "vkEnumeratePhysicalDevices"));
+                ASSERT_NE(nullptr, shared_dev.functions->vkGetDeviceProcAddr(shared_dev, "vkCmdBindPipeline"));
+            }
+        });
+        // Enumeration of the shared instance and of the global entry points
+        threads.emplace_back([&]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                uint32_t count = 0;
+                ASSERT_EQ(VK_SUCCESS, inst->vkEnumeratePhysicalDevices(inst, &count, nullptr));
+                ASSERT_EQ(1U, count);
+                VkPhysicalDevice enumerated = VK_NULL_HANDLE;
+                ASSERT_EQ(VK_SUCCESS, inst->vkEnumeratePhysicalDevices(inst, &count, &enumerated));
+                ASSERT_EQ(phys_dev, enumerated);
+                uint32_t ext_count = 0;
+                ASSERT_EQ(VK_SUCCESS, inst->vkEnumerateDeviceExtensionProperties(phys_dev, nullptr, &ext_count, nullptr));
+                std::vector<VkExtensionProperties> extensions(ext_count);
+                ASSERT_EQ(VK_SUCCESS,
+                          inst->vkEnumerateDeviceExtensionProperties(phys_dev, nullptr, &ext_count, extensions.data()));
+                ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceExtensionProperties(nullptr, &ext_count, nullptr));
+                uint32_t layer_count = 0;
+                ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&layer_count, nullptr));
+            }
+        });
+        // Device creation on the shared instance, which fills in the dispatch entries of every unknown function seen so far
+        threads.emplace_back([&]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                DeviceWrapper dev{inst};
+                dev.CheckCreate(phys_dev);
+                PFN_vkCmdBindPipeline bind_pipeline = dev.load("vkCmdBindPipeline");
+                ASSERT_NE(nullptr, bind_pipeline);
+            }
+        });
+        // Instances with debug messengers which are created, used, and torn down while the shared instance is in use
+        threads.emplace_back([&]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                DebugUtilsLogger log{VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT};
+                InstWrapper local_inst{env.vulkan_functions};
+                FillDebugUtilsCreateDetails(local_inst.create_info, log);
+                local_inst.CheckCreate();
+                DebugUtilsWrapper messenger{local_inst};
+                ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(messenger));
+                ASSERT_NE(nullptr, local_inst.functions->vkGetInstanceProcAddr(local_inst, device_function_names[i % 2].c_str()));
+                DeviceWrapper dev{local_inst};
+                dev.CheckCreate(local_inst.GetPhysDev());
+                ASSERT_TRUE(log.returned_output.empty());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every unknown function must dispatch to the driver from both the device created before and one created after the race
+    DeviceWrapper new_dev{inst};
+    new_dev.CheckCreate(phys_dev);
+    for (uint32_t f = 0; f < unknown_function_count; f++) {
+        auto device_function = reinterpret_cast<PFN_stress_device_function>(
+            inst.functions->vkGetInstanceProcAddr(inst, device_function_names[f].c_str()));
+        ASSERT_EQ(f, device_function(shared_dev, f));
+        ASSERT_EQ(f, device_function(new_dev, f));
+        auto physical_device_function = reinterpret_cast<PFN_stress_physical_device_function>(
+            inst.functions->vkGetInstanceProcAddr(inst, physical_device_function_names[f].c_str()));
+        ASSERT_EQ(f + 1, physical_device_function(phys_dev, f));
+    }
+}
+
+const char* debug_callback_stress_message = "Debug callback stress test message";
+
+VKAPI_ATTR VkBool32 VKAPI_CALL stress_messenger_callback(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                                         const VkDebugUtilsMessengerCallbackDataEXT* callback_data,
+                                                         void* user_data) {
+    if (string_eq(callback_data->pMessage, debug_callback_stress_message)) {
+        static_cast<std::atomic<uint32_t>*>(user_data)->fetch_add(1);
+    }
+    return VK_FALSE;
+}
+
+VKAPI_ATTR VkBool32 VKAPI_CALL stress_report_callback(VkDebugReportFlagsEXT, VkDebugReportObjectTypeEXT, uint64_t, size_t, int32_t,
+                                                      const char*, const char* message, void* user_data) {
+    if (string_eq(message, debug_callback_stress_message)) {
+        static_cast<std::atomic<uint32_t>*>(user_data)->fetch_add(1);
+    }
+    return VK_FALSE;
+}
+
+// Creates and destroys debug messengers and debug report callbacks on one instance while other threads log to it, both through
+// the debug extensions and through the loader's own logging. The callbacks are read without a lock, so besides being free of
+// reported races, a messenger which outlives the churn must see every message exactly once.
+TEST(Threading, DebugCallbackStress) {
+    const uint32_t threads_per_kind = std::max(2U, std::thread::hardware_concurrency() / 4);
+    const uint32_t iterations = 200;
+
+    FrameworkEnvironment env{false};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    env.get_test_icd().physical_devices.emplace_back("physical_device_0");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME).add_extension(VK_EXT_DEBUG_REPORT_EXTENSION_NAME);
+    inst.CheckCreate();
+
+    PFN_vkCreateDebugUtilsMessengerEXT create_messenger = inst.load("vkCreateDebugUtilsMessengerEXT");
+    PFN_vkDestroyDebugUtilsMessengerEXT destroy_messenger = inst.load("vkDestroyDebugUtilsMessengerEXT");
+    PFN_vkSubmitDebugUtilsMessageEXT submit_message = inst.load("vkSubmitDebugUtilsMessageEXT");
+    PFN_vkCreateDebugReportCallbackEXT create_report_callback = inst.load("vkCreateDebugReportCallbackEXT");
+    PFN_vkDestroyDebugReportCallbackEXT destroy_report_callback = inst.load("vkDestroyDebugReportCallbackEXT");
+    PFN_vkDebugReportMessageEXT report_message = inst.load("vkDebugReportMessageEXT");
+    ASSERT_NE(nullptr, create_messenger);
+    ASSERT_NE(nullptr, destroy_messenger);
+    ASSERT_NE(nullptr, submit_message);
+    ASSERT_NE(nullptr, create_report_callback);
+    ASSERT_NE(nullptr, destroy_report_callback);
+    ASSERT_NE(nullptr, report_message);
+
+    VkDebugUtilsMessengerCreateInfoEXT messenger_info{VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+    messenger_info.messageSeverity =
+        VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT |
+        VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    messenger_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
+                                 VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+    messenger_info.pfnUserCallback = stress_messenger_callback;
+
+    VkDebugReportCallbackCreateInfoEXT report_info{VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT};
+    report_info.flags = VK_DEBUG_REPORT_INFORMATION_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT |
+                        VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT | VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_DEBUG_BIT_EXT;
+    report_info.pfnCallback = stress_report_callback;
+
+    // Outlives the churn, so must see each message once
+    std::atomic<uint32_t> persistent_message_count{0};
+    VkDebugUtilsMessengerCreateInfoEXT persistent_info = messenger_info;
+    persistent_info.pUserData = &persistent_message_count;
+    VkDebugUtilsMessengerEXT persistent_messenger = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, create_messenger(inst, &persistent_info, nullptr, &persistent_messenger));
+
+    // The churned callbacks share one count, which only has to outlive the churn since destroying a callback waits for the
+    // messages which are calling it
+    std::atomic<uint32_t> churned_message_count{0};
+    messenger_info.pUserData = &churned_message_count;
+    report_info.pUserData = &churned_message_count;
+
+    VkDebugUtilsMessengerCallbackDataEXT callback_data{VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT};
+    callback_data.pMessageIdName = "stress";
+    callback_data.pMessage = debug_callback_stress_message;
+
+    std::atomic<uint32_t> ready_count{0};
+    const uint32_t total_thread_count = threads_per_kind * 5;
+    auto wait_for_all_threads = [&]() {
+        ready_count++;
+        while (ready_count < total_thread_count) std::this_thread::yield();
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threads_per_kind; t++) {
+        threads.emplace_back([&]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+                ASSERT_EQ(VK_SUCCESS, create_messenger(inst, &messenger_info, nullptr, &messenger));
+                destroy_messenger(inst, messenger, nullptr);
+            }
+        });
+        threads.emplace_back([&]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+                ASSERT_EQ(VK_SUCCESS, create_report_callback(inst, &report_info, nullptr, &callback));
+                destroy_report_callback(inst, callback, nullptr);
+            }
+        });
+        threads.emplace_back([&]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                submit_message(inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT,
+                               &callback_data);
+            }
+        });
+        threads.emplace_back([&]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                report_message(inst, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_INSTANCE_EXT,
+                               reinterpret_cast<uint64_t>(inst.inst), 0, 0, "stress", debug_callback_stress_message);
+            }
+        });
+        // The loader logs to the callbacks of the instance while enumerating
+        threads.emplace_back([&]() {
+            wait_for_all_threads();
+            for (uint32_t i = 0; i < iterations; i++) {
+                uint32_t count = 0;
+                ASSERT_EQ(VK_SUCCESS, inst->vkEnumeratePhysicalDevices(inst, &count, nullptr));
+                ASSERT_EQ(1U, count);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(threads_per_kind * iterations * 2, persistent_message_count.load());
+    destroy_messenger(inst, persistent_messenger, nullptr);
+
+    // With every churned callback destroyed, only the messenger made now sees a message
+    churned_message_count = 0;
+    std::atomic<uint32_t> final_message_count{0};
+    VkDebugUtilsMessengerCreateInfoEXT final_info = messenger_info;
+    final_info.pUserData = &final_message_count;
+    VkDebugUtilsMessengerEXT final_messenger = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, create_messenger(inst, &final_info, nullptr, &final_messenger));
+    submit_message(inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT,
+                   &callback_data);
+    ASSERT_EQ(1U, final_message_count.load());
+    ASSERT_EQ(0U, churned_message_count.load());
+    destroy_messenger(inst, final_messenger, nullptr);
+}
@@ -791,6 +791,99 @@ TEST(UnknownFunction, DeviceFromGIPAWithLayerInterceptionAndLayerImplementation)
     unknown_function_test_impl<VkInstance, VkDevice>({TestConfig::add_layer_interception, TestConfig::add_layer_implementation});
 }
 
+// A layer which looks up another unknown function from its vkGetDeviceProcAddr while the loader fills in the dispatch table of
+// a new device must not deadlock on the loader's unknown function lock.
+TEST(UnknownFunction, DeviceFromGIPAWhileLayerLooksUpUnknownFunctionDuringCreateDevice) {
+#if defined(__APPLE__)
+    GTEST_SKIP() << "Skip this test as currently macOS doesn't fully support unknown functions.";
+#endif
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    uint32_t function_count = 5;
+
+    auto& driver = env.get_test_icd();
+    driver.physical_devices.emplace_back("physical_device_0");
+    driver.physical_devices.back().add_queue_family_properties({});
+
+    std::vector<std::string> function_names;
+    add_function_names(function_names, function_count);
+    fill_implementation_functions(driver.physical_devices.back().known_device_functions, function_names,
+                                  custom_functions<VkDevice>{}, function_count);
+
+    env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                         .set_name("VK_LAYER_implicit_layer_unknown_function_lookup")
+                                                         .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                         .set_disable_environment("DISABLE_ME")),
+                           "implicit_layer_unknown_function_lookup.json");
+    bool looked_up_during_create_device = false;
+    env.get_test_layer().set_get_device_proc_addr_callback([&](TestLayer& layer, const char* pName) {
+        if (function_names.at(0) == pName) {
+            looked_up_during_create_device |=
+                layer.next_vkGetInstanceProcAddr(layer.instance_handle, function_names.at(1).c_str()) != nullptr;
+        }
+    });
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    // Only the first function is known to the loader before the device is created
+    ASSERT_NE(env.vulkan_functions.vkGetInstanceProcAddr(inst, function_names.at(0).c_str()), nullptr);
+
+    DeviceWrapper dev{inst};
+    dev.create_info.add_device_queue({});
+    dev.CheckCreate(inst.GetPhysDev());
+    ASSERT_TRUE(looked_up_during_create_device);
+
+    check_custom_functions(env.vulkan_functions, dev.dev, dev.dev, custom_functions<VkDevice>{}, function_names, function_count);
+}
+
+// The same, but with the device created before the unknown function is first looked up, so the loader calls down the chain of
+// the existing device when the function is added.
+TEST(UnknownFunction, DeviceFromGIPAWhileLayerLooksUpUnknownFunctionForExistingDevice) {
+#if defined(__APPLE__)
+    GTEST_SKIP() << "Skip this test as currently macOS doesn't fully support unknown functions.";
+#endif
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    uint32_t function_count = 5;
+
+    auto& driver = env.get_test_icd();
+    driver.physical_devices.emplace_back("physical_device_0");
+    driver.physical_devices.back().add_queue_family_properties({});
+
+    std::vector<std::string> function_names;
+    add_function_names(function_names, function_count);
+    fill_implementation_functions(driver.physical_devices.back().known_device_functions, function_names,
+                                  custom_functions<VkDevice>{}, function_count);
+
+    env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                         .set_name("VK_LAYER_implicit_layer_unknown_function_lookup")
+                                                         .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                         .set_disable_environment("DISABLE_ME")),
+                           "implicit_layer_unknown_function_lookup.json");
+    bool looked_up_for_existing_device = false;
+    env.get_test_layer().set_get_device_proc_addr_callback([&](TestLayer& layer, const char* pName) {
+        if (function_names.at(0) == pName) {
+            looked_up_for_existing_device |=
+                layer.next_vkGetInstanceProcAddr(layer.instance_handle, function_names.at(1).c_str()) != nullptr;
+        }
+    });
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+
+    DeviceWrapper dev{inst};
+    dev.create_info.add_device_queue({});
+    dev.CheckCreate(inst.GetPhysDev());
+    ASSERT_FALSE(looked_up_for_existing_device);
+
+    // Adding the first function calls down the chain of the device created above
+    ASSERT_NE(env.vulkan_functions.vkGetInstanceProcAddr(inst, function_names.at(0).c_str()), nullptr);
+    ASSERT_TRUE(looked_up_for_existing_device);
+
+    check_custom_functions(env.vulkan_functions, inst.inst, dev.dev, custom_functions<VkDevice>{}, function_names,
+                           function_count);
+}
+
 // Command buffers
 
 TEST(UnknownFunction, CommandBufferFromGDPA) { unknown_function_test_impl<VkDevice, VkCommandBuffer>({}); }
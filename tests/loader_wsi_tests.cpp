@@ -890,3 +890,114 @@ TEST(WsiTests, SwapchainFunctional) {
     }
     env.vulkan_functions.vkDestroySurfaceKHR(inst.inst, surface, nullptr);
 }
+
+// Sets up a driver with a single physical device which supports presenting to headless surfaces
+static void setup_headless_surface_driver(FrameworkEnvironment& env) {
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    auto& driver = env.get_test_icd();
+    driver.set_min_icd_interface_version(5);
+    driver.enable_icd_wsi = true;
+    driver.add_instance_extensions({"VK_KHR_surface", "VK_EXT_headless_surface"});
+    driver.physical_devices.emplace_back("physical_device_0");
+    driver.physical_devices.back().add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true});
+    driver.physical_devices.back().add_surface_format({VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR});
+    driver.physical_devices.back().add_surface_format({VK_FORMAT_R8G8B8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR});
+    driver.physical_devices.back().add_surface_present_mode(VK_PRESENT_MODE_FIFO_KHR);
+    driver.physical_devices.back().add_surface_present_mode(VK_PRESENT_MODE_MAILBOX_KHR);
+}
+
+// Queries everything an engine would when recreating its swapchain
+static void query_surface(InstWrapper& inst, VkPhysicalDevice phys_dev, VkSurfaceKHR surface) {
+    VkBool32 supported = VK_FALSE;
+    ASSERT_EQ(VK_SUCCESS, inst.functions->vkGetPhysicalDeviceSurfaceSupportKHR(phys_dev, 0, surface, &supported));
+    ASSERT_EQ(VK_TRUE, supported);
+
+    VkSurfaceCapabilitiesKHR capabilities{};
+    ASSERT_EQ(VK_SUCCESS, inst.functions->vkGetPhysicalDeviceSurfaceCapabilitiesKHR(phys_dev, surface, &capabilities));
+
+    uint32_t format_count = 0;
+    ASSERT_EQ(VK_SUCCESS, inst.functions->vkGetPhysicalDeviceSurfaceFormatsKHR(phys_dev, surface, &format_count, nullptr));
+    ASSERT_EQ(format_count, 2U);
+    std::array<VkSurfaceFormatKHR, 2> formats{};
+    ASSERT_EQ(VK_SUCCESS, inst.functions->vkGetPhysicalDeviceSurfaceFormatsKHR(phys_dev, surface, &format_count, formats.data()));
+    ASSERT_EQ(formats[0].format, VK_FORMAT_B8G8R8A8_UNORM);
+    ASSERT_EQ(formats[1].format, VK_FORMAT_R8G8B8A8_SRGB);
+
+    uint32_t present_mode_count = 0;
+    ASSERT_EQ(VK_SUCCESS, inst.functions->vkGetPhysicalDeviceSurfacePresentModesKHR(phys_dev, surface, &present_mode_count, nullptr));
+    ASSERT_EQ(present_mode_count, 2U);
+    std::array<VkPresentModeKHR, 2> present_modes{};
+    ASSERT_EQ(VK_SUCCESS,
+              inst.functions->vkGetPhysicalDeviceSurfacePresentModesKHR(phys_dev, surface, &present_mode_count, present_modes.data()));
+    ASSERT_EQ(present_modes[0], VK_PRESENT_MODE_FIFO_KHR);
+    ASSERT_EQ(present_modes[1], VK_PRESENT_MODE_MAILBOX_KHR);
+}
+
+TEST(WsiTests, SurfaceQueriesUncachedByDefault) {
+    FrameworkEnvironment env{};
+    setup_headless_surface_driver(env);
+    auto& driver = env.get_test_icd();
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extensions({"VK_KHR_surface", "VK_EXT_headless_surface"});
+    inst.CheckCreate();
+    auto phys_dev = inst.GetPhysDev();
+
+    VkSurfaceKHR surface{};
+    VkHeadlessSurfaceCreateInfoEXT surface_create_info{VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT};
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkCreateHeadlessSurfaceEXT(inst, &surface_create_info, nullptr, &surface));
+
+    query_surface(inst, phys_dev, surface);
+    query_surface(inst, phys_dev, surface);
+    ASSERT_EQ(driver.get_physical_device_surface_support_call_count, 2U);
+    ASSERT_EQ(driver.get_physical_device_surface_capabilities_call_count, 2U);
+    ASSERT_EQ(driver.get_physical_device_surface_formats_call_count, 4U);
+    ASSERT_EQ(driver.get_physical_device_surface_present_modes_call_count, 4U);
+
+    env.vulkan_functions.vkDestroySurfaceKHR(inst, surface, nullptr);
+}
+
+TEST(WsiTests, SurfaceQueriesCachedUntilSurfaceDestroyed) {
+    EnvVarCleaner cache_cleaner("VK_LOADER_CACHE_SURFACE_QUERIES");
+    set_env_var("VK_LOADER_CACHE_SURFACE_QUERIES", "1");
+
+    FrameworkEnvironment env{};
+    setup_headless_surface_driver(env);
+    auto& driver = env.get_test_icd();
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extensions({"VK_KHR_surface", "VK_EXT_headless_surface"});
+    inst.CheckCreate();
+    auto phys_dev = inst.GetPhysDev();
+
+    VkSurfaceKHR surface{};
+    VkHeadlessSurfaceCreateInfoEXT surface_create_info{VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT};
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkCreateHeadlessSurfaceEXT(inst, &surface_create_info, nullptr, &surface));
+
+    for (uint32_t i = 0; i < 3; i++) {
+        query_surface(inst, phys_dev, surface);
+    }
+    ASSERT_EQ(driver.get_physical_device_surface_support_call_count, 1U);
+    // Capabilities change with the window size, so they are always queried from the driver
+    ASSERT_EQ(driver.get_physical_device_surface_capabilities_call_count, 3U);
+    // The first query gets both the count and the elements
+    ASSERT_EQ(driver.get_physical_device_surface_formats_call_count, 2U);
+    ASSERT_EQ(driver.get_physical_device_surface_present_modes_call_count, 2U);
+
+    // Too small of an array is handled the same way the driver would
+    uint32_t format_count = 1;
+    VkSurfaceFormatKHR format{};
+    ASSERT_EQ(VK_INCOMPLETE, inst.functions->vkGetPhysicalDeviceSurfaceFormatsKHR(phys_dev, surface, &format_count, &format));
+    ASSERT_EQ(format_count, 1U);
+    ASSERT_EQ(format.format, VK_FORMAT_B8G8R8A8_UNORM);
+
+    // A new surface, even if it reuses the handle of the destroyed one, is queried from the driver again
+    env.vulkan_functions.vkDestroySurfaceKHR(inst, surface, nullptr);
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkCreateHeadlessSurfaceEXT(inst, &surface_create_info, nullptr, &surface));
+    query_surface(inst, phys_dev, surface);
+    ASSERT_EQ(driver.get_physical_device_surface_support_call_count, 2U);
+    ASSERT_EQ(driver.get_physical_device_surface_formats_call_count, 4U);
+    ASSERT_EQ(driver.get_physical_device_surface_present_modes_call_count, 4U);
+
+    env.vulkan_functions.vkDestroySurfaceKHR(inst, surface, nullptr);
+}
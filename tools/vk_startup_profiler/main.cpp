@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "startup_profiler.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+void print_usage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "Times the startup of the Vulkan loader with the manifests, drivers, and layers of this system.\n"
+              << "\n"
+              << "Options:\n"
+              << "  --json                 Print the results as JSON\n"
+              << "  --layer <name>         Enable the explicit layer <name>, may be given more than once\n"
+              << "  --no-devices           Don't create a VkDevice on each physical device\n"
+              << "  --slow-threshold <us>  Report libraries which take at least this long as slow (default 5000)\n"
+              << "  --help                 Print this message\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    startup_profiler::Options options;
+    bool json = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (strcmp(argv[i], "--layer") == 0 && i + 1 < argc) {
+            options.layers.push_back(argv[++i]);
+        } else if (strcmp(argv[i], "--no-devices") == 0) {
+            options.create_devices = false;
+        } else if (strcmp(argv[i], "--slow-threshold") == 0 && i + 1 < argc) {
+            options.slow_library_threshold = std::chrono::microseconds(std::strtoull(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--help") == 0) {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        } else {
+            std::cerr << "Unknown option " << argv[i] << "\n";
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto report = startup_profiler::run(vkGetInstanceProcAddr, options);
+    if (json) {
+        startup_profiler::write_json(std::cout, report, options);
+    } else {
+        startup_profiler::write_text(std::cout, report, options);
+    }
+    return report.failed_phase.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
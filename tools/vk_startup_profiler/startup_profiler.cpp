@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "startup_profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+
+namespace startup_profiler {
+
+namespace {
+
+struct LoaderFunctions {
+    PFN_vkEnumerateInstanceVersion EnumerateInstanceVersion = nullptr;
+    PFN_vkEnumerateInstanceLayerProperties EnumerateInstanceLayerProperties = nullptr;
+    PFN_vkCreateInstance CreateInstance = nullptr;
+    PFN_vkDestroyInstance DestroyInstance = nullptr;
+    PFN_vkCreateDebugUtilsMessengerEXT CreateDebugUtilsMessengerEXT = nullptr;
+    PFN_vkDestroyDebugUtilsMessengerEXT DestroyDebugUtilsMessengerEXT = nullptr;
+    PFN_vkEnumeratePhysicalDevices EnumeratePhysicalDevices = nullptr;
+    PFN_vkGetPhysicalDeviceProperties GetPhysicalDeviceProperties = nullptr;
+    PFN_vkCreateDevice CreateDevice = nullptr;
+    PFN_vkDestroyDevice DestroyDevice = nullptr;
+};
+
+template <typename Func>
+std::chrono::microseconds time_call(Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+void add_phase(Report& report, std::string const& name, std::chrono::microseconds duration) {
+    Timing phase;
+    phase.name = name;
+    phase.duration = duration;
+    report.phases.push_back(phase);
+}
+
+bool fail_phase(Report& report, std::string const& name, VkResult result) {
+    if (result == VK_SUCCESS || result == VK_INCOMPLETE) {
+        return false;
+    }
+    report.result = result;
+    report.failed_phase = name;
+    return true;
+}
+
+// Must match LOADER_PERF_MESSAGE_PREFIX in loader/log.h, which also describes the format of the messages
+const char perf_message_prefix[] = "loader_perf: ";
+
+struct PerfMessage {
+    std::string event;
+    std::string kind;
+    std::string path;
+    std::chrono::microseconds duration{};
+};
+
+// Splits "loader_perf: <event> <key>=<value>... path=<path>" into its fields. Returns false if message isn't a performance
+// message, or is missing the duration or the path.
+bool parse_perf_message(std::string const& message, PerfMessage& perf) {
+    const std::string prefix = perf_message_prefix;
+    if (message.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    size_t pos = prefix.size();
+    size_t end = message.find(' ', pos);
+    if (end == std::string::npos) {
+        return false;
+    }
+    perf.event = message.substr(pos, end - pos);
+    bool has_duration = false;
+    while (end != std::string::npos) {
+        pos = end + 1;
+        size_t equals = message.find('=', pos);
+        if (equals == std::string::npos) {
+            return false;
+        }
+        std::string key = message.substr(pos, equals - pos);
+        if (key == "path") {
+            // The path is always last, and may contain spaces
+            perf.path = message.substr(equals + 1);
+            return has_duration && !perf.path.empty();
+        }
+        end = message.find(' ', equals);
+        std::string value = message.substr(equals + 1, end == std::string::npos ? std::string::npos : end - equals - 1);
+        if (key == "us") {
+            perf.duration = std::chrono::microseconds(std::strtoull(value.c_str(), nullptr, 10));
+            has_duration = true;
+        } else if (key == "kind") {
+            perf.kind = value;
+        }
+    }
+    return false;
+}
+
+ManifestTiming& find_manifest(Report& report, std::string const& path, std::string const& kind) {
+    for (auto& manifest : report.manifests) {
+        if (manifest.path == path) {
+            return manifest;
+        }
+    }
+    ManifestTiming manifest;
+    manifest.path = path;
+    manifest.kind = kind;
+    report.manifests.push_back(manifest);
+    return report.manifests.back();
+}
+
+LibraryTiming& find_library(Report& report, std::string const& path, std::string const& kind) {
+    for (auto& library : report.libraries) {
+        if (library.path == path) {
+            return library;
+        }
+    }
+    LibraryTiming library;
+    library.path = path;
+    library.kind = kind;
+    report.libraries.push_back(library);
+    return report.libraries.back();
+}
+
+// Manifests and libraries can be read and loaded more than once during startup, so the times of each are accumulated.
+void record_loader_message(Report& report, std::string const& message) {
+    PerfMessage perf;
+    if (!parse_perf_message(message, perf)) {
+        return;
+    }
+    if (perf.event == "manifest_read") {
+        find_manifest(report, perf.path, perf.kind).read_time += perf.duration;
+    } else if (perf.event == "library_load") {
+        find_library(report, perf.path, perf.kind).load_time += perf.duration;
+    } else if (perf.event == "driver_create_instance") {
+        find_library(report, perf.path, "driver").create_instance_time += perf.duration;
+    }
+}
+
+VKAPI_ATTR VkBool32 VKAPI_CALL record_messages(VkDebugUtilsMessageSeverityFlagBitsEXT, VkDebugUtilsMessageTypeFlagsEXT,
+                                               const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData, void* pUserData) {
+    if (pCallbackData != nullptr && pCallbackData->pMessage != nullptr) {
+        record_loader_message(*static_cast<Report*>(pUserData), pCallbackData->pMessage);
+    }
+    return VK_FALSE;
+}
+
+std::string json_string(std::string const& str) {
+    std::string out = "\"";
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+                    out += escaped;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    return out + "\"";
+}
+
+// Where the time went across all manifests and libraries
+std::vector<Timing> breakdown(Report const& report) {
+    std::vector<Timing> totals(4);
+    totals[0].name = "reading manifests";
+    totals[1].name = "loading layer libraries";
+    totals[2].name = "loading driver libraries";
+    totals[3].name = "driver vkCreateInstance";
+    for (auto const& manifest : report.manifests) {
+        totals[0].duration += manifest.read_time;
+    }
+    for (auto const& library : report.libraries) {
+        totals[library.kind == "layer" ? 1 : 2].duration += library.load_time;
+        totals[3].duration += library.create_instance_time;
+    }
+    return totals;
+}
+
+void write_text_timing(std::ostream& out, std::string const& name, std::chrono::microseconds duration) {
+    out << "    " << std::left << std::setw(60) << name << std::right << std::setw(10) << duration.count() << " us\n";
+}
+
+}  // namespace
+
+Report run(PFN_vkGetInstanceProcAddr get_instance_proc_addr, Options const& options) {
+    Report report;
+
+    LoaderFunctions vk;
+    vk.EnumerateInstanceVersion =
+        reinterpret_cast<PFN_vkEnumerateInstanceVersion>(get_instance_proc_addr(nullptr, "vkEnumerateInstanceVersion"));
+    vk.EnumerateInstanceLayerProperties = reinterpret_cast<PFN_vkEnumerateInstanceLayerProperties>(
+        get_instance_proc_addr(nullptr, "vkEnumerateInstanceLayerProperties"));
+    vk.CreateInstance = reinterpret_cast<PFN_vkCreateInstance>(get_instance_proc_addr(nullptr, "vkCreateInstance"));
+
+    // Layer discovery: finding and parsing every layer manifest
+    uint32_t layer_count = 0;
+    VkResult res = VK_SUCCESS;
+    add_phase(report, "layer discovery", time_call([&]() { res = vk.EnumerateInstanceLayerProperties(&layer_count, nullptr); }));
+    if (fail_phase(report, "layer discovery", res)) {
+        return report;
+    }
+
+    // Instance creation: finding and parsing the manifests, loading the enabled layers and the drivers, then creating an
+    // instance in each driver. Nothing else may query the drivers before this, otherwise the drivers would already be
+    // loaded and the time taken to load them wouldn't be measured.
+    uint32_t api_version = VK_API_VERSION_1_0;
+    if (vk.EnumerateInstanceVersion != nullptr) {
+        vk.EnumerateInstanceVersion(&api_version);
+    }
+    VkApplicationInfo app_info{};
+    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app_info.pApplicationName = "vk_startup_profiler";
+    app_info.apiVersion = api_version;
+
+    VkDebugUtilsMessengerCreateInfoEXT messenger_info{};
+    messenger_info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+    // The loader reports its performance messages as info messages of the performance type
+    messenger_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+    messenger_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+    messenger_info.pfnUserCallback = record_messages;
+    messenger_info.pUserData = &report;
+
+    // Both are implemented by the loader itself. Portability drivers are included since they take part in startup just
+    // like any other driver.
+    std::vector<const char*> enabled_extensions = {VK_EXT_DEBUG_UTILS_EXTENSION_NAME, VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME};
+    std::vector<const char*> enabled_layers;
+    for (auto const& layer : options.layers) {
+        enabled_layers.push_back(layer.c_str());
+    }
+
+    VkInstanceCreateInfo instance_info{};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.pNext = &messenger_info;
+    instance_info.flags = VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR;
+    instance_info.pApplicationInfo = &app_info;
+    instance_info.enabledLayerCount = static_cast<uint32_t>(enabled_layers.size());
+    instance_info.ppEnabledLayerNames = enabled_layers.data();
+    instance_info.enabledExtensionCount = static_cast<uint32_t>(enabled_extensions.size());
+    instance_info.ppEnabledExtensionNames = enabled_extensions.data();
+
+    VkInstance instance = VK_NULL_HANDLE;
+    add_phase(report, "instance creation", time_call([&]() { res = vk.CreateInstance(&instance_info, nullptr, &instance); }));
+    if (fail_phase(report, "instance creation", res)) {
+        return report;
+    }
+
+    vk.DestroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(get_instance_proc_addr(instance, "vkDestroyInstance"));
+    vk.EnumeratePhysicalDevices =
+        reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(get_instance_proc_addr(instance, "vkEnumeratePhysicalDevices"));
+    vk.GetPhysicalDeviceProperties =
+        reinterpret_cast<PFN_vkGetPhysicalDeviceProperties>(get_instance_proc_addr(instance, "vkGetPhysicalDeviceProperties"));
+    vk.CreateDevice = reinterpret_cast<PFN_vkCreateDevice>(get_instance_proc_addr(instance, "vkCreateDevice"));
+    vk.DestroyDevice = reinterpret_cast<PFN_vkDestroyDevice>(get_instance_proc_addr(instance, "vkDestroyDevice"));
+
+    // The messenger in pNext only lasts for vkCreateInstance, so another is needed to keep receiving messages while the
+    // physical devices are enumerated (which is when drivers are instantiated if the loader creates them lazily).
+    vk.CreateDebugUtilsMessengerEXT =
+        reinterpret_cast<PFN_vkCreateDebugUtilsMessengerEXT>(get_instance_proc_addr(instance, "vkCreateDebugUtilsMessengerEXT"));
+    vk.DestroyDebugUtilsMessengerEXT =
+        reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(get_instance_proc_addr(instance, "vkDestroyDebugUtilsMessengerEXT"));
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    vk.CreateDebugUtilsMessengerEXT(instance, &messenger_info, nullptr, &messenger);
+
+    uint32_t physical_device_count = 0;
+    std::vector<VkPhysicalDevice> physical_devices;
+    add_phase(report, "physical device enumeration", time_call([&]() {
+                  res = vk.EnumeratePhysicalDevices(instance, &physical_device_count, nullptr);
+                  if (res == VK_SUCCESS) {
+                      physical_devices.resize(physical_device_count);
+                      res = vk.EnumeratePhysicalDevices(instance, &physical_device_count, physical_devices.data());
+                      physical_devices.resize(physical_device_count);
+                  }
+              }));
+
+    if (!fail_phase(report, "physical device enumeration", res) && options.create_devices) {
+        std::chrono::microseconds total_device_time{};
+        const float queue_priority = 1.0f;
+        for (auto physical_device : physical_devices) {
+            VkPhysicalDeviceProperties properties{};
+            vk.GetPhysicalDeviceProperties(physical_device, &properties);
+
+            VkDeviceQueueCreateInfo queue_info{};
+            queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            queue_info.queueFamilyIndex = 0;
+            queue_info.queueCount = 1;
+            queue_info.pQueuePriorities = &queue_priority;
+            VkDeviceCreateInfo device_info{};
+            device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+            device_info.queueCreateInfoCount = 1;
+            device_info.pQueueCreateInfos = &queue_info;
+
+            VkDevice device = VK_NULL_HANDLE;
+            Timing device_timing;
+            device_timing.name = properties.deviceName;
+            device_timing.duration = time_call([&]() { res = vk.CreateDevice(physical_device, &device_info, nullptr, &device); });
+            report.devices.push_back(device_timing);
+            total_device_time += device_timing.duration;
+            if (fail_phase(report, "device creation", res)) {
+                break;
+            }
+            vk.DestroyDevice(device, nullptr);
+        }
+        add_phase(report, "device creation", total_device_time);
+    }
+
+    if (messenger != VK_NULL_HANDLE) {
+        vk.DestroyDebugUtilsMessengerEXT(instance, messenger, nullptr);
+    }
+    add_phase(report, "instance destruction", time_call([&]() { vk.DestroyInstance(instance, nullptr); }));
+
+    return report;
+}
+
+std::vector<LibraryTiming> slow_libraries(Report const& report, Options const& options) {
+    std::vector<LibraryTiming> slow;
+    for (auto const& library : report.libraries) {
+        if (library.total() >= options.slow_library_threshold) {
+            slow.push_back(library);
+        }
+    }
+    std::stable_sort(slow.begin(), slow.end(),
+                     [](LibraryTiming const& a, LibraryTiming const& b) { return a.total() > b.total(); });
+    return slow;
+}
+
+void write_text(std::ostream& out, Report const& report, Options const& options) {
+    out << "Vulkan startup profile\n";
+    if (!report.failed_phase.empty()) {
+        out << "  " << report.failed_phase << " failed with VkResult " << report.result << "\n";
+    }
+    out << "  Phases:\n";
+    for (auto const& phase : report.phases) {
+        write_text_timing(out, phase.name, phase.duration);
+    }
+    out << "  Breakdown:\n";
+    for (auto const& total : breakdown(report)) {
+        write_text_timing(out, total.name, total.duration);
+    }
+    out << "  Manifests (time to read and parse):\n";
+    for (auto const& manifest : report.manifests) {
+        write_text_timing(out, manifest.kind + " " + manifest.path, manifest.read_time);
+    }
+    out << "  Libraries (time to load, plus vkCreateInstance for drivers):\n";
+    for (auto const& library : report.libraries) {
+        write_text_timing(out, library.kind + " " + library.path, library.total());
+    }
+    if (!report.devices.empty()) {
+        out << "  Devices (time to create):\n";
+        for (auto const& device : report.devices) {
+            write_text_timing(out, device.name, device.duration);
+        }
+    }
+    auto slow = slow_libraries(report, options);
+    out << "  Slow libraries (at least " << options.slow_library_threshold.count() << " us):";
+    out << (slow.empty() ? " none\n" : "\n");
+    for (auto const& library : slow) {
+        write_text_timing(out, library.kind + " " + library.path, library.total());
+    }
+}
+
+void write_json(std::ostream& out, Report const& report, Options const& options) {
+    out << "{\n";
+    out << "  \"result\": " << report.result << ",\n";
+    out << "  \"failed_phase\": " << (report.failed_phase.empty() ? "null" : json_string(report.failed_phase)) << ",\n";
+
+    out << "  \"phases\": [";
+    for (size_t i = 0; i < report.phases.size(); i++) {
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": " << json_string(report.phases[i].name)
+            << ", \"duration_us\": " << report.phases[i].duration.count() << "}";
+    }
+    out << "\n  ],\n";
+
+    auto totals = breakdown(report);
+    out << "  \"breakdown\": [";
+    for (size_t i = 0; i < totals.size(); i++) {
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": " << json_string(totals[i].name)
+            << ", \"duration_us\": " << totals[i].duration.count() << "}";
+    }
+    out << "\n  ],\n";
+
+    out << "  \"manifests\": [";
+    for (size_t i = 0; i < report.manifests.size(); i++) {
+        auto const& manifest = report.manifests[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\"path\": " << json_string(manifest.path)
+            << ", \"kind\": " << json_string(manifest.kind) << ", \"read_us\": " << manifest.read_time.count() << "}";
+    }
+    out << "\n  ],\n";
+
+    auto slow = slow_libraries(report, options);
+    out << "  \"libraries\": [";
+    for (size_t i = 0; i < report.libraries.size(); i++) {
+        auto const& library = report.libraries[i];
+        bool is_slow = std::any_of(slow.begin(), slow.end(), [&](LibraryTiming const& s) { return s.path == library.path; });
+        out << (i == 0 ? "\n" : ",\n") << "    {\"path\": " << json_string(library.path)
+            << ", \"kind\": " << json_string(library.kind) << ", \"load_us\": " << library.load_time.count()
+            << ", \"create_instance_us\": " << library.create_instance_time.count() << ", \"slow\": " << (is_slow ? "true" : "false")
+            << "}";
+    }
+    out << "\n  ],\n";
+
+    out << "  \"devices\": [";
+    for (size_t i = 0; i < report.devices.size(); i++) {
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": " << json_string(report.devices[i].name)
+            << ", \"create_us\": " << report.devices[i].duration.count() << "}";
+    }
+    out << "\n  ],\n";
+
+    out << "  \"slow_library_threshold_us\": " << options.slow_library_threshold.count() << "\n";
+    out << "}\n";
+}
+
+}  // namespace startup_profiler
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures how long the loader takes to start up against whatever configuration (manifests, drivers, layers, environment
+// variables) is present on the system.
+//
+// Each phase is timed by wrapping the Vulkan calls which perform it. The time spent on each manifest and library is taken
+// from the performance messages the loader emits (the same ones printed with VK_LOADER_DEBUG=perf), which are received
+// through a debug utils messenger.
+
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace startup_profiler {
+
+struct Options {
+    // Explicit layers to enable, in addition to any implicit layers
+    std::vector<std::string> layers;
+    // Whether to create a VkDevice on each physical device
+    bool create_devices = true;
+    // Libraries which took at least this long to load and create an instance in are reported as slow
+    std::chrono::microseconds slow_library_threshold = std::chrono::milliseconds(5);
+};
+
+struct Timing {
+    std::string name;
+    std::chrono::microseconds duration{};
+};
+
+struct ManifestTiming {
+    std::string path;
+    std::string kind;  // "driver" or "layer"
+    std::chrono::microseconds read_time{};
+};
+
+struct LibraryTiming {
+    std::string path;
+    std::string kind;  // "driver" or "layer"
+    std::chrono::microseconds load_time{};
+    std::chrono::microseconds create_instance_time{};  // Only for drivers
+
+    std::chrono::microseconds total() const { return load_time + create_instance_time; }
+};
+
+struct Report {
+    VkResult result = VK_SUCCESS;
+    std::string failed_phase;  // Empty if every phase succeeded
+    std::vector<Timing> phases;
+    std::vector<ManifestTiming> manifests;
+    std::vector<LibraryTiming> libraries;
+    std::vector<Timing> devices;  // vkCreateDevice time of each physical device, by device name
+};
+
+// Runs every startup phase using the loader that get_instance_proc_addr came from.
+Report run(PFN_vkGetInstanceProcAddr get_instance_proc_addr, Options const& options);
+
+// The libraries whose load and vkCreateInstance time is at least options.slow_library_threshold, slowest first.
+std::vector<LibraryTiming> slow_libraries(Report const& report, Options const& options);
+
+void write_text(std::ostream& out, Report const& report, Options const& options);
+void write_json(std::ostream& out, Report const& report, Options const& options);
+
+}  // namespace startup_profiler